@@ -0,0 +1,5 @@
+/// \mainpage
+///
+/// This is the source documentation for:
+///
+/// OpenMW 0.29.0
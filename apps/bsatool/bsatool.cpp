@@ -1,14 +1,19 @@
 #include <iostream>
 #include <vector>
+#include <map>
+#include <algorithm>
 #include <exception>
 
 #include <boost/program_options.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/fstream.hpp>
+#include <boost/thread.hpp>
 
 #include <components/bsa/bsa_file.hpp>
+#include <components/bsa/bsa_writer.hpp>
+#include <components/misc/stringops.hpp>
 
-#define BSATOOL_VERSION 1.1
+#define BSATOOL_VERSION 1.2
 
 // Create local aliases for brevity
 namespace bpo = boost::program_options;
@@ -20,9 +25,12 @@ struct Arguments
     std::string filename;
     std::string extractfile;
     std::string outdir;
+    std::string sourcedir;
+    std::string orderfile;
 
     bool longformat;
     bool fullpath;
+    int threads;
 };
 
 void replaceAll(std::string& str, const std::string& needle, const std::string& substitute)
@@ -43,8 +51,10 @@ bool parseOptions (int argc, char** argv, Arguments &info)
             "      List the files presents in the input archive.\n\n"
             "  bsatool extract [-f] archivefile [file_to_extract] [output_directory]\n"
             "      Extract a file from the input archive.\n\n"
-            "  bsatool extractall archivefile [output_directory]\n"
+            "  bsatool extractall [-j threads] archivefile [output_directory]\n"
             "      Extract all files from the input archive.\n\n"
+            "  bsatool create [-o tracefile] archivefile source_directory\n"
+            "      Create an archive from all files in the source directory.\n\n"
             "Allowed options");
 
     desc.add_options()
@@ -53,6 +63,11 @@ bool parseOptions (int argc, char** argv, Arguments &info)
         ("long,l", "Include extra information in archive listing.")
         ("full-path,f", "Create diretory hierarchy on file extraction "
          "(always true for extractall).")
+        ("threads,j", bpo::value<int>()->default_value(0),
+         "Number of threads used by extractall (0: one per CPU core).")
+        ("order,o", bpo::value<std::string>(),
+         "Store the data of the files listed in this file first and in the listed order "
+         "(e.g. a trace recorded with openmw --resource-trace).")
         ;
 
     // input-file is hidden and used as a positional argument
@@ -104,7 +119,8 @@ bool parseOptions (int argc, char** argv, Arguments &info)
     }
 
     info.mode = variables["mode"].as<std::string>();
-    if (!(info.mode == "list" || info.mode == "extract" || info.mode == "extractall"))
+    if (!(info.mode == "list" || info.mode == "extract" || info.mode == "extractall" ||
+        info.mode == "create"))
     {
         std::cout << std::endl << "ERROR: invalid mode \"" << info.mode << "\"\n\n"
             << desc << std::endl;
@@ -135,11 +151,25 @@ bool parseOptions (int argc, char** argv, Arguments &info)
         if (variables["input-file"].as< std::vector<std::string> >().size() > 2)
             info.outdir = variables["input-file"].as< std::vector<std::string> >()[2];
     }
+    else if (info.mode == "create")
+    {
+        if (variables["input-file"].as< std::vector<std::string> >().size() < 2)
+        {
+            std::cout << "\nERROR: source directory unspecified\n\n"
+                << desc << std::endl;
+            return false;
+        }
+        info.sourcedir = variables["input-file"].as< std::vector<std::string> >()[1];
+    }
     else if (variables["input-file"].as< std::vector<std::string> >().size() > 1)
         info.outdir = variables["input-file"].as< std::vector<std::string> >()[1];
 
     info.longformat = variables.count("long");
     info.fullpath = variables.count("full-path");
+    info.threads = variables["threads"].as<int>();
+
+    if (variables.count("order"))
+        info.orderfile = variables["order"].as<std::string>();
 
     return true;
 }
@@ -147,6 +177,7 @@ bool parseOptions (int argc, char** argv, Arguments &info)
 int list(Bsa::BSAFile& bsa, Arguments& info);
 int extract(Bsa::BSAFile& bsa, Arguments& info);
 int extractAll(Bsa::BSAFile& bsa, Arguments& info);
+int create(Arguments& info);
 
 int main(int argc, char** argv)
 {
@@ -154,6 +185,9 @@ int main(int argc, char** argv)
     if(!parseOptions (argc, argv, info))
         return 1;
 
+    if (info.mode == "create")
+        return create(info);
+
     // Open file
     Bsa::BSAFile bsa;
     try
@@ -247,23 +281,88 @@ int extract(Bsa::BSAFile& bsa, Arguments& info)
     return 0;
 }
 
+/// Extracts a range of files, reading the archive directly at the stored offsets
+class ExtractWorker
+{
+    const std::string& mArchive;
+    const std::vector<std::pair<const Bsa::BSAFile::FileStruct *, bfs::path> >& mFiles;
+    std::size_t mBegin;
+    std::size_t mEnd;
+    boost::mutex& mMutex;
+    std::string& mError;
+
+public:
+
+    ExtractWorker(const std::string& archive,
+        const std::vector<std::pair<const Bsa::BSAFile::FileStruct *, bfs::path> >& files,
+        std::size_t begin, std::size_t end, boost::mutex& mutex, std::string& error)
+    : mArchive(archive), mFiles(files), mBegin(begin), mEnd(end), mMutex(mutex), mError(error)
+    {}
+
+    void operator()() const
+    {
+        std::ifstream input(mArchive.c_str(), std::ios_base::binary);
+        std::vector<char> buffer;
+
+        for (std::size_t i = mBegin; i < mEnd; ++i)
+        {
+            const Bsa::BSAFile::FileStruct& file = *mFiles[i].first;
+            const bfs::path& target = mFiles[i].second;
+
+            buffer.resize(file.fileSize);
+
+            if (file.fileSize > 0)
+            {
+                input.seekg(file.offset);
+                input.read(&buffer[0], file.fileSize);
+            }
+
+            bfs::ofstream out(target, std::ios::binary);
+
+            if (file.fileSize > 0)
+                out.write(&buffer[0], file.fileSize);
+
+            boost::lock_guard<boost::mutex> lock(mMutex);
+
+            if (!input || !out)
+            {
+                if (mError.empty())
+                    mError = "failed to extract " + target.string();
+                return;
+            }
+
+            std::cout << "Extracting " << target << std::endl;
+        }
+    }
+};
+
+bool compareOffsets(const std::pair<const Bsa::BSAFile::FileStruct *, bfs::path>& left,
+    const std::pair<const Bsa::BSAFile::FileStruct *, bfs::path>& right)
+{
+    return left.first->offset < right.first->offset;
+}
+
 int extractAll(Bsa::BSAFile& bsa, Arguments& info)
 {
     // Get the list of files present in the archive
-    Bsa::BSAFile::FileList list = bsa.getList();
+    const Bsa::BSAFile::FileList& list = bsa.getList();
 
-    // Iter on the list
-    for(Bsa::BSAFile::FileList::iterator it = list.begin(); it != list.end(); ++it) {
-        const char* archivePath = it->name;
+    std::vector<std::pair<const Bsa::BSAFile::FileStruct *, bfs::path> > files;
+    files.reserve(list.size());
 
-        std::string extractPath (archivePath);
+    uint64_t totalSize = 0;
+
+    for (Bsa::BSAFile::FileList::const_iterator it = list.begin(); it != list.end(); ++it)
+    {
+        std::string extractPath (it->name);
         replaceAll(extractPath, "\\", "/");
 
         // Get the target path (the path the file will be extracted to)
         bfs::path target (info.outdir);
         target /= extractPath;
 
-        // Create the directory hierarchy
+        // Create the directory hierarchy (before the workers start, so they don't race each
+        // other)
         bfs::create_directories(target.parent_path());
 
         bfs::file_status s = bfs::status(target.parent_path());
@@ -273,16 +372,145 @@ int extractAll(Bsa::BSAFile& bsa, Arguments& info)
             return 3;
         }
 
-        // Get a stream for the file to extract
-        // (inefficient because getFile iter on the list again)
-        Ogre::DataStreamPtr data = bsa.getFile(archivePath);
-        bfs::ofstream out(target, std::ios::binary);
+        files.push_back(std::make_pair(&*it, target));
+        totalSize += it->fileSize;
+    }
+
+    // Read the archive front to back
+    std::sort(files.begin(), files.end(), compareOffsets);
+
+    int threads = info.threads;
+
+    if (threads <= 0)
+        threads = std::max(1u, boost::thread::hardware_concurrency());
+
+    // Split into contiguous ranges of roughly equal size
+    boost::mutex mutex;
+    std::string error;
+    boost::thread_group workers;
+
+    std::size_t begin = 0;
+    uint64_t assigned = 0;
+
+    for (int i = 0; i < threads && begin < files.size(); ++i)
+    {
+        uint64_t limit = totalSize * (i+1) / threads;
+        std::size_t end = begin;
+
+        while (end < files.size() && (assigned < limit || end == begin || i == threads-1))
+            assigned += files[end++].first->fileSize;
+
+        workers.create_thread(ExtractWorker(bsa.getFilename(), files, begin, end, mutex, error));
+
+        begin = end;
+    }
+
+    workers.join_all();
+
+    if (!error.empty())
+    {
+        std::cout << "ERROR: " << error << std::endl;
+        return 3;
+    }
+
+    return 0;
+}
+
+int create(Arguments& info)
+{
+    bfs::path root (info.sourcedir);
+
+    if (!bfs::is_directory(root))
+    {
+        std::cout << "ERROR: " << root << " is not a directory." << std::endl;
+        return 3;
+    }
+
+    // Access order (first access counts)
+    std::map<std::string, std::size_t> order;
+
+    if (!info.orderfile.empty())
+    {
+        bfs::ifstream trace(info.orderfile);
+
+        if (!trace.is_open())
+        {
+            std::cout << "ERROR: can not open " << info.orderfile << std::endl;
+            return 3;
+        }
+
+        std::string line;
+
+        while (std::getline(trace, line))
+        {
+            if (!line.empty() && line[line.size()-1] == '\r')
+                line.erase(line.size()-1);
+
+            std::string name = Misc::StringUtils::lowerCase(line);
+            replaceAll(name, "/", "\\");
+
+            order.insert(std::make_pair(name, order.size()));
+        }
+    }
+
+    // Collect files: traced files in access order, everything else by name afterwards
+    std::vector<std::pair<std::pair<std::size_t, std::string>, bfs::path> > files;
+
+    std::size_t rootLength = root.string().size();
+
+    for (bfs::recursive_directory_iterator it(root); it != bfs::recursive_directory_iterator(); ++it)
+    {
+        if (!bfs::is_regular_file(it->status()))
+            continue;
+
+        std::string name = it->path().string().substr(rootLength);
+
+        while (!name.empty() && (name[0] == '/' || name[0] == '\\'))
+            name.erase(0, 1);
+
+        name = Misc::StringUtils::lowerCase(name);
+        replaceAll(name, "/", "\\");
+
+        std::map<std::string, std::size_t>::const_iterator iter = order.find(name);
+        std::size_t rank = iter == order.end() ? order.size() : iter->second;
+
+        files.push_back(std::make_pair(std::make_pair(rank, name), it->path()));
+    }
+
+    std::sort(files.begin(), files.end());
+
+    Bsa::BSAWriter writer;
+    std::size_t traced = 0;
+
+    for (std::size_t i = 0; i < files.size(); ++i)
+    {
+        if (!writer.add(files[i].first.second, files[i].second.string()))
+        {
+            std::cout << "WARNING: skipping duplicate file " << files[i].second << std::endl;
+            continue;
+        }
+
+        if (files[i].first.first < order.size())
+            ++traced;
+    }
 
-        // Write the file to disk
-        std::cout << "Extracting " << target << std::endl;
-        out.write(data->getAsString().c_str(), data->size());
-        out.close();
+    try
+    {
+        writer.write(info.filename);
+    }
+    catch (std::exception& e)
+    {
+        std::cout << "ERROR writing BSA archive '" << info.filename
+            << "'\nDetails:\n" << e.what() << std::endl;
+        return 2;
     }
 
+    std::cout << "Created " << info.filename << " with " << writer.size() << " files";
+
+    if (!info.orderfile.empty())
+        std::cout << " (" << traced << " in access order)";
+
+    std::cout << std::endl;
+
     return 0;
 }
@@ -0,0 +1,381 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <stdexcept>
+
+#include <boost/program_options.hpp>
+#include <boost/thread.hpp>
+#include <boost/thread/tss.hpp>
+
+#include <OgreTimer.h>
+
+#include <components/esm/esmreader.hpp>
+#include <components/esm/records.hpp>
+#include <components/to_utf8/to_utf8.hpp>
+
+#include "record.hpp"
+
+namespace
+{
+    struct AllocationCounter
+    {
+        unsigned long mAllocations;
+
+        AllocationCounter() : mAllocations (0) {}
+    };
+
+    // Both are plain pointers/PODs, so that they can be safely checked from operator new
+    // before static initialisation is complete.
+    bool sCountAllocations = false;
+    boost::thread_specific_ptr<AllocationCounter> *sCounter = 0;
+
+    unsigned long getAllocations()
+    {
+        AllocationCounter *counter = sCounter->get();
+        return counter ? counter->mAllocations : 0;
+    }
+
+    struct TypeStats
+    {
+        int mCount;
+        uint64_t mBytes;
+        unsigned long mMicroseconds;
+        unsigned long mAllocations;
+
+        TypeStats() : mCount (0), mBytes (0), mMicroseconds (0), mAllocations (0) {}
+
+        TypeStats& operator+= (const TypeStats& stats)
+        {
+            mCount += stats.mCount;
+            mBytes += stats.mBytes;
+            mMicroseconds += stats.mMicroseconds;
+            mAllocations += stats.mAllocations;
+            return *this;
+        }
+    };
+
+    typedef std::map<int, TypeStats> Stats; // key: record name
+
+    struct FileResult
+    {
+        std::string mFile;
+        uint64_t mSize;
+        unsigned long mMicroseconds;
+        Stats mStats;
+        std::string mError;
+
+        FileResult() : mSize (0), mMicroseconds (0) {}
+    };
+
+    void loadRefs (ESM::Cell& cell, ESM::ESMReader& esm)
+    {
+        cell.restore (esm, 0);
+
+        ESM::CellRef ref;
+        bool deleted = false;
+
+        while (cell.getNextRef (esm, ref, deleted)) {}
+    }
+
+    void benchFile (FileResult& result, const std::string& encoding, bool loadCells)
+    {
+        sCounter->reset (new AllocationCounter);
+
+        ToUTF8::Utf8Encoder encoder (ToUTF8::calculateEncoding (encoding));
+        ESM::ESMReader esm;
+        esm.setEncoder (&encoder);
+
+        Ogre::Timer fileTimer;
+
+        try
+        {
+            esm.open (result.mFile);
+            result.mSize = esm.getFileSize();
+
+            Ogre::Timer timer;
+
+            while (esm.hasMoreRecs())
+            {
+                uint64_t begin = esm.getFileOffset();
+                unsigned long allocations = getAllocations();
+                timer.reset();
+
+                ESM::NAME n = esm.getRecName();
+                uint32_t flags;
+                esm.getRecHeader (flags);
+
+                std::string id = esm.getHNOString ("NAME");
+                if (id.empty())
+                    id = esm.getHNOString ("INAM");
+
+                EsmTool::RecordBase *record = EsmTool::RecordBase::create (n);
+
+                if (record)
+                {
+                    if (record->getType().val == ESM::REC_GMST)
+                        record->cast<ESM::GameSetting>()->get().mId = id;
+
+                    record->setId (id);
+                    record->setFlags (static_cast<int> (flags));
+                    record->load (esm);
+
+                    if (record->getType().val == ESM::REC_CELL && loadCells)
+                        loadRefs (record->cast<ESM::Cell>()->get(), esm);
+
+                    delete record;
+                }
+                else
+                    esm.skipRecord();
+
+                TypeStats& stats = result.mStats[n.val];
+                ++stats.mCount;
+                stats.mMicroseconds += timer.getMicroseconds();
+                stats.mBytes += esm.getFileOffset()-begin;
+                stats.mAllocations += getAllocations()-allocations;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            result.mError = e.what();
+        }
+
+        result.mMicroseconds = fileTimer.getMicroseconds();
+
+        sCounter->reset();
+    }
+
+    class BenchWorker
+    {
+            std::vector<FileResult>& mResults;
+            std::size_t& mNext;
+            boost::mutex& mMutex;
+            const std::string& mEncoding;
+            bool mLoadCells;
+
+        public:
+
+            BenchWorker (std::vector<FileResult>& results, std::size_t& next, boost::mutex& mutex,
+                const std::string& encoding, bool loadCells)
+            : mResults (results), mNext (next), mMutex (mutex), mEncoding (encoding),
+              mLoadCells (loadCells)
+            {}
+
+            void operator()() const
+            {
+                while (true)
+                {
+                    std::size_t index;
+
+                    {
+                        boost::lock_guard<boost::mutex> lock (mMutex);
+
+                        if (mNext>=mResults.size())
+                            return;
+
+                        index = mNext++;
+                    }
+
+                    benchFile (mResults[index], mEncoding, mLoadCells);
+                }
+            }
+    };
+
+    double getRate (uint64_t bytes, unsigned long microseconds)
+    {
+        return microseconds ? bytes / 1048576.0 / (microseconds / 1000000.0) : 0;
+    }
+}
+
+// Replaces the global allocation function of the whole executable; this is why the benchmark
+// is not part of esmtool.
+void *operator new (std::size_t size) throw (std::bad_alloc)
+{
+    if (sCountAllocations)
+        if (AllocationCounter *counter = sCounter->get())
+            ++counter->mAllocations;
+
+    void *pointer = std::malloc (size ? size : 1);
+
+    if (!pointer)
+        throw std::bad_alloc();
+
+    return pointer;
+}
+
+void operator delete (void *pointer) throw()
+{
+    std::free (pointer);
+}
+
+namespace
+{
+    /// Parse content files and report time, throughput and allocations per record type
+    ///
+    /// Each file is parsed with its own reader; up to \a threads files are parsed concurrently
+    /// (0: one thread per CPU core). Allocations are counted per thread, so the numbers are
+    /// not affected by concurrent files.
+    ///
+    /// \param loadCells Also load the references of all cells (accounted to CELL).
+    /// \return exit code
+    int bench (const std::vector<std::string>& files, const std::string& encoding,
+        bool loadCells, int threads)
+    {
+        if (threads<=0)
+            threads = std::max (1u, boost::thread::hardware_concurrency());
+
+        if (static_cast<std::size_t> (threads)>files.size())
+            threads = files.size();
+
+        std::vector<FileResult> results (files.size());
+
+        for (std::size_t i=0; i<files.size(); ++i)
+            results[i].mFile = files[i];
+
+        sCounter = new boost::thread_specific_ptr<AllocationCounter>;
+        sCountAllocations = true;
+
+        Ogre::Timer timer;
+
+        std::size_t next = 0;
+        boost::mutex mutex;
+        boost::thread_group workers;
+
+        for (int i=0; i<threads; ++i)
+            workers.create_thread (BenchWorker (results, next, mutex, encoding, loadCells));
+
+        workers.join_all();
+
+        unsigned long wallTime = timer.getMicroseconds();
+
+        sCountAllocations = false;
+
+        // report
+        int status = 0;
+        uint64_t totalSize = 0;
+        Stats totals;
+
+        std::cout << std::fixed << std::setprecision (1);
+
+        std::cout << "\nFiles (" << threads << " thread" << (threads==1 ? "" : "s") << "):\n";
+
+        for (std::vector<FileResult>::const_iterator iter (results.begin()); iter!=results.end();
+            ++iter)
+        {
+            std::cout << "  " << iter->mFile << ": ";
+
+            if (!iter->mError.empty())
+            {
+                std::cout << "ERROR: " << iter->mError << std::endl;
+                status = 1;
+                continue;
+            }
+
+            std::cout
+                << iter->mSize << " bytes in " << iter->mMicroseconds/1000.0 << " ms ("
+                << getRate (iter->mSize, iter->mMicroseconds) << " MiB/s)" << std::endl;
+
+            totalSize += iter->mSize;
+
+            for (Stats::const_iterator iter2 (iter->mStats.begin()); iter2!=iter->mStats.end();
+                ++iter2)
+                totals[iter2->first] += iter2->second;
+        }
+
+        std::cout
+            << "\nRecord types:\n  "
+            << std::left << std::setw (6) << "type"
+            << std::right << std::setw (10) << "count"
+            << std::setw (14) << "bytes"
+            << std::setw (12) << "time (ms)"
+            << std::setw (10) << "MiB/s"
+            << std::setw (14) << "allocations" << std::endl;
+
+        for (Stats::const_iterator iter (totals.begin()); iter!=totals.end(); ++iter)
+        {
+            ESM::NAME name;
+            name.val = iter->first;
+
+            std::cout
+                << "  " << std::left << std::setw (6) << name.toString()
+                << std::right << std::setw (10) << iter->second.mCount
+                << std::setw (14) << iter->second.mBytes
+                << std::setw (12) << iter->second.mMicroseconds/1000.0
+                << std::setw (10) << getRate (iter->second.mBytes, iter->second.mMicroseconds)
+                << std::setw (14) << iter->second.mAllocations << std::endl;
+        }
+
+        std::cout
+            << "\nTotal: " << totalSize << " bytes in " << wallTime/1000.0 << " ms ("
+            << getRate (totalSize, wallTime) << " MiB/s)" << std::endl;
+
+        return status;
+    }
+}
+
+int main (int argc, char **argv)
+{
+    namespace bpo = boost::program_options;
+
+    bpo::options_description desc ("Parse Morrowind ES files (ESM, ESP, ESS) and report timing "
+        "statistics\nSyntax: esmbench [options] file...\n\nAllowed options");
+
+    desc.add_options()
+        ("help,h", "print help message.")
+        ("loadcells,C", "Also load the references of all cells.")
+        ("threads,j", bpo::value<int>()->default_value (0),
+         "Number of files parsed concurrently (0: one per CPU core).")
+        ("encoding,e", bpo::value<std::string>()->default_value ("win1252"),
+         "Character encoding (win1250, win1251 or win1252).")
+        ;
+
+    bpo::options_description hidden ("Hidden Options");
+
+    hidden.add_options()
+        ("input-file,i", bpo::value< std::vector<std::string> >(), "input file")
+        ;
+
+    bpo::positional_options_description p;
+    p.add ("input-file", -1);
+
+    bpo::options_description all;
+    all.add (desc).add (hidden);
+    bpo::variables_map variables;
+
+    try
+    {
+        bpo::store (bpo::command_line_parser (argc, argv).options (all).positional (p).run(),
+            variables);
+        bpo::notify (variables);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+
+    if (variables.count ("help"))
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    if (!variables.count ("input-file"))
+    {
+        std::cout << "\nERROR: missing ES file\n\n" << desc << std::endl;
+        return 1;
+    }
+
+    std::string encoding = variables["encoding"].as<std::string>();
+
+    if (encoding!="win1250" && encoding!="win1251" && encoding!="win1252")
+    {
+        std::cout << encoding << " is not a valid encoding option." << std::endl;
+        encoding = "win1252";
+    }
+
+    return bench (variables["input-file"].as< std::vector<std::string> >(), encoding,
+        variables.count ("loadcells")>0, variables["threads"].as<int>());
+}
@@ -47,6 +47,24 @@ CS::Editor::Editor (OgreInit::OgreInit& ogreInit)
 
     connect (&mNewGame, SIGNAL (createRequest (const boost::filesystem::path&)),
              this, SLOT (createNewGame (const boost::filesystem::path&)));
+
+    connect (&mDocumentManager, SIGNAL (documentAdded (CSMDoc::Document *)),
+        this, SLOT (documentAdded (CSMDoc::Document *)));
+    connect (&mDocumentManager, SIGNAL (lastDocumentDeleted()), this, SLOT (showStartup()));
+
+    connect (&mDocumentManager,
+        SIGNAL (loadingStopped (CSMDoc::Document *, bool, const QString&)),
+        &mLoader, SLOT (loadingStopped (CSMDoc::Document *, bool, const QString&)));
+    connect (&mDocumentManager,
+        SIGNAL (nextStage (CSMDoc::Document *, const QString&, int)),
+        &mLoader, SLOT (nextStage (CSMDoc::Document *, const QString&, int)));
+    connect (&mDocumentManager, SIGNAL (nextStep (CSMDoc::Document *, int)),
+        &mLoader, SLOT (nextStep (CSMDoc::Document *, int)));
+
+    connect (&mLoader, SIGNAL (cancel (CSMDoc::Document *)),
+        &mDocumentManager, SLOT (abortLoading (CSMDoc::Document *)));
+    connect (&mLoader, SIGNAL (closeDocument (CSMDoc::Document *)),
+        this, SLOT (closeDocument (CSMDoc::Document *)));
 }
 
 void CS::Editor::setupDataFiles (const Files::PathContainer& dataDirs)
@@ -138,9 +156,7 @@ void CS::Editor::openFiles (const boost::filesystem::path &savePath)
     foreach (const QString &path, mFileDialog.selectedFilePaths())
         files.push_back(path.toStdString());
 
-    CSMDoc::Document *document = mDocumentManager.addDocument (files, savePath, false);
-
-    mViewManager.addView (document);
+    mLoader.add (mDocumentManager.addDocument (files, savePath, false));
     mFileDialog.hide();
 }
 
@@ -154,9 +170,7 @@ void CS::Editor::createNewFile (const boost::filesystem::path &savePath)
 
     files.push_back(mFileDialog.filename().toStdString());
 
-    CSMDoc::Document *document = mDocumentManager.addDocument (files, savePath, true);
-
-    mViewManager.addView (document);
+    mLoader.add (mDocumentManager.addDocument (files, savePath, true));
     mFileDialog.hide();
 }
 
@@ -166,9 +180,7 @@ void CS::Editor::createNewGame (const boost::filesystem::path& file)
 
     files.push_back (file);
 
-    CSMDoc::Document *document = mDocumentManager.addDocument (files, file, true);
-
-    mViewManager.addView (document);
+    mLoader.add (mDocumentManager.addDocument (files, file, true));
 
     mNewGame.hide();
 }
@@ -190,6 +202,17 @@ void CS::Editor::showSettings()
     mSettings.activateWindow();
 }
 
+void CS::Editor::documentAdded (CSMDoc::Document *document)
+{
+    mViewManager.addView (document);
+}
+
+void CS::Editor::closeDocument (CSMDoc::Document *document)
+{
+    if (mDocumentManager.removeDocument (document))
+        showStartup();
+}
+
 bool CS::Editor::makeIPCServer()
 {
     mServer = new QLocalServer(this);
@@ -19,6 +19,7 @@
 #include "view/doc/startup.hpp"
 #include "view/doc/filedialog.hpp"
 #include "view/doc/newgame.hpp"
+#include "view/doc/loader.hpp"
 
 #include "view/settings/usersettingsdialog.hpp"
 
@@ -41,6 +42,7 @@ namespace CS
             CSVDoc::NewGameDialogue mNewGame;
             CSVSettings::UserSettingsDialog mSettings;
             CSVDoc::FileDialog mFileDialog;
+            CSVDoc::Loader mLoader;
 
             boost::filesystem::path mLocal;
 
@@ -77,6 +79,11 @@ namespace CS
 
             void showSettings();
 
+            void documentAdded (CSMDoc::Document *document);
+
+            void closeDocument (CSMDoc::Document *document);
+            ///< Remove a document that could not be loaded.
+
         private:
 
             QString mIpcServerName;
@@ -1,30 +1,11 @@
 #include "document.hpp"
 
-#include <cassert>
-
 #include <boost/filesystem.hpp>
 
 #ifndef Q_MOC_RUN
 #include <components/files/configurationmanager.hpp>
 #endif
 
-void CSMDoc::Document::load (const std::vector<boost::filesystem::path>::const_iterator& begin,
-                             const std::vector<boost::filesystem::path>::const_iterator& end, bool lastAsModified)
-{
-    assert (begin!=end);
-
-    std::vector<boost::filesystem::path>::const_iterator end2 (end);
-
-    if (lastAsModified)
-        --end2;
-
-    for (std::vector<boost::filesystem::path>::const_iterator iter (begin); iter!=end2; ++iter)
-        getData().loadFile (*iter, true, false);
-
-    if (lastAsModified)
-        getData().loadFile (*end2, false, false);
-}
-
 void CSMDoc::Document::addGmsts()
 {
     static const char *gmstFloats[] =
@@ -2223,28 +2204,13 @@ CSMDoc::Document::Document (const Files::ConfigurationManager& configuration, co
     : mSavePath (savePath), mContentFiles (files), mTools (mData), mResDir(resDir),
       mProjectPath ((configuration.getUserDataPath() / "projects") /
                     (savePath.filename().string() + ".project")),
-      mSaving (*this, mProjectPath)
+      mSaving (*this, mProjectPath), mNew (new_), mProjectFileFound (false)
 {
     if (files.empty())
         throw std::runtime_error ("Empty content file sequence");
 
     if (new_ && files.size()==1)
         createBase();
-    else
-    {
-        std::vector<boost::filesystem::path>::const_iterator end = files.end();
-
-        if (new_)
-            --end;
-
-        load (files.begin(), end, !new_);
-    }
-
-    if (new_)
-    {
-        mData.setDescription ("");
-        mData.setAuthor ("");
-    }
 
     bool filtersFound = false;
 
@@ -2275,11 +2241,7 @@ CSMDoc::Document::Document (const Files::ConfigurationManager& configuration, co
         }
     }
 
-    if (filtersFound)
-        getData().loadFile (mProjectPath, false, true);
-
-    addOptionalGmsts();
-    addOptionalGlobals();
+    mProjectFileFound = filtersFound;
 
     connect (&mUndoStack, SIGNAL (cleanChanged (bool)), this, SLOT (modificationStateChanged (bool)));
 
@@ -2327,6 +2289,33 @@ const std::vector<boost::filesystem::path>& CSMDoc::Document::getContentFiles()
     return mContentFiles;
 }
 
+bool CSMDoc::Document::isNew() const
+{
+    return mNew;
+}
+
+const boost::filesystem::path& CSMDoc::Document::getProjectPath() const
+{
+    return mProjectPath;
+}
+
+bool CSMDoc::Document::hasProjectFile() const
+{
+    return mProjectFileFound;
+}
+
+void CSMDoc::Document::completeLoading()
+{
+    if (mNew)
+    {
+        mData.setDescription ("");
+        mData.setAuthor ("");
+    }
+
+    addOptionalGmsts();
+    addOptionalGlobals();
+}
+
 void CSMDoc::Document::save()
 {
     if (mSaving.isRunning())
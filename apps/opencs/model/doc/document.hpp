@@ -44,6 +44,8 @@ namespace CSMDoc
             boost::filesystem::path mProjectPath;
             Saving mSaving;
             boost::filesystem::path mResDir;
+            bool mNew;
+            bool mProjectFileFound;
 
             // It is important that the undo stack is declared last, because on desctruction it fires a signal, that is connected to a slot, that is
             // using other member variables.  Unfortunately this connection is cut only in the QObject destructor, which is way too late.
@@ -53,10 +55,6 @@ namespace CSMDoc
             Document (const Document&);
             Document& operator= (const Document&);
 
-            void load (const std::vector<boost::filesystem::path>::const_iterator& begin,
-                const std::vector<boost::filesystem::path>::const_iterator& end, bool lastAsModified);
-            ///< \param lastAsModified Store the last file in Modified instead of merging it into Base.
-
             void createBase();
 
             void addGmsts();
@@ -75,6 +73,7 @@ namespace CSMDoc
                       const std::vector< boost::filesystem::path >& files,
                       const boost::filesystem::path& savePath,
                       const boost::filesystem::path& resDir, bool new_);
+            ///< \note The content files are not loaded by the constructor. Use a Loader for that.
 
             ~Document();
 
@@ -88,6 +87,17 @@ namespace CSMDoc
             ///< \attention The last element in this collection is the file that is being edited,
             /// but with its original path instead of the save path.
 
+            bool isNew() const;
+            ///< Is this a newly created content file (i.e. the last content file must not be
+            /// loaded)?
+
+            const boost::filesystem::path& getProjectPath() const;
+
+            bool hasProjectFile() const;
+
+            void completeLoading();
+            ///< Called by the loader after all files have been loaded.
+
             void save();
 
             CSMWorld::UniversalId verify();
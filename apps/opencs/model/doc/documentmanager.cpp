@@ -19,10 +19,32 @@ CSMDoc::DocumentManager::DocumentManager (const Files::ConfigurationManager& con
 
     if (!boost::filesystem::is_directory (projectPath))
         boost::filesystem::create_directories (projectPath);
+
+    qRegisterMetaType<CSMDoc::Document *> ("CSMDoc::Document*");
+
+    mLoader.moveToThread (&mLoaderThread);
+    mLoaderThread.start();
+
+    connect (this, SIGNAL (loadRequest (CSMDoc::Document *)),
+        &mLoader, SLOT (loadDocument (CSMDoc::Document *)));
+    connect (this, SIGNAL (cancelLoading (CSMDoc::Document *)),
+        &mLoader, SLOT (abortLoading (CSMDoc::Document *)));
+
+    connect (&mLoader, SIGNAL (documentLoaded (CSMDoc::Document *)),
+        this, SLOT (documentLoaded (CSMDoc::Document *)));
+    connect (&mLoader, SIGNAL (documentNotLoaded (CSMDoc::Document *, const QString&)),
+        this, SLOT (documentNotLoaded (CSMDoc::Document *, const QString&)));
+    connect (&mLoader, SIGNAL (nextStage (CSMDoc::Document *, const QString&, int)),
+        this, SIGNAL (nextStage (CSMDoc::Document *, const QString&, int)));
+    connect (&mLoader, SIGNAL (nextStep (CSMDoc::Document *, int)),
+        this, SIGNAL (nextStep (CSMDoc::Document *, int)));
 }
 
 CSMDoc::DocumentManager::~DocumentManager()
 {
+    mLoaderThread.quit();
+    mLoaderThread.wait();
+
     for (std::vector<Document *>::iterator iter (mDocuments.begin()); iter!=mDocuments.end(); ++iter)
         delete *iter;
 }
@@ -34,6 +56,8 @@ CSMDoc::Document *CSMDoc::DocumentManager::addDocument (const std::vector<boost:
 
     mDocuments.push_back (document);
 
+    emit loadRequest (document);
+
     return document;
 }
 
@@ -54,3 +78,23 @@ void CSMDoc::DocumentManager::setResourceDir (const boost::filesystem::path& par
 {
     mResDir = boost::filesystem::system_complete(parResDir);
 }
+
+void CSMDoc::DocumentManager::documentLoaded (Document *document)
+{
+    emit documentAdded (document);
+    emit loadingStopped (document, true, "");
+}
+
+void CSMDoc::DocumentManager::documentNotLoaded (Document *document, const QString& error)
+{
+    emit loadingStopped (document, false, error);
+
+    // a document that failed to load is kept until the error has been acknowledged
+    if (error.isEmpty() && removeDocument (document))
+        emit lastDocumentDeleted();
+}
+
+void CSMDoc::DocumentManager::abortLoading (Document *document)
+{
+    emit cancelLoading (document);
+}
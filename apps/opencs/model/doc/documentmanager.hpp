@@ -6,6 +6,11 @@
 
 #include <boost/filesystem/path.hpp>
 
+#include <QObject>
+#include <QThread>
+
+#include "loader.hpp"
+
 namespace Files
 {
     class ConfigurationManager;
@@ -15,10 +20,14 @@ namespace CSMDoc
 {
     class Document;
 
-    class DocumentManager
+    class DocumentManager : public QObject
     {
+            Q_OBJECT
+
             std::vector<Document *> mDocuments;
             const Files::ConfigurationManager& mConfiguration;
+            QThread mLoaderThread;
+            Loader mLoader;
 
             DocumentManager (const DocumentManager&);
             DocumentManager& operator= (const DocumentManager&);
@@ -34,15 +43,54 @@ namespace CSMDoc
                                    bool new_);
             ///< The ownership of the returned document is not transferred to the caller.
             ///
+            /// The content files are loaded in the background. Do not connect any views to the
+            /// document before documentAdded has been emitted.
+            ///
             /// \param new_ Do not load the last content file in \a files and instead create in an
             /// appropriate way.
 
             bool removeDocument (Document *document);
             ///< \return last document removed?
+
 	    void setResourceDir (const boost::filesystem::path& parResDir);
 	    
     private:
 	    boost::filesystem::path mResDir;
+
+        private slots:
+
+            void documentLoaded (CSMDoc::Document *document);
+            ///< Document load has been completed.
+
+            void documentNotLoaded (CSMDoc::Document *document, const QString& error);
+            ///< Document load has been interrupted either because of a call to abortLoading
+            /// or a problem during loading). In the former case error will be an empty string.
+
+        public slots:
+
+            void abortLoading (CSMDoc::Document *document);
+            ///< Cancel loading \a document. The document will be removed.
+
+        signals:
+
+            void documentAdded (CSMDoc::Document *document);
+
+            void loadRequest (CSMDoc::Document *document);
+            ///< \note Internal, connected to the loader.
+
+            void lastDocumentDeleted();
+            ///< Emitted when the removal of a document that could not be loaded has left no
+            /// other documents.
+
+            void loadingStopped (CSMDoc::Document *document, bool completed,
+                const QString& error);
+
+            void nextStage (CSMDoc::Document *document, const QString& name, int steps);
+
+            void nextStep (CSMDoc::Document *document, int step);
+
+            void cancelLoading (CSMDoc::Document *document);
+            ///< \note Internal, connected to the loader.
     };
 }
 
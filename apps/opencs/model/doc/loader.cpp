@@ -0,0 +1,114 @@
+
+#include "loader.hpp"
+
+#include <stdexcept>
+
+#include <QTimer>
+
+#include "../world/data.hpp"
+
+#include "document.hpp"
+
+CSMDoc::Loader::Stage::Stage() : mFile (0), mRecordsLeft (false) {}
+
+
+CSMDoc::Loader::Loader()
+{
+    mTimer = new QTimer (this);
+
+    connect (mTimer, SIGNAL (timeout()), this, SLOT (load()));
+}
+
+void CSMDoc::Loader::load()
+{
+    if (mDocuments.empty())
+    {
+        mTimer->stop();
+        return;
+    }
+
+    std::vector<std::pair<Document *, Stage> >::iterator iter = mDocuments.begin();
+
+    Document *document = iter->first;
+
+    int size = static_cast<int> (document->getContentFiles().size());
+
+    if (document->isNew())
+        --size;
+
+    try
+    {
+        if (iter->second.mRecordsLeft)
+        {
+            if (document->getData().continueLoading (sRecordsPerStep))
+            {
+                iter->second.mRecordsLeft = false;
+                ++iter->second.mFile;
+            }
+            else
+                emit nextStep (document, document->getData().getLoadingProgress());
+
+            return;
+        }
+
+        if (iter->second.mFile<size)
+        {
+            boost::filesystem::path path = document->getContentFiles()[iter->second.mFile];
+
+            // the last content file of an existing document is the one being edited
+            bool base = document->isNew() || iter->second.mFile<size-1;
+
+            int steps = document->getData().startLoading (path, base, false);
+            iter->second.mRecordsLeft = true;
+
+            emit nextStage (document, QString::fromUtf8 (path.filename().string().c_str()), steps);
+            return;
+        }
+
+        if (iter->second.mFile==size && document->hasProjectFile())
+        {
+            int steps = document->getData().startLoading (document->getProjectPath(), false, true);
+            iter->second.mRecordsLeft = true;
+
+            emit nextStage (document, "Project File", steps);
+            return;
+        }
+
+        document->completeLoading();
+    }
+    catch (const std::exception& e)
+    {
+        document->getData().abortLoading();
+        mDocuments.erase (iter);
+        emit documentNotLoaded (document, e.what());
+        return;
+    }
+
+    mDocuments.erase (iter);
+    emit documentLoaded (document);
+}
+
+void CSMDoc::Loader::loadDocument (Document *document)
+{
+    mDocuments.push_back (std::make_pair (document, Stage()));
+
+    if (!mTimer->isActive())
+        mTimer->start (0);
+}
+
+void CSMDoc::Loader::abortLoading (Document *document)
+{
+    for (std::vector<std::pair<Document *, Stage> >::iterator iter = mDocuments.begin();
+        iter!=mDocuments.end(); ++iter)
+    {
+        if (iter->first==document)
+        {
+            if (iter==mDocuments.begin())
+                document->getData().abortLoading();
+
+            mDocuments.erase (iter);
+            emit documentNotLoaded (document, "");
+            break;
+        }
+    }
+}
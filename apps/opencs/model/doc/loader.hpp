@@ -0,0 +1,73 @@
+#ifndef CSM_DOC_LOADER_H
+#define CSM_DOC_LOADER_H
+
+#include <vector>
+
+#include <QObject>
+
+class QTimer;
+
+namespace CSMDoc
+{
+    class Document;
+
+    /// \brief Loads documents one chunk of records at a time
+    ///
+    /// The loader is meant to be moved into its own thread. Documents are processed in the order
+    /// they were requested. Content files are loaded sequentially, because each file is merged on
+    /// top of the previous ones.
+    class Loader : public QObject
+    {
+            Q_OBJECT
+
+            struct Stage
+            {
+                int mFile; // content files first, then the project file
+                bool mRecordsLeft; // a file is currently open
+
+                Stage();
+            };
+
+            QTimer *mTimer;
+            std::vector<std::pair<Document *, Stage> > mDocuments;
+
+            static const int sRecordsPerStep = 256;
+
+            // not implemented
+            Loader (const Loader&);
+            Loader& operator= (const Loader&);
+
+        public:
+
+            Loader();
+
+        public slots:
+
+            void loadDocument (CSMDoc::Document *document);
+            ///< The ownership of \a document is not transferred.
+
+            void abortLoading (CSMDoc::Document *document);
+            ///< Abort loading \a document (ignored if \a document has already finished being
+            /// loaded).
+
+        private slots:
+
+            void load();
+            ///< Perform one step of loading the first document in the queue.
+
+        signals:
+
+            void documentLoaded (CSMDoc::Document *document);
+            ///< The ownership of \a document is not transferred.
+
+            void documentNotLoaded (CSMDoc::Document *document, const QString& error);
+            ///< Loading \a document has been interrupted, either because of a call to
+            /// abortLoading or because of an error. In the former case \a error is empty.
+
+            void nextStage (CSMDoc::Document *document, const QString& name, int steps);
+
+            void nextStep (CSMDoc::Document *document, int step);
+    };
+}
+
+#endif
@@ -5,9 +5,11 @@
 #include <vector>
 
 #include <QTimer>
+#include <QThreadPool>
 
 #include "state.hpp"
 #include "stage.hpp"
+#include "parallelrunner.hpp"
 
 void CSMDoc::Operation::prepareStages()
 {
@@ -25,7 +27,7 @@ void CSMDoc::Operation::prepareStages()
 }
 
 CSMDoc::Operation::Operation (int type, bool ordered, bool finalAlways)
-: mType (type), mOrdered (ordered), mFinalAlways (finalAlways)
+: mType (type), mOrdered (ordered), mFinalAlways (finalAlways), mError (false), mRunner (0)
 {
     connect (this, SIGNAL (finished()), this, SLOT (operationDone()));
 }
@@ -36,10 +38,55 @@ CSMDoc::Operation::~Operation()
         delete iter->first;
 }
 
+void CSMDoc::Operation::runParallel (int threads)
+{
+    ParallelRunner runner (mStages);
+
+    {
+        QMutexLocker lock (&mMutex);
+        mRunner = &runner;
+    }
+
+    QThreadPool pool;
+    pool.setMaxThreadCount (threads);
+    runner.start (pool, threads);
+
+    bool done = false;
+
+    while (!done)
+    {
+        std::vector<std::string> messages;
+
+        done = runner.wait (mCurrentStepTotal, messages);
+
+        emit progress (mCurrentStepTotal, mTotalSteps ? mTotalSteps : 1, mType);
+
+        for (std::vector<std::string>::const_iterator iter (messages.begin());
+            iter!=messages.end(); ++iter)
+            emit reportMessage (iter->c_str(), mType);
+    }
+
+    pool.waitForDone();
+
+    QMutexLocker lock (&mMutex);
+    mRunner = 0;
+
+    if (runner.hasAborted())
+        mError = true;
+}
+
 void CSMDoc::Operation::run()
 {
     prepareStages();
 
+    int threads = QThread::idealThreadCount();
+
+    if (!mOrdered && !mFinalAlways && threads>1)
+    {
+        runParallel (threads);
+        return;
+    }
+
     QTimer timer;
 
     timer.connect (&timer, SIGNAL (timeout()), this, SLOT (executeStage()));
@@ -56,6 +103,7 @@ void CSMDoc::Operation::appendStage (Stage *stage)
 
 bool CSMDoc::Operation::hasError() const
 {
+    QMutexLocker lock (&mMutex);
     return mError;
 }
 
@@ -64,6 +112,17 @@ void CSMDoc::Operation::abort()
     if (!isRunning())
         return;
 
+    {
+        QMutexLocker lock (&mMutex);
+
+        if (mRunner)
+        {
+            mError = true;
+            mRunner->abort();
+            return;
+        }
+    }
+
     mError = true;
 
     if (mFinalAlways)
@@ -4,10 +4,12 @@
 #include <vector>
 
 #include <QThread>
+#include <QMutex>
 
 namespace CSMDoc
 {
     class Stage;
+    class ParallelRunner;
 
     class Operation : public QThread
     {
@@ -22,14 +24,21 @@ namespace CSMDoc
             int mOrdered;
             bool mFinalAlways;
             bool mError;
+            ParallelRunner *mRunner;
+            mutable QMutex mMutex; // guards mRunner and mError during a parallel run
 
             void prepareStages();
 
+            void runParallel (int threads);
+
         public:
 
             Operation (int type, bool ordered, bool finalAlways = false);
             ///< \param ordered Stages must be executed in the given order.
             /// \param finalAlways Execute last stage even if an error occurred during earlier stages.
+            ///
+            /// \note If \a ordered and \a finalAlways are both false, the stages are executed
+            /// in parallel on a thread pool (if more than one hardware thread is available).
 
             virtual ~Operation();
 
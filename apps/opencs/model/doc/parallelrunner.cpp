@@ -0,0 +1,176 @@
+
+#include "parallelrunner.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <QThreadPool>
+#include <QRunnable>
+
+#include "stage.hpp"
+
+namespace
+{
+    class Worker : public QRunnable
+    {
+            CSMDoc::ParallelRunner& mRunner;
+
+        public:
+
+            Worker (CSMDoc::ParallelRunner& runner) : mRunner (runner) {}
+
+            virtual void run()
+            {
+                mRunner.work();
+            }
+    };
+}
+
+CSMDoc::ParallelRunner::Task *CSMDoc::ParallelRunner::getTask()
+{
+    while (true)
+    {
+        while (mFirstUnstarted<mTasks.size() && mTasks[mFirstUnstarted].mStarted)
+            ++mFirstUnstarted;
+
+        if (mFirstUnstarted==mTasks.size())
+            return 0;
+
+        for (std::size_t i=mFirstUnstarted; i<mTasks.size(); ++i)
+        {
+            Task& task = mTasks[i];
+
+            if (!task.mStarted && (!task.mFinal || mPending[task.mStageIndex]==0))
+                return &task;
+        }
+
+        // only final tasks are left and their stages are still being worked on
+        mChanged.wait (&mMutex);
+    }
+}
+
+CSMDoc::ParallelRunner::ParallelRunner (const std::vector<std::pair<Stage *, int> >& stages,
+    int taskSize)
+: mPending (stages.size(), 0), mFirstUnstarted (0), mFirstUnreported (0), mCompletedSteps (0),
+  mAborted (false)
+{
+    for (std::size_t i=0; i<stages.size(); ++i)
+    {
+        Task task;
+        task.mStage = stages[i].first;
+        task.mStageIndex = i;
+        task.mStarted = false;
+        task.mDone = false;
+
+        int steps = stages[i].second;
+
+        if (!steps)
+            continue;
+
+        if (!task.mStage->allowsConcurrentSteps())
+        {
+            task.mBegin = 0;
+            task.mEnd = steps;
+            task.mFinal = false;
+            mTasks.push_back (task);
+            continue;
+        }
+
+        task.mFinal = false;
+
+        for (int begin=0; begin<steps-1; begin+=taskSize)
+        {
+            task.mBegin = begin;
+            task.mEnd = std::min (begin+taskSize, steps-1);
+            mTasks.push_back (task);
+            ++mPending[i];
+        }
+
+        task.mBegin = steps-1;
+        task.mEnd = steps;
+        task.mFinal = true;
+        mTasks.push_back (task);
+    }
+}
+
+void CSMDoc::ParallelRunner::start (QThreadPool& pool, int threads)
+{
+    for (int i=0; i<threads; ++i)
+        pool.start (new Worker (*this));
+}
+
+void CSMDoc::ParallelRunner::work()
+{
+    QMutexLocker lock (&mMutex);
+
+    while (Task *task = getTask())
+    {
+        task->mStarted = true;
+
+        lock.unlock();
+
+        std::vector<std::string> messages;
+        int steps = 0;
+
+        for (int i=task->mBegin; i<task->mEnd; ++i)
+        {
+            if (hasAborted())
+                break;
+
+            try
+            {
+                task->mStage->perform (i, messages);
+            }
+            catch (const std::exception& e)
+            {
+                messages.push_back (e.what());
+                abort();
+            }
+
+            ++steps;
+        }
+
+        lock.relock();
+
+        task->mMessages.swap (messages);
+        task->mDone = true;
+        mCompletedSteps += steps;
+
+        if (!task->mFinal)
+            --mPending[task->mStageIndex];
+
+        mChanged.wakeAll();
+    }
+}
+
+bool CSMDoc::ParallelRunner::wait (int& completedSteps, std::vector<std::string>& messages)
+{
+    QMutexLocker lock (&mMutex);
+
+    if (mFirstUnreported<mTasks.size() && !mTasks[mFirstUnreported].mDone)
+        mChanged.wait (&mMutex);
+
+    for (; mFirstUnreported<mTasks.size() && mTasks[mFirstUnreported].mDone; ++mFirstUnreported)
+    {
+        std::vector<std::string>& taskMessages = mTasks[mFirstUnreported].mMessages;
+        messages.insert (messages.end(), taskMessages.begin(), taskMessages.end());
+        std::vector<std::string>().swap (taskMessages);
+    }
+
+    completedSteps = mCompletedSteps;
+
+    return mFirstUnreported==mTasks.size();
+}
+
+void CSMDoc::ParallelRunner::abort()
+{
+    QMutexLocker lock (&mMutex);
+    mAborted = true;
+    mChanged.wakeAll();
+}
+
+bool CSMDoc::ParallelRunner::hasAborted()
+{
+    QMutexLocker lock (&mMutex);
+    return mAborted;
+}
@@ -0,0 +1,86 @@
+#ifndef CSM_DOC_PARALLELRUNNER_H
+#define CSM_DOC_PARALLELRUNNER_H
+
+#include <vector>
+#include <string>
+
+#include <QMutex>
+#include <QWaitCondition>
+
+class QThreadPool;
+
+namespace CSMDoc
+{
+    class Stage;
+
+    /// \brief Performs the steps of independent stages on a thread pool
+    ///
+    /// The steps of each stage are split into tasks. A stage that does not allow concurrent steps
+    /// is performed as a single task (which may still run concurrently with other stages). The last
+    /// step of a stage that does allow concurrent steps is held back until all other steps of that
+    /// stage have been completed.
+    ///
+    /// Messages are collected per task and handed out in task order, i.e. in the same order a
+    /// sequential execution would have produced them.
+    class ParallelRunner
+    {
+            struct Task
+            {
+                Stage *mStage;
+                int mStageIndex;
+                int mBegin;
+                int mEnd;
+                bool mFinal; ///< wait for the other tasks of the stage
+                bool mStarted;
+                bool mDone;
+                std::vector<std::string> mMessages;
+            };
+
+            std::vector<Task> mTasks;
+            std::vector<int> mPending; // per stage: number of unfinished non-final tasks
+            std::size_t mFirstUnstarted;
+            std::size_t mFirstUnreported;
+            int mCompletedSteps;
+            bool mAborted;
+            QMutex mMutex;
+            QWaitCondition mChanged;
+
+            // not implemented
+            ParallelRunner (const ParallelRunner&);
+            ParallelRunner& operator= (const ParallelRunner&);
+
+            Task *getTask();
+            ///< Block until a task is ready to be performed.
+            ///
+            /// \note mMutex must be locked.
+            /// \return 0, if there are no tasks left.
+
+        public:
+
+            ParallelRunner (const std::vector<std::pair<Stage *, int> >& stages, int taskSize = 32);
+            ///< \param stages stage, number of steps (setup must already have been called)
+            /// \param taskSize Maximum number of steps per task
+
+            void start (QThreadPool& pool, int threads);
+            ///< Start \a threads workers on \a pool.
+            ///
+            /// \attention *this must outlive the workers (use QThreadPool::waitForDone).
+
+            void work();
+            ///< Perform tasks until there are none left (called from the worker threads).
+
+            bool wait (int& completedSteps, std::vector<std::string>& messages);
+            ///< Block until the state has changed and append the messages of all tasks that have
+            /// been completed since the last call (in task order) to \a messages.
+            ///
+            /// \return Have all tasks been completed?
+
+            void abort();
+            ///< Skip all steps that have not been started yet.
+
+            bool hasAborted();
+            ///< Has the execution been aborted, either explicitly or because of an exception?
+    };
+}
+
+#endif
@@ -1,4 +1,9 @@
 
 #include "stage.hpp"
 
-CSMDoc::Stage::~Stage() {}
\ No newline at end of file
+CSMDoc::Stage::~Stage() {}
+
+bool CSMDoc::Stage::allowsConcurrentSteps() const
+{
+    return false;
+}
\ No newline at end of file
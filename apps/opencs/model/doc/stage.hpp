@@ -17,6 +17,12 @@ namespace CSMDoc
 
             virtual void perform (int stage, std::vector<std::string>& messages) = 0;
             ///< Messages resulting from this stage will be appended to \a messages.
+
+            virtual bool allowsConcurrentSteps() const;
+            ///< May the steps of this stage be performed concurrently? (default: false)
+            ///
+            /// \note The last step is only performed after all other steps of the stage have been
+            /// completed, so it can be used to report results collected by the other steps.
     };
 }
 
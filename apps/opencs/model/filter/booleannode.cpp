@@ -12,4 +12,9 @@ bool CSMFilter::BooleanNode::test (const CSMWorld::IdTable& table, int row,
 std::string CSMFilter::BooleanNode::toString (bool numericColumns) const
 {
     return mTrue ? "true" : "false";
-}
\ No newline at end of file
+}
+
+int CSMFilter::BooleanNode::getCost() const
+{
+    return 0;
+}
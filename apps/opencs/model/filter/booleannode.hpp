@@ -23,6 +23,8 @@ namespace CSMFilter
             ///
             /// \param numericColumns Use numeric IDs instead of string to represent columns.
 
+            virtual int getCost() const;
+            ///< Return an estimate of the relative cost of testing a row against this node.
     };
 }
 
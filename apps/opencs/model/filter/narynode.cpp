@@ -2,11 +2,34 @@
 #include "narynode.hpp"
 
 #include <sstream>
+#include <algorithm>
+
+namespace
+{
+    struct CostLess
+    {
+        bool operator() (const CSMFilter::Node *left, const CSMFilter::Node *right) const
+        {
+            return left->getCost()<right->getCost();
+        }
+    };
+}
 
 CSMFilter::NAryNode::NAryNode (const std::vector<boost::shared_ptr<Node> >& nodes,
     const std::string& name)
-: mNodes (nodes), mName (name)
-{}
+: mNodes (nodes), mName (name), mCost (0)
+{
+    for (std::vector<boost::shared_ptr<Node> >::const_iterator iter (mNodes.begin());
+         iter!=mNodes.end(); ++iter)
+    {
+        mEvaluationOrder.push_back (iter->get());
+        mCost += (*iter)->getCost();
+    }
+
+    // and/or are free of side effects, so testing the cheap nodes first only changes how early
+    // the evaluation can be cut short
+    std::stable_sort (mEvaluationOrder.begin(), mEvaluationOrder.end(), CostLess());
+}
 
 int CSMFilter::NAryNode::getSize() const
 {
@@ -18,6 +41,11 @@ const CSMFilter::Node& CSMFilter::NAryNode::operator[] (int index) const
     return *mNodes.at (index);
 }
 
+const CSMFilter::Node& CSMFilter::NAryNode::getEvaluationNode (int index) const
+{
+    return *mEvaluationOrder[index];
+}
+
 std::vector<int> CSMFilter::NAryNode::getReferencedColumns() const
 {
     std::vector<int> columns;
@@ -57,4 +85,7 @@ std::string CSMFilter::NAryNode::toString (bool numericColumns) const
     return stream.str();
 }
 
-
+int CSMFilter::NAryNode::getCost() const
+{
+    return mCost;
+}
@@ -13,7 +13,9 @@ namespace CSMFilter
     class NAryNode : public Node
     {
             std::vector<boost::shared_ptr<Node> > mNodes;
+            std::vector<const Node *> mEvaluationOrder; // sorted by cost
             std::string mName;
+            int mCost;
 
         public:
 
@@ -23,6 +25,9 @@ namespace CSMFilter
 
             const Node& operator[] (int index) const;
 
+            const Node& getEvaluationNode (int index) const;
+            ///< Return the child nodes in the order they should be tested (cheapest first).
+
             virtual std::vector<int> getReferencedColumns() const;
             ///< Return a list of the IDs of the columns referenced by this node. The column mapping
             /// passed into test as columns must contain all columns listed here.
@@ -31,6 +36,9 @@ namespace CSMFilter
             ///< Return a string that represents this node.
             ///
             /// \param numericColumns Use numeric IDs instead of string to represent columns.
+
+            virtual int getCost() const;
+            ///< Return an estimate of the relative cost of testing a row against this node.
     };
 }
 
@@ -3,4 +3,9 @@
 
 CSMFilter::Node::Node() {}
 
-CSMFilter::Node::~Node() {}
\ No newline at end of file
+CSMFilter::Node::~Node() {}
+
+int CSMFilter::Node::getCost() const
+{
+    return 1;
+}
\ No newline at end of file
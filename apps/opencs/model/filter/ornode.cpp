@@ -13,7 +13,7 @@ bool CSMFilter::OrNode::test (const CSMWorld::IdTable& table, int row,
     int size = getSize();
 
     for (int i=0; i<size; ++i)
-        if ((*this)[i].test (table, row, columns))
+        if (getEvaluationNode (i).test (table, row, columns))
             return true;
 
     return false;
@@ -4,14 +4,24 @@
 #include <sstream>
 #include <stdexcept>
 
-#include <QRegExp>
-
 #include "../world/columns.hpp"
 #include "../world/idtable.hpp"
 
 CSMFilter::TextNode::TextNode (int columnId, const std::string& text)
-: mColumnId (columnId), mText (text)
-{}
+: mColumnId (columnId), mText (text),
+  /// \todo make pattern syntax configurable
+  mRegExp (QString::fromUtf8 (mText.c_str()), Qt::CaseInsensitive),
+  mHasEnums (CSMWorld::Columns::hasEnums (static_cast<CSMWorld::Columns::ColumnId> (columnId)))
+{
+    if (mHasEnums)
+    {
+        std::vector<std::string> enums =
+            CSMWorld::Columns::getEnums (static_cast<CSMWorld::Columns::ColumnId> (columnId));
+
+        for (std::vector<std::string>::const_iterator iter (enums.begin()); iter!=enums.end(); ++iter)
+            mEnums.push_back (QString::fromUtf8 (iter->c_str()));
+    }
+}
 
 bool CSMFilter::TextNode::test (const CSMWorld::IdTable& table, int row,
     const std::map<int, int>& columns) const
@@ -34,16 +44,12 @@ bool CSMFilter::TextNode::test (const CSMWorld::IdTable& table, int row,
     {
         string = data.toString();
     }
-    else if ((data.type()==QVariant::Int || data.type()==QVariant::UInt) &&
-        CSMWorld::Columns::hasEnums (static_cast<CSMWorld::Columns::ColumnId> (mColumnId)))
+    else if ((data.type()==QVariant::Int || data.type()==QVariant::UInt) && mHasEnums)
     {
         int value = data.toInt();
 
-        std::vector<std::string> enums =
-            CSMWorld::Columns::getEnums (static_cast<CSMWorld::Columns::ColumnId> (mColumnId));
-
-        if (value>=0 && value<static_cast<int> (enums.size()))
-            string = QString::fromUtf8 (enums[value].c_str());
+        if (value>=0 && value<static_cast<int> (mEnums.size()))
+            string = mEnums[value];
     }
     else if (data.type()==QVariant::Bool)
     {
@@ -54,10 +60,7 @@ bool CSMFilter::TextNode::test (const CSMWorld::IdTable& table, int row,
     else
         return false;
 
-    /// \todo make pattern syntax configurable
-    QRegExp regExp (QString::fromUtf8 (mText.c_str()), Qt::CaseInsensitive);
-
-    return regExp.exactMatch (string);
+    return mRegExp.exactMatch (string);
 }
 
 std::vector<int> CSMFilter::TextNode::getReferencedColumns() const
@@ -82,4 +85,9 @@ std::string CSMFilter::TextNode::toString (bool numericColumns) const
     stream << ", \"" << mText << "\")";
 
     return stream.str();
-}
\ No newline at end of file
+}
+
+int CSMFilter::TextNode::getCost() const
+{
+    return 4;
+}
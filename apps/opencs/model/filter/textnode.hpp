@@ -1,6 +1,9 @@
 #ifndef CSM_FILTER_TEXTNODE_H
 #define CSM_FILTER_TEXTNODE_H
 
+#include <QRegExp>
+#include <QString>
+
 #include "leafnode.hpp"
 
 namespace CSMFilter
@@ -9,6 +12,9 @@ namespace CSMFilter
     {
             int mColumnId;
             std::string mText;
+            QRegExp mRegExp;
+            bool mHasEnums;
+            std::vector<QString> mEnums;
 
         public:
 
@@ -27,6 +33,9 @@ namespace CSMFilter
             ///< Return a string that represents this node.
             ///
             /// \param numericColumns Use numeric IDs instead of string to represent columns.
+
+            virtual int getCost() const;
+            ///< Return an estimate of the relative cost of testing a row against this node.
     };
 }
 
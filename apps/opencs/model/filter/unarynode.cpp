@@ -23,4 +23,9 @@ std::vector<int> CSMFilter::UnaryNode::getReferencedColumns() const
 std::string CSMFilter::UnaryNode::toString (bool numericColumns) const
 {
     return mName + " " + mChild->toString (numericColumns);
+}
+
+int CSMFilter::UnaryNode::getCost() const
+{
+    return mChild->getCost();
 }
\ No newline at end of file
@@ -28,6 +28,9 @@ namespace CSMFilter
             ///< Return a string that represents this node.
             ///
             /// \param numericColumns Use numeric IDs instead of string to represent columns.
+
+            virtual int getCost() const;
+            ///< Return an estimate of the relative cost of testing a row against this node.
     };
 }
 
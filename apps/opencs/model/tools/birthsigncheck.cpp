@@ -41,4 +41,9 @@ void CSMTools::BirthsignCheckStage::perform (int stage, std::vector<std::string>
     /// \todo test if the texture exists
 
     /// \todo check data members that can't be edited in the table view
+}
+
+bool CSMTools::BirthsignCheckStage::allowsConcurrentSteps() const
+{
+    return true;
 }
\ No newline at end of file
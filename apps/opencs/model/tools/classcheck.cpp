@@ -74,4 +74,9 @@ void CSMTools::ClassCheckStage::perform (int stage, std::vector<std::string>& me
 
             messages.push_back (stream.str());
         }
+}
+
+bool CSMTools::ClassCheckStage::allowsConcurrentSteps() const
+{
+    return true;
 }
\ No newline at end of file
@@ -63,4 +63,9 @@ void CSMTools::FactionCheckStage::perform (int stage, std::vector<std::string>&
         }
 
     /// \todo check data members that can't be edited in the table view
+}
+
+bool CSMTools::FactionCheckStage::allowsConcurrentSteps() const
+{
+    return true;
 }
\ No newline at end of file
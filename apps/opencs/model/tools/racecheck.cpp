@@ -41,7 +41,10 @@ void CSMTools::RaceCheckStage::performPerRecord (int stage, std::vector<std::str
 
     // remember playable flag
     if (race.mData.mFlags & 0x1)
+    {
+        QMutexLocker lock (&mMutex);
         mPlayable = true;
+    }
 
     /// \todo check data members that can't be edited in the table view
 }
@@ -50,6 +53,8 @@ void CSMTools::RaceCheckStage::performFinal (std::vector<std::string>& messages)
 {
     CSMWorld::UniversalId id (CSMWorld::UniversalId::Type_Races);
 
+    QMutexLocker lock (&mMutex);
+
     if (!mPlayable)
         messages.push_back (id.toString() + "|No playable race");
 }
@@ -70,4 +75,9 @@ void CSMTools::RaceCheckStage::perform (int stage, std::vector<std::string>& mes
         performFinal (messages);
     else
         performPerRecord (stage, messages);
+}
+
+bool CSMTools::RaceCheckStage::allowsConcurrentSteps() const
+{
+    return true;
 }
\ No newline at end of file
@@ -3,6 +3,8 @@
 
 #include <components/esm/loadrace.hpp>
 
+#include <QMutex>
+
 #include "../world/idcollection.hpp"
 
 #include "../doc/stage.hpp"
@@ -14,6 +16,7 @@ namespace CSMTools
     {
             const CSMWorld::IdCollection<ESM::Race>& mRaces;
             bool mPlayable;
+            QMutex mMutex; // guards mPlayable
 
             void performPerRecord (int stage, std::vector<std::string>& messages);
 
@@ -28,6 +31,8 @@ namespace CSMTools
 
             virtual void perform (int stage, std::vector<std::string>& messages);
             ///< Messages resulting from this tage will be appended to \a messages.
+
+            virtual bool allowsConcurrentSteps() const;
     };
 }
 
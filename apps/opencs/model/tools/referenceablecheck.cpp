@@ -227,6 +227,11 @@ int CSMTools::ReferenceableCheckStage::setup()
     return mReferencables.getSize() + 1;
 }
 
+bool CSMTools::ReferenceableCheckStage::allowsConcurrentSteps() const
+{
+    return true;
+}
+
 void CSMTools::ReferenceableCheckStage::bookCheck(
     int stage,
     const CSMWorld::RefIdDataContainer< ESM::Book >& records,
@@ -662,6 +667,7 @@ void CSMTools::ReferenceableCheckStage::npcCheck(
     //Detect if player is present
     if (Misc::StringUtils::ciEqual(npc.mId, "player")) //Happy now, scrawl?
     {
+        QMutexLocker lock(&mMutex);
         mPlayerPresent = true;
     }
 
@@ -956,6 +962,8 @@ void CSMTools::ReferenceableCheckStage::staticCheck(
 
 void CSMTools::ReferenceableCheckStage::finalCheck(std::vector< std::string >& messages)
 {
+    QMutexLocker lock(&mMutex);
+
     if (!mPlayerPresent)
     {
         CSMWorld::UniversalId id(CSMWorld::UniversalId::Type_Npc);
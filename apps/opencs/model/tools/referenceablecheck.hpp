@@ -1,6 +1,8 @@
 #ifndef REFERENCEABLECHECKSTAGE_H
 #define REFERENCEABLECHECKSTAGE_H
 
+#include <QMutex>
+
 #include "../world/universalid.hpp"
 #include "../doc/stage.hpp"
 #include "../world/data.hpp"
@@ -18,6 +20,7 @@ namespace CSMTools
 
             virtual void perform(int stage, std::vector< std::string >& messages);
             virtual int setup();
+            virtual bool allowsConcurrentSteps() const;
 
         private:
             //CONCRETE CHECKS
@@ -73,6 +76,7 @@ namespace CSMTools
             const CSMWorld::IdCollection<ESM::Class>& mClasses;
             const CSMWorld::IdCollection<ESM::Faction>& mFactions;
             bool mPlayerPresent;
+            QMutex mMutex; // guards mPlayerPresent
     };
 }
 #endif // REFERENCEABLECHECKSTAGE_H
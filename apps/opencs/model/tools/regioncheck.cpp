@@ -35,4 +35,9 @@ void CSMTools::RegionCheckStage::perform (int stage, std::vector<std::string>& m
     /// \todo test that the ID in mSleeplist exists
 
     /// \todo check data members that can't be edited in the table view
+}
+
+bool CSMTools::RegionCheckStage::allowsConcurrentSteps() const
+{
+    return true;
 }
\ No newline at end of file
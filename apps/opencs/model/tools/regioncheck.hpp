@@ -23,6 +23,8 @@ namespace CSMTools
 
             virtual void perform (int stage, std::vector<std::string>& messages);
             ///< Messages resulting from this tage will be appended to \a messages.
+
+            virtual bool allowsConcurrentSteps() const;
     };
 }
 
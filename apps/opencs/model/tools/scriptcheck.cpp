@@ -9,8 +9,8 @@
 
 #include "../world/data.hpp"
 
-void CSMTools::ScriptCheckStage::report (const std::string& message, const Compiler::TokenLoc& loc,
-    Type type)
+void CSMTools::ScriptCheckStage::Reporter::report (const std::string& message,
+    const Compiler::TokenLoc& loc, Type type)
 {
     std::ostringstream stream;
 
@@ -28,10 +28,10 @@ void CSMTools::ScriptCheckStage::report (const std::string& message, const Compi
         << ", line " << loc.mLine << ", column " << loc.mColumn
         << " (" << loc.mLiteral << "): " << message;
 
-    mMessages->push_back (stream.str());
+    mMessages.push_back (stream.str());
 }
 
-void CSMTools::ScriptCheckStage::report (const std::string& message, Type type)
+void CSMTools::ScriptCheckStage::Reporter::report (const std::string& message, Type type)
 {
     std::ostringstream stream;
 
@@ -46,15 +46,20 @@ void CSMTools::ScriptCheckStage::report (const std::string& message, Type type)
 
     stream << message;
 
-    mMessages->push_back (stream.str());
+    mMessages.push_back (stream.str());
 }
 
-CSMTools::ScriptCheckStage::ScriptCheckStage (const CSMWorld::Data& data)
-: mData (data), mContext (data), mMessages (0)
+CSMTools::ScriptCheckStage::Reporter::Reporter (const std::string& id, const std::string& file,
+    std::vector<std::string>& messages)
+: mId (id), mFile (file), mMessages (messages)
 {
     /// \todo add an option to configure warning mode
     setWarningsMode (0);
+}
 
+CSMTools::ScriptCheckStage::ScriptCheckStage (const CSMWorld::Data& data)
+: mData (data), mContext (data)
+{
     Compiler::registerExtensions (mExtensions);
     mContext.setExtensions (&mExtensions);
 }
@@ -62,25 +67,24 @@ CSMTools::ScriptCheckStage::ScriptCheckStage (const CSMWorld::Data& data)
 int CSMTools::ScriptCheckStage::setup()
 {
     mContext.clear();
-    mMessages = 0;
-    mId.clear();
 
     return mData.getScripts().getSize();
 }
 
 void CSMTools::ScriptCheckStage::perform (int stage, std::vector<std::string>& messages)
 {
-    mMessages = &messages;
-    mId = mData.getScripts().getId (stage);
+    std::string id = mData.getScripts().getId (stage);
 
     try
     {
-        mFile = mData.getScripts().getRecord (stage).get().mId;
-        std::istringstream input (mData.getScripts().getRecord (stage).get().mScriptText);
+        Reporter reporter (id, mData.getScripts().getRecord (stage).get().mId, messages);
 
-        Compiler::Scanner scanner (*this, input, mContext.getExtensions());
+        const std::string& text = mData.getScripts().getRecord (stage).get().mScriptText;
 
-        Compiler::FileParser parser (*this, mContext);
+        Compiler::Scanner scanner (reporter, text.c_str(), text.c_str()+text.size(),
+            mContext.getExtensions());
+
+        Compiler::FileParser parser (reporter, mContext);
 
         scanner.scan (parser);
     }
@@ -92,12 +96,15 @@ void CSMTools::ScriptCheckStage::perform (int stage, std::vector<std::string>& m
     {
         std::ostringstream stream;
 
-        CSMWorld::UniversalId id (CSMWorld::UniversalId::Type_Script, mId);
+        CSMWorld::UniversalId universalId (CSMWorld::UniversalId::Type_Script, id);
 
-        stream << id.toString() << "|Critical compile error: " << error.what();
+        stream << universalId.toString() << "|Critical compile error: " << error.what();
 
         messages.push_back (stream.str());
     }
+}
 
-    mMessages = 0;
-}
\ No newline at end of file
+bool CSMTools::ScriptCheckStage::allowsConcurrentSteps() const
+{
+    return true;
+}
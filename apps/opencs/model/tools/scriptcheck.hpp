@@ -11,20 +11,33 @@
 namespace CSMTools
 {
     /// \brief VerifyStage: make sure that scripts compile
-    class ScriptCheckStage : public CSMDoc::Stage, private Compiler::ErrorHandler
+    class ScriptCheckStage : public CSMDoc::Stage
     {
+            /// \brief Collects the messages for a single script
+            ///
+            /// Each step uses its own error handler, so that scripts can be checked concurrently.
+            class Reporter : public Compiler::ErrorHandler
+            {
+                    std::string mId;
+                    std::string mFile;
+                    std::vector<std::string>& mMessages;
+
+                    virtual void report (const std::string& message, const Compiler::TokenLoc& loc,
+                        Type type);
+                    ///< Report error to the user.
+
+                    virtual void report (const std::string& message, Type type);
+                    ///< Report a file related error
+
+                public:
+
+                    Reporter (const std::string& id, const std::string& file,
+                        std::vector<std::string>& messages);
+            };
+
             const CSMWorld::Data& mData;
             Compiler::Extensions mExtensions;
             CSMWorld::ScriptContext mContext;
-            std::string mId;
-            std::string mFile;
-            std::vector<std::string> *mMessages;
-
-            virtual void report (const std::string& message, const Compiler::TokenLoc& loc, Type type);
-            ///< Report error to the user.
-
-            virtual void report (const std::string& message, Type type);
-            ///< Report a file related error
 
         public:
 
@@ -35,6 +48,8 @@ namespace CSMTools
 
             virtual void perform (int stage, std::vector<std::string>& messages);
             ///< Messages resulting from this tage will be appended to \a messages.
+
+            virtual bool allowsConcurrentSteps() const;
     };
 }
 
@@ -39,4 +39,9 @@ void CSMTools::SkillCheckStage::perform (int stage, std::vector<std::string>& me
 
     if (skill.mDescription.empty())
         messages.push_back (id.toString() + "|" + skill.mId + " has an empty description");
+}
+
+bool CSMTools::SkillCheckStage::allowsConcurrentSteps() const
+{
+    return true;
 }
\ No newline at end of file
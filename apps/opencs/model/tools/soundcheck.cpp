@@ -31,4 +31,9 @@ void CSMTools::SoundCheckStage::perform (int stage, std::vector<std::string>& me
         messages.push_back (id.toString() + "|Maximum range larger than minimum range");
 
     /// \todo check, if the sound file exists
+}
+
+bool CSMTools::SoundCheckStage::allowsConcurrentSteps() const
+{
+    return true;
 }
\ No newline at end of file
@@ -37,4 +37,9 @@ void CSMTools::SpellCheckStage::perform (int stage, std::vector<std::string>& me
         messages.push_back (id.toString() + "|" + spell.mId + " has a negative spell costs");
 
     /// \todo check data members that can't be edited in the table view
+}
+
+bool CSMTools::SpellCheckStage::allowsConcurrentSteps() const
+{
+    return true;
 }
\ No newline at end of file
@@ -19,7 +19,7 @@ void CSMWorld::Cell::load (ESM::ESMReader &esm)
     }
 }
 
-void CSMWorld::Cell::addRef (const std::string& id)
+void CSMWorld::Cell::addRef (int idNumber)
 {
-    mRefs.push_back (std::make_pair (id, false));
+    mRefs.push_back (std::make_pair (idNumber, false));
 }
\ No newline at end of file
@@ -44,19 +44,47 @@ namespace CSMWorld
     class Collection : public CollectionBase
     {
             std::vector<Record<ESXRecordT> > mRecords;
-            std::map<std::string, int> mIndex;
+            std::map<std::string, int> mIndex; // ID, handle
+            std::vector<int> mHandles; // index -> handle
+            std::vector<int> mHandleIndices; // handle -> index (-1 for unused handles)
+            std::vector<std::map<std::string, int>::iterator> mHandleEntries; // handle -> ID entry
+            std::vector<int> mFreeHandles;
             std::vector<Column<ESXRecordT> *> mColumns;
 
             // not implemented
             Collection (const Collection&);
             Collection& operator= (const Collection&);
 
+            int createHandle (const std::string& id, int index, bool indexId);
+            ///< Create a handle for the record at \a index and add it to the ID map, if \a indexId
+            /// is true (does not touch mRecords or mHandles).
+
+            void releaseHandle (int index);
+            ///< Remove the record at \a index from the ID map (does not touch mRecords or mHandles).
+            ///
+            /// \note Does not access the record, which may already be erased.
+
+            void updateHandleIndices (int begin);
+            ///< Update the handle to index mapping for all records starting at \a begin.
+
         protected:
 
             const std::map<std::string, int>& getIdMap() const;
+            ///< Maps IDs to handles. Use getHandleIndex to get the index of a record.
+
+            int getHandleIndex (int handle) const;
+            ///< Return the index of the record with \a handle.
 
             const std::vector<Record<ESXRecordT> >& getRecords() const;
 
+            int insertRecordImp (const Record<ESXRecordT>& record, int index, bool indexId = true);
+            ///< Insert record before index.
+            ///
+            /// \param indexId Add the record to the ID map. A record that is not in the map can only
+            /// be found by a subclass that overrides searchId.
+            ///
+            /// \return handle of the new record
+
             bool reorderRowsImp (int baseIndex, const std::vector<int>& newOrder);
             ///< Reorder the rows [baseIndex, baseIndex+newOrder.size()) according to the indices
             /// given in \a newOrder (baseIndex+newOrder[0] specifies the new index of row baseIndex).
@@ -150,12 +178,73 @@ namespace CSMWorld
             ///< \attention This function must not change the ID.
     };
 
+    template<typename ESXRecordT, typename IdAccessorT>
+    int Collection<ESXRecordT, IdAccessorT>::createHandle (const std::string& id, int index,
+        bool indexId)
+    {
+        int handle;
+
+        if (mFreeHandles.empty())
+        {
+            handle = static_cast<int> (mHandleIndices.size());
+            mHandleIndices.push_back (index);
+            mHandleEntries.push_back (mIndex.end());
+        }
+        else
+        {
+            handle = mFreeHandles.back();
+            mFreeHandles.pop_back();
+            mHandleIndices[handle] = index;
+        }
+
+        if (indexId)
+        {
+            std::pair<std::map<std::string, int>::iterator, bool> result = mIndex.insert (
+                std::make_pair (Misc::StringUtils::lowerCase (id), handle));
+
+            // a record with a duplicate ID is not reachable by ID, same as before handles were used
+            mHandleEntries[handle] = result.second ? result.first : mIndex.end();
+        }
+        else
+            mHandleEntries[handle] = mIndex.end();
+
+        return handle;
+    }
+
+    template<typename ESXRecordT, typename IdAccessorT>
+    void Collection<ESXRecordT, IdAccessorT>::releaseHandle (int index)
+    {
+        int handle = mHandles[index];
+
+        if (mHandleEntries[handle]!=mIndex.end())
+            mIndex.erase (mHandleEntries[handle]);
+
+        mHandleEntries[handle] = mIndex.end();
+        mHandleIndices[handle] = -1;
+        mFreeHandles.push_back (handle);
+    }
+
+    template<typename ESXRecordT, typename IdAccessorT>
+    void Collection<ESXRecordT, IdAccessorT>::updateHandleIndices (int begin)
+    {
+        int size = static_cast<int> (mHandles.size());
+
+        for (int i=begin; i<size; ++i)
+            mHandleIndices[mHandles[i]] = i;
+    }
+
     template<typename ESXRecordT, typename IdAccessorT>
     const std::map<std::string, int>& Collection<ESXRecordT, IdAccessorT>::getIdMap() const
     {
         return mIndex;
     }
 
+    template<typename ESXRecordT, typename IdAccessorT>
+    int Collection<ESXRecordT, IdAccessorT>::getHandleIndex (int handle) const
+    {
+        return mHandleIndices[handle];
+    }
+
     template<typename ESXRecordT, typename IdAccessorT>
     const std::vector<Record<ESXRecordT> >& Collection<ESXRecordT, IdAccessorT>::getRecords() const
     {
@@ -188,10 +277,16 @@ namespace CSMWorld
             std::copy (buffer.begin(), buffer.end(), mRecords.begin()+baseIndex);
 
             // adjust index
-            for (std::map<std::string, int>::iterator iter (mIndex.begin()); iter!=mIndex.end();
-                 ++iter)
-                if (iter->second>=baseIndex && iter->second<baseIndex+size)
-                    iter->second = newOrder.at (iter->second-baseIndex)+baseIndex;
+            std::vector<int> handles (size);
+
+            for (int i=0; i<size; ++i)
+                handles[newOrder[i]] = mHandles[baseIndex+i];
+
+            for (int i=0; i<size; ++i)
+            {
+                mHandles[baseIndex+i] = handles[i];
+                mHandleIndices[handles[i]] = baseIndex+i;
+            }
         }
 
         return true;
@@ -226,9 +321,9 @@ namespace CSMWorld
     {
         std::string id = Misc::StringUtils::lowerCase (IdAccessorT().getId (record));
 
-        std::map<std::string, int>::iterator iter = mIndex.find (id);
+        int index = searchId (id);
 
-        if (iter==mIndex.end())
+        if (index==-1)
         {
             Record<ESXRecordT> record2;
             record2.mState = Record<ESXRecordT>::State_ModifiedOnly;
@@ -238,7 +333,7 @@ namespace CSMWorld
         }
         else
         {
-            mRecords[iter->second].setModified (record);
+            mRecords[index].setModified (record);
         }
     }
 
@@ -307,41 +402,45 @@ namespace CSMWorld
     template<typename ESXRecordT, typename IdAccessorT>
     void  Collection<ESXRecordT, IdAccessorT>::purge()
     {
-        int i = 0;
+        // compact in a single pass instead of removing the erased records one by one
+        int size = static_cast<int> (mRecords.size());
+        int first = 0;
+
+        while (first<size && !mRecords[first].isErased())
+            ++first;
 
-        while (i<static_cast<int> (mRecords.size()))
+        int target = first;
+
+        for (int i=first; i<size; ++i)
         {
             if (mRecords[i].isErased())
-                removeRows (i, 1);
+            {
+                releaseHandle (i);
+            }
             else
-                ++i;
+            {
+                mRecords[target] = mRecords[i];
+                mHandles[target] = mHandles[i];
+                ++target;
+            }
         }
+
+        mRecords.erase (mRecords.begin()+target, mRecords.end());
+        mHandles.erase (mHandles.begin()+target, mHandles.end());
+
+        updateHandleIndices (first);
     }
 
     template<typename ESXRecordT, typename IdAccessorT>
     void Collection<ESXRecordT, IdAccessorT>::removeRows (int index, int count)
     {
-        mRecords.erase (mRecords.begin()+index, mRecords.begin()+index+count);
+        for (int i=index; i<index+count; ++i)
+            releaseHandle (i);
 
-        typename std::map<std::string, int>::iterator iter = mIndex.begin();
+        mRecords.erase (mRecords.begin()+index, mRecords.begin()+index+count);
+        mHandles.erase (mHandles.begin()+index, mHandles.begin()+index+count);
 
-        while (iter!=mIndex.end())
-        {
-            if (iter->second>=index)
-            {
-                if (iter->second>=index+count)
-                {
-                    iter->second -= count;
-                    ++iter;
-                }
-                else
-                {
-                    mIndex.erase (iter++);
-                }
-            }
-            else
-                ++iter;
-        }
+        updateHandleIndices (index);
     }
 
     template<typename ESXRecordT, typename IdAccessorT>
@@ -369,7 +468,7 @@ namespace CSMWorld
         if (iter==mIndex.end())
             return -1;
 
-        return iter->second;
+        return mHandleIndices[iter->second];
     }
 
     template<typename ESXRecordT, typename IdAccessorT>
@@ -402,8 +501,10 @@ namespace CSMWorld
         for (typename std::map<std::string, int>::const_iterator iter = mIndex.begin();
             iter!=mIndex.end(); ++iter)
         {
-            if (listDeleted || !mRecords[iter->second].isDeleted())
-                ids.push_back (IdAccessorT().getId (mRecords[iter->second].get()));
+            const Record<ESXRecordT>& record = mRecords[mHandleIndices[iter->second]];
+
+            if (listDeleted || !record.isDeleted())
+                ids.push_back (IdAccessorT().getId (record.get()));
         }
 
         return ids;
@@ -425,24 +526,30 @@ namespace CSMWorld
     template<typename ESXRecordT, typename IdAccessorT>
     void Collection<ESXRecordT, IdAccessorT>::insertRecord (const RecordBase& record, int index,
         UniversalId::Type type)
+    {
+        insertRecordImp (dynamic_cast<const Record<ESXRecordT>&> (record), index);
+    }
+
+    template<typename ESXRecordT, typename IdAccessorT>
+    int Collection<ESXRecordT, IdAccessorT>::insertRecordImp (const Record<ESXRecordT>& record,
+        int index, bool indexId)
     {
         if (index<0 || index>static_cast<int> (mRecords.size()))
             throw std::runtime_error ("index out of range");
 
-        const Record<ESXRecordT>& record2 = dynamic_cast<const Record<ESXRecordT>&> (record);
+        mRecords.insert (mRecords.begin()+index, record);
 
-        mRecords.insert (mRecords.begin()+index, record2);
+        int handle = indexId ? createHandle (IdAccessorT().getId (record.get()), index, true) :
+            createHandle ("", index, false);
 
-        if (index<static_cast<int> (mRecords.size())-1)
-        {
-            for (std::map<std::string, int>::iterator iter (mIndex.begin()); iter!=mIndex.end();
-                ++iter)
-                 if (iter->second>=index)
-                     ++(iter->second);
-        }
+        mHandles.insert (mHandles.begin()+index, handle);
+
+        // only the handles of the records behind the new one need to be adjusted (still O(n) for
+        // an insert in the middle, like the insert into mRecords); the ID map refers to handles
+        // and is not touched
+        updateHandleIndices (index+1);
 
-        mIndex.insert (std::make_pair (Misc::StringUtils::lowerCase (IdAccessorT().getId (
-            record2.get())), index));
+        return handle;
     }
 
     template<typename ESXRecordT, typename IdAccessorT>
@@ -37,8 +37,11 @@ namespace CSMWorld
         }
     };
 
-    /// \note Shares ID with IdColumn. A table can not have both.
     template<typename ESXRecordT>
+    struct IdAccessor;
+
+    /// \note Shares ID with IdColumn. A table can not have both.
+    template<typename ESXRecordT, typename IdAccessorT = IdAccessor<ESXRecordT> >
     struct StringIdColumn : public Column<ESXRecordT>
     {
         StringIdColumn (bool hidden = false)
@@ -48,7 +51,7 @@ namespace CSMWorld
 
         virtual QVariant get (const Record<ESXRecordT>& record) const
         {
-            return QString::fromUtf8 (record.get().mId.c_str());
+            return QString::fromUtf8 (IdAccessorT().getId (record.get()).c_str());
         }
 
         virtual bool isEditable() const
@@ -55,7 +55,11 @@ int CSMWorld::Data::count (RecordBase::State state, const CollectionBase& collec
     return number;
 }
 
-CSMWorld::Data::Data() : mRefs (mCells)
+CSMWorld::Data::Data()
+: mRefs (mCells),
+  /// \todo set encoding properly, once config implementation has been fixed.
+  mEncoder (ToUTF8::calculateEncoding ("win1252")),
+  mReader (0), mDialogue (0), mBase (false), mProject (false)
 {
     mGlobals.addColumn (new StringIdColumn<ESM::Global>);
     mGlobals.addColumn (new RecordStateColumn<ESM::Global>);
@@ -196,7 +200,7 @@ CSMWorld::Data::Data() : mRefs (mCells)
     mCells.addColumn (new FlagColumn<Cell> (Columns::ColumnId_InteriorSky, ESM::Cell::QuasiEx));
     mCells.addColumn (new RegionColumn<Cell>);
 
-    mRefs.addColumn (new StringIdColumn<CellRef> (true));
+    mRefs.addColumn (new StringIdColumn<CellRef, RefIdAccessor> (true));
     mRefs.addColumn (new RecordStateColumn<CellRef>);
     mRefs.addColumn (new FixedRecordTypeColumn<CellRef> (UniversalId::Type_Reference));
     mRefs.addColumn (new CellColumn<CellRef>);
@@ -258,6 +262,8 @@ CSMWorld::Data::Data() : mRefs (mCells)
 
 CSMWorld::Data::~Data()
 {
+    delete mReader;
+
     for (std::vector<QAbstractItemModel *>::iterator iter (mModels.begin()); iter!=mModels.end(); ++iter)
         delete *iter;
 }
@@ -481,24 +487,47 @@ void CSMWorld::Data::merge()
     mGlobals.merge();
 }
 
-void CSMWorld::Data::loadFile (const boost::filesystem::path& path, bool base, bool project)
+int CSMWorld::Data::startLoading (const boost::filesystem::path& path, bool base, bool project)
 {
-    ESM::ESMReader reader;
+    abortLoading();
+
+    mReader = new ESM::ESMReader;
+    mReader->setEncoder (&mEncoder);
+
+    try
+    {
+        mReader->open (path.string());
+    }
+    catch (...)
+    {
+        abortLoading();
+        throw;
+    }
+
+    mDialogue = 0;
+    mBase = base;
+    mProject = project;
 
-    /// \todo set encoding properly, once config implementation has been fixed.
-    ToUTF8::Utf8Encoder encoder (ToUTF8::calculateEncoding ("win1252"));
-    reader.setEncoder (&encoder);
+    if (!project)
+    {
+        mAuthor = mReader->getAuthor();
+        mDescription = mReader->getDesc();
+    }
 
-    reader.open (path.string());
+    return static_cast<int> (mReader->getFileSize()/1024)+1;
+}
 
-    const ESM::Dialogue *dialogue = 0;
+bool CSMWorld::Data::continueLoading (int records)
+{
+    if (!mReader)
+        throw std::logic_error ("can't continue loading, because no load has been started");
 
-    mAuthor = reader.getAuthor();
-    mDescription = reader.getDesc();
+    ESM::ESMReader& reader = *mReader;
+    bool base = mBase;
 
     // Note: We do not need to send update signals here, because at this point the model is not connected
     // to any view.
-    while (reader.hasMoreRecs())
+    for (; records>0 && reader.hasMoreRecs(); --records)
     {
         ESM::NAME n = reader.getRecName();
         reader.getRecHeader();
@@ -557,11 +586,11 @@ void CSMWorld::Data::loadFile (const boost::filesystem::path& path, bool base, b
                 if (record.mType==ESM::Dialogue::Journal)
                 {
                     mJournals.load (record, base);
-                    dialogue = &mJournals.getRecord (id).get();
+                    mDialogue = &mJournals.getRecord (id).get();
                 }
                 else if (record.mType==ESM::Dialogue::Deleted)
                 {
-                    dialogue = 0; // record vector can be shuffled around which would make pointer
+                    mDialogue = 0; // record vector can be shuffled around which would make pointer
                                   // to record invalid
 
                     if (mJournals.tryDelete (id))
@@ -580,7 +609,7 @@ void CSMWorld::Data::loadFile (const boost::filesystem::path& path, bool base, b
                 else
                 {
                     mTopics.load (record, base);
-                    dialogue = &mTopics.getRecord (id).get();
+                    mDialogue = &mTopics.getRecord (id).get();
                 }
 
                 break;
@@ -588,24 +617,24 @@ void CSMWorld::Data::loadFile (const boost::filesystem::path& path, bool base, b
 
             case ESM::REC_INFO:
             {
-                if (!dialogue)
+                if (!mDialogue)
                 {
                     /// \todo INFO record without matching DIAL record -> report to user
                     reader.skipRecord();
                     break;
                 }
 
-                if (dialogue->mType==ESM::Dialogue::Journal)
-                    mJournalInfos.load (reader, base, *dialogue);
+                if (mDialogue->mType==ESM::Dialogue::Journal)
+                    mJournalInfos.load (reader, base, *mDialogue);
                 else
-                    mTopicInfos.load (reader, base, *dialogue);
+                    mTopicInfos.load (reader, base, *mDialogue);
 
                 break;
             }
 
             case ESM::REC_FILT:
 
-                if (project)
+                if (mProject)
                 {
                     mFilters.load (reader, base);
                     mFilters.setData (mFilters.getSize()-1,
@@ -623,6 +652,24 @@ void CSMWorld::Data::loadFile (const boost::filesystem::path& path, bool base, b
                 reader.skipRecord();
         }
     }
+
+    if (reader.hasMoreRecs())
+        return false;
+
+    abortLoading();
+    return true;
+}
+
+int CSMWorld::Data::getLoadingProgress()
+{
+    return mReader ? static_cast<int> (mReader->getFileOffset()/1024) : 0;
+}
+
+void CSMWorld::Data::abortLoading()
+{
+    delete mReader;
+    mReader = 0;
+    mDialogue = 0;
 }
 
 bool CSMWorld::Data::hasId (const std::string& id) const
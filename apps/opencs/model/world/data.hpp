@@ -22,6 +22,8 @@
 #include <components/esm/loadspel.hpp>
 #include <components/esm/loaddial.hpp>
 
+#include <components/to_utf8/to_utf8.hpp>
+
 #include "../filter/filter.hpp"
 
 #include "idcollection.hpp"
@@ -33,6 +35,11 @@
 
 class QAbstractItemModel;
 
+namespace ESM
+{
+    class ESMReader;
+}
+
 namespace CSMWorld
 {
     class Data : public QObject
@@ -62,6 +69,11 @@ namespace CSMWorld
             std::map<UniversalId::Type, QAbstractItemModel *> mModelIndex;
             std::string mAuthor;
             std::string mDescription;
+            ToUTF8::Utf8Encoder mEncoder;
+            ESM::ESMReader *mReader; // file that is currently being loaded (or 0)
+            const ESM::Dialogue *mDialogue; // last loaded dialogue record (for info records)
+            bool mBase;
+            bool mProject;
 
             // not implemented
             Data (const Data&);
@@ -167,10 +179,25 @@ namespace CSMWorld
             void merge();
             ///< Merge modified into base.
 
-            void loadFile (const boost::filesystem::path& path, bool base, bool project);
-            ///< Merging content of a file into base or modified.
+            int startLoading (const boost::filesystem::path& path, bool base, bool project);
+            ///< Begin merging content of a file into base or modified.
             ///
             /// \param project load project file instead of content file
+            /// \return number of steps (see getLoadingProgress)
+            ///
+            /// \note The models are not notified about changes while loading. Loading must be
+            /// completed before any view is connected to the models.
+
+            bool continueLoading (int records);
+            ///< Load up to \a records records of the file passed to startLoading.
+            ///
+            /// \return Finished?
+
+            int getLoadingProgress();
+            ///< Return the number of steps completed for the file that is currently being loaded.
+
+            void abortLoading();
+            ///< Close the file that is currently being loaded. Records loaded so far are kept.
 
             bool hasId (const std::string& id) const;
 
@@ -9,15 +9,13 @@ void CSMWorld::IdTableProxyModel::updateColumnMap()
 {
     mColumnMap.clear();
 
-    if (mFilter)
+    if (mFilter && mSourceTable)
     {
         std::vector<int> columns = mFilter->getReferencedColumns();
 
-        const IdTable& table = dynamic_cast<const IdTable&> (*sourceModel());
-
         for (std::vector<int>::const_iterator iter (columns.begin()); iter!=columns.end(); ++iter)
-            mColumnMap.insert (std::make_pair (*iter,
-                table.searchColumnIndex (static_cast<CSMWorld::Columns::ColumnId> (*iter))));
+            mColumnMap.insert (std::make_pair (*iter, mSourceTable->searchColumnIndex (
+                static_cast<CSMWorld::Columns::ColumnId> (*iter))));
     }
 }
 
@@ -27,19 +25,25 @@ bool CSMWorld::IdTableProxyModel::filterAcceptsRow (int sourceRow, const QModelI
     if (!mFilter)
         return true;
 
-    return mFilter->test (
-        dynamic_cast<IdTable&> (*sourceModel()), sourceRow, mColumnMap);
+    return mFilter->test (*mSourceTable, sourceRow, mColumnMap);
 }
 
 CSMWorld::IdTableProxyModel::IdTableProxyModel (QObject *parent)
-: QSortFilterProxyModel (parent)
+: QSortFilterProxyModel (parent), mSourceTable (0)
 {
     setSortCaseSensitivity (Qt::CaseInsensitive);
 }
 
+void CSMWorld::IdTableProxyModel::setSourceModel (QAbstractItemModel *model)
+{
+    mSourceTable = &dynamic_cast<IdTable&> (*model);
+    QSortFilterProxyModel::setSourceModel (model);
+    updateColumnMap();
+}
+
 QModelIndex CSMWorld::IdTableProxyModel::getModelIndex (const std::string& id, int column) const
 {
-    return mapFromSource (dynamic_cast<IdTable&> (*sourceModel()).getModelIndex (id, column));
+    return mapFromSource (mSourceTable->getModelIndex (id, column));
 }
 
 void CSMWorld::IdTableProxyModel::setFilter (const boost::shared_ptr<CSMFilter::Node>& filter)
@@ -13,12 +13,15 @@
 
 namespace CSMWorld
 {
+    class IdTable;
+
     class IdTableProxyModel : public QSortFilterProxyModel
     {
             Q_OBJECT
 
             boost::shared_ptr<CSMFilter::Node> mFilter;
             std::map<int, int> mColumnMap; // column ID, column index in this model (or -1)
+            IdTable *mSourceTable; // cached source model, avoids a cast per filtered row
 
         private:
 
@@ -30,6 +33,8 @@ namespace CSMWorld
 
             IdTableProxyModel (QObject *parent = 0);
 
+            virtual void setSourceModel (QAbstractItemModel *model);
+
             virtual QModelIndex getModelIndex (const std::string& id, int column) const;
 
             void setFilter (const boost::shared_ptr<CSMFilter::Node>& filter);
@@ -156,8 +156,8 @@ CSMWorld::InfoCollection::Range CSMWorld::InfoCollection::getTopicRange (const s
     // string.
     for (; iter!=getIdMap().end(); ++iter)
     {
-        std::string testTopicId =
-            Misc::StringUtils::lowerCase (getRecord (iter->second).get().mTopicId);
+        std::string testTopicId = Misc::StringUtils::lowerCase (
+            getRecord (getHandleIndex (iter->second)).get().mTopicId);
 
         if (testTopicId==topic2)
             break;
@@ -171,7 +171,7 @@ CSMWorld::InfoCollection::Range CSMWorld::InfoCollection::getTopicRange (const s
     if (iter==getIdMap().end())
         return Range (getRecords().end(), getRecords().end());
 
-    RecordConstIterator begin = getRecords().begin()+iter->second;
+    RecordConstIterator begin = getRecords().begin()+getHandleIndex (iter->second);
 
     // Find end
     RecordConstIterator end = begin;
@@ -1,12 +1,40 @@
 
 #include "ref.hpp"
 
+#include <cstdio>
+
 #include "cell.hpp"
 
-void CSMWorld::CellRef::load (ESM::ESMReader &esm, Cell& cell, const std::string& id)
+CSMWorld::CellRef::CellRef() : mIdNumber (-1) {}
+
+void CSMWorld::CellRef::load (ESM::ESMReader &esm, Cell& cell, int idNumber)
 {
-    mId = id;
+    mId.clear();
+    mIdNumber = idNumber;
     mCell = cell.mId;
 
-    cell.addRef (mId);
-}
\ No newline at end of file
+    cell.addRef (mIdNumber);
+}
+
+std::string CSMWorld::CellRef::formatId (int idNumber)
+{
+    char buffer[32];
+    std::sprintf (buffer, "ref#%d", idNumber);
+    return buffer;
+}
+
+std::string& CSMWorld::RefIdAccessor::getId (CellRef& record)
+{
+    if (record.mId.empty() && record.mIdNumber!=-1)
+        record.mId = CellRef::formatId (record.mIdNumber);
+
+    return record.mId;
+}
+
+const std::string CSMWorld::RefIdAccessor::getId (const CellRef& record) const
+{
+    if (record.mId.empty() && record.mIdNumber!=-1)
+        return CellRef::formatId (record.mIdNumber);
+
+    return record.mId;
+}
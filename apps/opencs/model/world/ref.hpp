@@ -15,11 +15,28 @@ namespace CSMWorld
     /// \brief Wrapper for CellRef sub record
     struct CellRef : public ESM::CellRef
     {
-        std::string mId;
+        std::string mId; ///< empty for references loaded from a content file (see mIdNumber)
+        int mIdNumber; ///< ID "ref#N" that is used while mId is empty (-1: none)
         std::string mCell;
 
-        void load (ESM::ESMReader &esm, Cell& cell, const std::string& id);
+        CellRef();
+
+        void load (ESM::ESMReader &esm, Cell& cell, int idNumber);
         ///< Load cell ref and register it with \a cell.
+
+        static std::string formatId (int idNumber);
+        ///< Return the string form of a numeric reference ID.
+    };
+
+    /// \brief Access to the ID of a reference
+    ///
+    /// String IDs of references loaded from a content file are only formatted when requested.
+    struct RefIdAccessor
+    {
+        std::string& getId (CellRef& record);
+        ///< Stores the formatted ID in the record, if it has none yet.
+
+        const std::string getId (const CellRef& record) const;
     };
 }
 
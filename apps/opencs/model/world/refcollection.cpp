@@ -1,32 +1,56 @@
 
 #include "refcollection.hpp"
 
-#include <sstream>
+#include <cctype>
 
 #include "ref.hpp"
 #include "cell.hpp"
 #include "universalid.hpp"
 #include "record.hpp"
 
+int CSMWorld::RefCollection::parseId (const std::string& id)
+{
+    // only the form produced by CellRef::formatId: no sign, no leading zeros
+    if (id.size()<5 || id.size()>4+9 || !Misc::StringUtils::ciEqual (id.substr (0, 4), "ref#") ||
+        (id[4]=='0' && id.size()>5))
+        return -1;
+
+    int number = 0;
+
+    for (std::string::const_iterator iter (id.begin()+4); iter!=id.end(); ++iter)
+    {
+        if (!std::isdigit (*iter))
+            return -1;
+
+        number = number*10 + (*iter-'0');
+    }
+
+    return number;
+}
+
 void CSMWorld::RefCollection::load (ESM::ESMReader& reader, int cellIndex, bool base)
 {
     Record<Cell> cell = mCells.getRecord (cellIndex);
 
     Cell& cell2 = base ? cell.mBase : cell.mModified;
 
-    CellRef ref;
+    // references are read straight into the record, which is reused for the whole cell
+    Record<CellRef> record;
+    record.mState = base ? RecordBase::State_BaseOnly : RecordBase::State_ModifiedOnly;
+    CellRef& ref = base ? record.mBase : record.mModified;
 
     bool deleted = false;
     while (cell2.getNextRef (reader, ref, deleted))
     {
         /// \todo handle deleted and moved references
-        ref.load (reader, cell2, getNewId());
+        ref.load (reader, cell2, mNextId);
+
+        int handle = insertRecordImp (record, getSize(), false);
 
-        Record<CellRef> record2;
-        record2.mState = base ? RecordBase::State_BaseOnly : RecordBase::State_ModifiedOnly;
-        (base ? record2.mBase : record2.mModified) = ref;
+        if (static_cast<int> (mRefHandles.size())<=mNextId)
+            mRefHandles.resize (mNextId+1, -1);
 
-        appendRecord (record2);
+        mRefHandles[mNextId++] = handle;
     }
 
     mCells.setRecord (cellIndex, cell);
@@ -34,9 +58,43 @@ void CSMWorld::RefCollection::load (ESM::ESMReader& reader, int cellIndex, bool
 
 std::string CSMWorld::RefCollection::getNewId()
 {
-    std::ostringstream stream;
-    stream << "ref#" << mNextId++;
-    return stream.str();
+    return CellRef::formatId (mNextId++);
+}
+
+int CSMWorld::RefCollection::searchId (const std::string& id) const
+{
+    int number = parseId (id);
+
+    if (number!=-1 && number<static_cast<int> (mRefHandles.size()) && mRefHandles[number]!=-1)
+    {
+        int index = getHandleIndex (mRefHandles[number]);
+
+        if (index!=-1)
+        {
+            // the handle may have been reused by a different record since
+            const Record<CellRef>& record = getRecord (index);
+            const CellRef& ref =
+                record.mState==RecordBase::State_ModifiedOnly ? record.mModified : record.mBase;
+
+            if (ref.mIdNumber==number && (ref.mId.empty() || Misc::StringUtils::ciEqual (ref.mId, id)))
+                return index;
+        }
+    }
+
+    return Collection<CellRef, RefIdAccessor>::searchId (id);
+}
+
+std::vector<std::string> CSMWorld::RefCollection::getIds (bool listDeleted) const
+{
+    std::vector<std::string> ids;
+
+    int size = getSize();
+
+    for (int i=0; i<size; ++i)
+        if (listDeleted || !getRecord (i).isDeleted())
+            ids.push_back (getId (i));
+
+    return ids;
 }
 
 void CSMWorld::RefCollection::cloneRecord(const std::string& origin, 
@@ -47,5 +105,6 @@ void CSMWorld::RefCollection::cloneRecord(const std::string& origin,
        Record<CSMWorld::CellRef> clone(getRecord(origin));
        clone.mState = CSMWorld::RecordBase::State_ModifiedOnly;
        clone.get().mId = destination;
+       clone.get().mIdNumber = -1;
        insertRecord(clone, getAppendIndex(destination, type), type);
-}
\ No newline at end of file
+}
@@ -11,10 +11,17 @@ namespace CSMWorld
     struct UniversalId;
 
     /// \brief References in cells
-    class RefCollection : public Collection<CellRef>
+    ///
+    /// References loaded from content files are not entered into the ID map. They are found by
+    /// the number in their ID ("ref#N") instead.
+    class RefCollection : public Collection<CellRef, RefIdAccessor>
     {
             Collection<Cell>& mCells;
             int mNextId;
+            std::vector<int> mRefHandles; // ID number -> handle (-1: none)
+
+            static int parseId (const std::string& id);
+            ///< Return the number of a "ref#N" ID or -1, if \a id does not have that form.
 
         public:
             // MSVC needs the constructor for a class inheriting a template to be defined in header
@@ -26,7 +33,15 @@ namespace CSMWorld
             ///< Load a sequence of references.
 
             std::string getNewId();
-            
+
+            virtual int searchId (const std::string& id) const;
+
+            virtual std::vector<std::string> getIds (bool listDeleted = true) const;
+            ///< Return the IDs of all references, in record order.
+            ///
+            /// \note Unlike other collections, the IDs are not sorted. Sorting the IDs of all
+            /// references is expensive and no user of the list needs it sorted.
+
             void cloneRecord(const std::string& origin, 
                              const std::string& destination,
                              const CSMWorld::UniversalId::Type type,
@@ -75,34 +75,48 @@ std::pair<char, bool> CSMWorld::ScriptContext::getMemberType (const std::string&
     if (index==-1)
         return std::make_pair (' ', false);
 
-    std::map<std::string, Compiler::Locals>::iterator iter = mLocals.find (id2);
-
-    if (iter==mLocals.end())
     {
-        Compiler::Locals locals;
+        QMutexLocker lock (&mMutex);
 
-        Compiler::NullErrorHandler errorHandler;
-        std::istringstream stream (mData.getScripts().getRecord (index).get().mScriptText);
-        Compiler::QuickFileParser parser (errorHandler, *this, locals);
-        Compiler::Scanner scanner (errorHandler, stream, getExtensions());
-        scanner.scan (parser);
+        std::map<std::string, Compiler::Locals>::const_iterator iter = mLocals.find (id2);
 
-        iter = mLocals.insert (std::make_pair (id2, locals)).first;
+        if (iter!=mLocals.end())
+            return std::make_pair (iter->second.getType (Misc::StringUtils::lowerCase (name)),
+                reference);
     }
 
+    // parse without holding the lock; if another thread got here first, its result is kept
+    Compiler::Locals locals;
+
+    Compiler::NullErrorHandler errorHandler;
+    const std::string& text = mData.getScripts().getRecord (index).get().mScriptText;
+    Compiler::QuickFileParser parser (errorHandler, *this, locals);
+    Compiler::Scanner scanner (errorHandler, text.c_str(), text.c_str()+text.size(),
+        getExtensions());
+    scanner.scan (parser);
+
+    QMutexLocker lock (&mMutex);
+
+    std::map<std::string, Compiler::Locals>::const_iterator iter =
+        mLocals.insert (std::make_pair (id2, locals)).first;
+
     return std::make_pair (iter->second.getType (Misc::StringUtils::lowerCase (name)), reference);
 }
 
 bool CSMWorld::ScriptContext::isId (const std::string& name) const
 {
-    if (!mIdsUpdated)
     {
-        mIds = mData.getIds();
+        QMutexLocker lock (&mMutex);
+
+        if (!mIdsUpdated)
+        {
+            mIds = mData.getIds();
 
-        std::for_each (mIds.begin(), mIds.end(), &Misc::StringUtils::lowerCase);
-        std::sort (mIds.begin(), mIds.end());
+            std::for_each (mIds.begin(), mIds.end(), &Misc::StringUtils::lowerCase);
+            std::sort (mIds.begin(), mIds.end());
 
-        mIdsUpdated = true;
+            mIdsUpdated = true;
+        }
     }
 
     return std::binary_search (mIds.begin(), mIds.end(), Misc::StringUtils::lowerCase (name));
@@ -5,6 +5,8 @@
 #include <vector>
 #include <map>
 
+#include <QMutex>
+
 #include <components/compiler/context.hpp>
 #include <components/compiler/locals.hpp>
 
@@ -12,12 +14,15 @@ namespace CSMWorld
 {
     class Data;
 
+    /// \note Lookups may be performed concurrently (the caches are guarded by a mutex).
+    /// invalidateIds() and clear() must not be called while lookups are in progress.
     class ScriptContext : public Compiler::Context
     {
             const Data& mData;
             mutable std::vector<std::string> mIds;
             mutable bool mIdsUpdated;
             mutable std::map<std::string, Compiler::Locals> mLocals;
+            mutable QMutex mMutex;
 
         public:
 
@@ -0,0 +1,167 @@
+
+#include "loader.hpp"
+
+#include <QVBoxLayout>
+#include <QLabel>
+#include <QProgressBar>
+#include <QDialogButtonBox>
+#include <QCloseEvent>
+#include <QCursor>
+
+#include "../../model/doc/document.hpp"
+
+void CSVDoc::LoadingDocument::closeEvent (QCloseEvent *event)
+{
+    event->ignore();
+    cancel();
+}
+
+CSVDoc::LoadingDocument::LoadingDocument (CSMDoc::Document *document)
+: mDocument (document), mAborted (false)
+{
+    setWindowTitle (("Loading " + document->getSavePath().filename().string()).c_str());
+
+    QVBoxLayout *layout = new QVBoxLayout (this);
+
+    mFile = new QLabel (this);
+    layout->addWidget (mFile);
+
+    int size = static_cast<int> (document->getContentFiles().size());
+
+    if (document->isNew())
+        --size;
+
+    if (document->hasProjectFile())
+        ++size;
+
+    mFileProgress = new QProgressBar (this);
+    mFileProgress->setMinimum (0);
+    mFileProgress->setMaximum (size>0 ? size : 1);
+    mFileProgress->setTextVisible (true);
+    mFileProgress->setValue (0);
+    mFileProgress->setFormat ("%v of %m files");
+    layout->addWidget (mFileProgress);
+
+    mRecordProgress = new QProgressBar (this);
+    mRecordProgress->setMinimum (0);
+    mRecordProgress->setMaximum (1);
+    mRecordProgress->setTextVisible (true);
+    mRecordProgress->setValue (0);
+    layout->addWidget (mRecordProgress);
+
+    mError = new QLabel (this);
+    mError->setWordWrap (true);
+    mError->hide();
+    layout->addWidget (mError);
+
+    mButtons = new QDialogButtonBox (QDialogButtonBox::Cancel, Qt::Horizontal, this);
+    layout->addWidget (mButtons);
+
+    setLayout (layout);
+
+    move (QCursor::pos());
+
+    show();
+
+    connect (mButtons, SIGNAL (rejected()), this, SLOT (cancel()));
+}
+
+void CSVDoc::LoadingDocument::nextStage (const QString& name, int steps)
+{
+    if (mFile->text().size())
+        mFileProgress->setValue (mFileProgress->value()+1);
+
+    mFile->setText (QString::fromUtf8 ("Loading: ") + name);
+
+    mRecordProgress->setMaximum (steps>0 ? steps : 1);
+    mRecordProgress->setValue (0);
+}
+
+void CSVDoc::LoadingDocument::nextStep (int step)
+{
+    mRecordProgress->setValue (step);
+}
+
+void CSVDoc::LoadingDocument::abort (const QString& error)
+{
+    mAborted = true;
+    mError->setText (QString::fromUtf8 ("<font color=red>Loading failed: ") + error + "</font>");
+    mError->show();
+    mButtons->setStandardButtons (QDialogButtonBox::Close);
+}
+
+void CSVDoc::LoadingDocument::cancel()
+{
+    if (!mAborted)
+        emit cancel (mDocument);
+    else
+        emit closeDocument (mDocument);
+}
+
+
+CSVDoc::Loader::Loader() {}
+
+CSVDoc::Loader::~Loader()
+{
+    for (std::map<CSMDoc::Document *, LoadingDocument *>::iterator iter (mDocuments.begin());
+        iter!=mDocuments.end(); ++iter)
+        delete iter->second;
+}
+
+void CSVDoc::Loader::add (CSMDoc::Document *document)
+{
+    LoadingDocument *loading = new LoadingDocument (document);
+    mDocuments.insert (std::make_pair (document, loading));
+
+    connect (loading, SIGNAL (cancel (CSMDoc::Document *)),
+        this, SIGNAL (cancel (CSMDoc::Document *)));
+    connect (loading, SIGNAL (closeDocument (CSMDoc::Document *)),
+        this, SLOT (documentClosed (CSMDoc::Document *)));
+}
+
+void CSVDoc::Loader::documentClosed (CSMDoc::Document *document)
+{
+    std::map<CSMDoc::Document *, LoadingDocument *>::iterator iter = mDocuments.find (document);
+
+    if (iter!=mDocuments.end())
+    {
+        // the window is the sender of the signal that invoked this slot
+        iter->second->deleteLater();
+        mDocuments.erase (iter);
+    }
+
+    emit closeDocument (document);
+}
+
+void CSVDoc::Loader::loadingStopped (CSMDoc::Document *document, bool completed,
+    const QString& error)
+{
+    std::map<CSMDoc::Document *, LoadingDocument *>::iterator iter = mDocuments.find (document);
+
+    if (iter==mDocuments.end())
+        return;
+
+    if (completed || error.isEmpty())
+    {
+        delete iter->second;
+        mDocuments.erase (iter);
+    }
+    else
+        iter->second->abort (error);
+}
+
+void CSVDoc::Loader::nextStage (CSMDoc::Document *document, const QString& name, int steps)
+{
+    std::map<CSMDoc::Document *, LoadingDocument *>::iterator iter = mDocuments.find (document);
+
+    if (iter!=mDocuments.end())
+        iter->second->nextStage (name, steps);
+}
+
+void CSVDoc::Loader::nextStep (CSMDoc::Document *document, int step)
+{
+    std::map<CSMDoc::Document *, LoadingDocument *>::iterator iter = mDocuments.find (document);
+
+    if (iter!=mDocuments.end())
+        iter->second->nextStep (step);
+}
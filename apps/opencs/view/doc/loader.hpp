@@ -0,0 +1,99 @@
+#ifndef CSV_DOC_LOADER_H
+#define CSV_DOC_LOADER_H
+
+#include <map>
+
+#include <QObject>
+#include <QWidget>
+
+class QLabel;
+class QProgressBar;
+class QDialogButtonBox;
+
+namespace CSMDoc
+{
+    class Document;
+}
+
+namespace CSVDoc
+{
+    /// \brief Progress window for a document that is being loaded
+    class LoadingDocument : public QWidget
+    {
+            Q_OBJECT
+
+            CSMDoc::Document *mDocument;
+            QLabel *mFile;
+            QProgressBar *mFileProgress;
+            QProgressBar *mRecordProgress;
+            QLabel *mError;
+            QDialogButtonBox *mButtons;
+            bool mAborted;
+
+        private:
+
+            void closeEvent (QCloseEvent *event);
+
+        public:
+
+            LoadingDocument (CSMDoc::Document *document);
+
+            void nextStage (const QString& name, int steps);
+
+            void nextStep (int step);
+
+            void abort (const QString& error);
+            ///< Show \a error and wait for the user to close the window.
+
+        private slots:
+
+            void cancel();
+
+        signals:
+
+            void cancel (CSMDoc::Document *document);
+            ///< Stop loading \a document.
+
+            void closeDocument (CSMDoc::Document *document);
+            ///< The window of a document that has failed to load has been closed.
+    };
+
+    /// \brief Manages the progress windows of all documents that are being loaded
+    class Loader : public QObject
+    {
+            Q_OBJECT
+
+            std::map<CSMDoc::Document *, LoadingDocument *> mDocuments;
+
+        public:
+
+            Loader();
+
+            virtual ~Loader();
+
+        signals:
+
+            void cancel (CSMDoc::Document *document);
+
+            void closeDocument (CSMDoc::Document *document);
+            ///< The window of a document that has failed to load has been closed. The document
+            /// should be removed.
+
+        private slots:
+
+            void documentClosed (CSMDoc::Document *document);
+
+        public slots:
+
+            void add (CSMDoc::Document *document);
+
+            void loadingStopped (CSMDoc::Document *document, bool completed,
+                const QString& error);
+
+            void nextStage (CSMDoc::Document *document, const QString& name, int steps);
+
+            void nextStep (CSMDoc::Document *document, int step);
+    };
+}
+
+#endif
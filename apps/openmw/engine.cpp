@@ -5,6 +5,7 @@
 
 #include <OgreRoot.h>
 #include <OgreRenderWindow.h>
+#include <OgreTimer.h>
 
 #include <MyGUI_WidgetManager.h>
 
@@ -186,6 +187,7 @@ OMW::Engine::Engine(Files::ConfigurationManager& configurationManager)
 
 OMW::Engine::~Engine()
 {
+    Bsa::setAccessTrace (0);
     mEnvironment.cleanup();
     delete mScriptContext;
     delete mOgre;
@@ -385,6 +387,16 @@ void OMW::Engine::prepareEngine (Settings::Manager & settings)
 
     mOgre->createWindow("OpenMW", windowSettings);
 
+    if (!mResourceTracePath.empty())
+    {
+        mResourceTrace.open (mResourceTracePath.c_str());
+
+        if (!mResourceTrace.is_open())
+            throw std::runtime_error ("failed to open resource trace file " + mResourceTracePath);
+
+        Bsa::setAccessTrace (&mResourceTrace);
+    }
+
     loadBSA();
 
 
@@ -470,13 +482,18 @@ void OMW::Engine::prepareEngine (Settings::Manager & settings)
     // scripts
     if (mCompileAll)
     {
+        Ogre::Timer timer;
+
         std::pair<int, int> result = MWBase::Environment::get().getScriptManager()->compileAll();
 
+        unsigned long elapsed = timer.getMicroseconds();
+
         if (result.first)
             std::cout
                 << "compiled " << result.second << " of " << result.first << " scripts ("
                 << 100*static_cast<double> (result.second)/result.first
-                << "%)"
+                << "%) in " << elapsed/1000.0 << " ms ("
+                << (elapsed ? result.first*1000000.0/elapsed : 0) << " scripts/s)"
                 << std::endl;
     }
 }
@@ -623,3 +640,8 @@ void OMW::Engine::setWarningsMode (int mode)
 {
     mWarningsMode = mode;
 }
+
+void OMW::Engine::setResourceTrace (const std::string& path)
+{
+    mResourceTracePath = path;
+}
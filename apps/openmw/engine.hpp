@@ -1,6 +1,8 @@
 #ifndef ENGINE_H
 #define ENGINE_H
 
+#include <fstream>
+
 #include <OgreFrameListener.h>
 
 #include <components/compiler/extensions.hpp>
@@ -80,6 +82,8 @@ namespace OMW
             bool mScriptConsoleMode;
             std::string mStartupScript;
             int mActivationDistanceOverride;
+            std::string mResourceTracePath;
+            std::ofstream mResourceTrace;
             // Grab mouse?
             bool mGrab;
 
@@ -184,6 +188,10 @@ namespace OMW
 
             void setWarningsMode (int mode);
 
+            /// Record the names of all resources opened from data directories and archives to
+            /// \a path (empty: disabled).
+            void setResourceTrace (const std::string& path);
+
         private:
             Files::ConfigurationManager& mCfgMgr;
     };
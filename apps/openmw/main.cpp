@@ -161,7 +161,11 @@ bool parseOptions (int argc, char** argv, OMW::Engine& engine, Files::Configurat
 
         ("no-grab", "Don't grab mouse cursor")
 
-        ("activate-dist", bpo::value <int> ()->default_value (-1), "activation distance override");
+        ("activate-dist", bpo::value <int> ()->default_value (-1), "activation distance override")
+
+        ("resource-trace", bpo::value<std::string>()->default_value(""),
+            "record the names of all resource files opened by the game to the given file "
+            "(can be used to create access-ordered archives with bsatool)");
 
     bpo::parsed_options valid_opts = bpo::command_line_parser(argc, argv)
         .options(desc).allow_unregistered().run();
@@ -249,6 +253,7 @@ bool parseOptions (int argc, char** argv, OMW::Engine& engine, Files::Configurat
     engine.setStartupScript (variables["script-run"].as<std::string>());
     engine.setActivationDistanceOverride (variables["activate-dist"].as<int>());
     engine.setWarningsMode (variables["script-warn"].as<int>());
+    engine.setResourceTrace (variables["resource-trace"].as<std::string>());
 
     return true;
 }
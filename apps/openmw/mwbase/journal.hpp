@@ -4,6 +4,7 @@
 #include <string>
 #include <deque>
 #include <map>
+#include <vector>
 
 #include <stdint.h>
 
@@ -32,6 +33,7 @@ namespace MWBase
 
             typedef std::deque<MWDialogue::StampedJournalEntry> TEntryContainer;
             typedef TEntryContainer::const_iterator TEntryIter;
+            typedef std::vector<TEntryContainer::size_type> TEntryIndexContainer;
             typedef std::map<std::string, MWDialogue::Quest> TQuestContainer; // topc, quest
             typedef TQuestContainer::const_iterator TQuestIter;
             typedef std::map<std::string, MWDialogue::Topic> TTopicContainer; // topic-id, topic-content
@@ -64,6 +66,10 @@ namespace MWBase
             virtual TEntryIter end() const = 0;
             ///< Iterator pointing past the end of the main journal.
 
+            virtual const TEntryIndexContainer& getQuestEntries (const std::string& id) const = 0;
+            ///< Positions (relative to begin()) of the main journal entries for quest \a id, in
+            /// journal order.
+
             virtual TQuestIter questBegin() const = 0;
             ///< Iterator pointing to the first quest (sorted by topic ID)
 
@@ -78,6 +84,10 @@ namespace MWBase
             virtual TTopicIter topicEnd() const = 0;
             ///< Iterator pointing past the last topic.
 
+            virtual int getGeneration() const = 0;
+            ///< Changes whenever the journal is cleared or a new topic is added. Adding entries to
+            /// the main journal or to existing topics does not change it.
+
             virtual int countSavedGameRecords() const = 0;
 
             virtual void write (ESM::ESMWriter& writer) const = 0;
@@ -406,6 +406,10 @@ namespace MWBase
             virtual bool getLOS(const MWWorld::Ptr& npc,const MWWorld::Ptr& targetNpc) = 0;
             ///< get Line of Sight (morrowind stupid implementation)
 
+            virtual void getLOS(const MWWorld::Ptr& npc, const std::vector<MWWorld::Ptr>& targets,
+                std::vector<bool>& results) = 0;
+            ///< get Line of Sight from \a npc to each of \a targets
+
             virtual void enableActorCollision(const MWWorld::Ptr& actor, bool enable) = 0;
 
             virtual int canRest() = 0;
@@ -331,7 +331,7 @@ namespace MWClass
                 if(weapon == invStore.end())
                     return std::make_pair(1,"");
 
-                if(weapon->getTypeName() == typeid(ESM::Weapon).name() &&
+                if(weapon->is<ESM::Weapon>() &&
                         (weapon->get<ESM::Weapon>()->mBase->mData.mType == ESM::Weapon::LongBladeTwoHand ||
                 weapon->get<ESM::Weapon>()->mBase->mData.mType == ESM::Weapon::BluntTwoClose ||
                 weapon->get<ESM::Weapon>()->mBase->mData.mType == ESM::Weapon::BluntTwoWide ||
@@ -337,13 +337,13 @@ namespace MWDialogue
 
         // check the available services of this actor
         int services = 0;
-        if (mActor.getTypeName() == typeid(ESM::NPC).name())
+        if (mActor.is<ESM::NPC>())
         {
             MWWorld::LiveCellRef<ESM::NPC>* ref = mActor.get<ESM::NPC>();
             if (ref->mBase->mHasAI)
                 services = ref->mBase->mAiData.mServices;
         }
-        else if (mActor.getTypeName() == typeid(ESM::Creature).name())
+        else if (mActor.is<ESM::Creature>())
         {
             MWWorld::LiveCellRef<ESM::Creature>* ref = mActor.get<ESM::Creature>();
             if (ref->mBase->mHasAI)
@@ -365,7 +365,7 @@ namespace MWDialogue
             || services & ESM::NPC::Misc)
             windowServices |= MWGui::DialogueWindow::Service_Trade;
 
-        if(mActor.getTypeName() == typeid(ESM::NPC).name() && !mActor.get<ESM::NPC>()->mBase->mTransport.empty())
+        if(mActor.is<ESM::NPC>() && !mActor.get<ESM::NPC>()->mBase->mTransport.empty())
             windowServices |= MWGui::DialogueWindow::Service_Travel;
 
         if (services & ESM::NPC::Spells)
@@ -20,7 +20,7 @@
 
 bool MWDialogue::Filter::testActor (const ESM::DialInfo& info) const
 {
-    bool isCreature = (mActor.getTypeName() != typeid (ESM::NPC).name());
+    bool isCreature = !mActor.is<ESM::NPC>();
 
     // actor id
     if (!info.mActor.empty())
@@ -129,7 +129,7 @@ bool MWDialogue::Filter::testSelectStructs (const ESM::DialInfo& info) const
 
 bool MWDialogue::Filter::testDisposition (const ESM::DialInfo& info, bool invert) const
 {
-    bool isCreature = (mActor.getTypeName() != typeid (ESM::NPC).name());
+    bool isCreature = !mActor.is<ESM::NPC>();
 
     if (isCreature)
         return true;
@@ -143,7 +143,7 @@ bool MWDialogue::Filter::testDisposition (const ESM::DialInfo& info, bool invert
 
 bool MWDialogue::Filter::testSelectStruct (const SelectWrapper& select) const
 {
-    if (select.isNpcOnly() && (mActor.getTypeName() != typeid (ESM::NPC).name()))
+    if (select.isNpcOnly() && !mActor.is<ESM::NPC>())
         // If the actor is a creature, we do not test the conditions applicable
         // only to NPCs. Such conditions can never be satisfied, apart
         // inverted ones (NotClass, NotRace, NotFaction return true
@@ -43,6 +43,7 @@ namespace MWDialogue
                 = mTopics.insert (std::make_pair (id, Topic (id)));
 
             iter = result.first;
+            ++mGeneration;
         }
 
         return iter->second;
@@ -65,7 +66,7 @@ namespace MWDialogue
         return false;
     }
 
-    Journal::Journal()
+    Journal::Journal() : mGeneration (0)
     {}
 
     void Journal::clear()
@@ -73,19 +74,16 @@ namespace MWDialogue
         mJournal.clear();
         mQuests.clear();
         mTopics.clear();
+        ++mGeneration;
     }
 
     void Journal::addEntry (const std::string& id, int index)
     {
-        // bail out of we already have heard this...
-        std::string infoId = JournalEntry::idFromIndex (id, index);
-        for (TEntryIter i = mJournal.begin (); i != mJournal.end (); ++i)
-            if (i->mTopic == id && i->mInfoId == infoId)
-                return;
-
         StampedJournalEntry entry = StampedJournalEntry::makeFromQuest (id, index);
 
-        mJournal.push_back (entry);
+        // bail out of we already have heard this...
+        if (!mJournal.addEntry (entry))
+            return;
 
         Quest& quest = getQuest (id);
 
@@ -132,6 +130,11 @@ namespace MWDialogue
         return mJournal.end();
     }
 
+    const Journal::TEntryIndexContainer& Journal::getQuestEntries (const std::string& id) const
+    {
+        return mJournal.getQuestEntries (id);
+    }
+
     Journal::TQuestIter Journal::questBegin() const
     {
         return mQuests.begin();
@@ -152,6 +155,11 @@ namespace MWDialogue
         return mTopics.end();
     }
 
+    int Journal::getGeneration() const
+    {
+        return mGeneration;
+    }
+
     int Journal::countSavedGameRecords() const
     {
         int count = static_cast<int> (mQuests.size());
@@ -235,7 +243,7 @@ namespace MWDialogue
 
                     case ESM::JournalEntry::Type_Journal:
 
-                        mJournal.push_back (record);
+                        mJournal.insertEntry (record);
                         break;
 
                     case ESM::JournalEntry::Type_Topic:
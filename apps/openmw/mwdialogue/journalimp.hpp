@@ -5,15 +5,17 @@
 
 #include "journalentry.hpp"
 #include "quest.hpp"
+#include "mainjournal.hpp"
 
 namespace MWDialogue
 {
     /// \brief The player's journal
     class Journal : public MWBase::Journal
     {
-            TEntryContainer mJournal;
+            MainJournal mJournal;
             TQuestContainer mQuests;
             TTopicContainer mTopics;
+            int mGeneration;
 
         private:
 
@@ -48,6 +50,10 @@ namespace MWDialogue
             virtual TEntryIter end() const;
             ///< Iterator pointing past the end of the main journal.
 
+            virtual const TEntryIndexContainer& getQuestEntries (const std::string& id) const;
+            ///< Positions (relative to begin()) of the main journal entries for quest \a id, in
+            /// journal order.
+
             virtual TQuestIter questBegin() const;
             ///< Iterator pointing to the first quest (sorted by topic ID)
 
@@ -62,6 +68,10 @@ namespace MWDialogue
             virtual TTopicIter topicEnd() const;
             ///< Iterator pointing past the last topic.
 
+            virtual int getGeneration() const;
+            ///< Changes whenever the journal is cleared or a new topic is added. Adding entries to
+            /// the main journal or to existing topics does not change it.
+
             virtual int countSavedGameRecords() const;
 
             virtual void write (ESM::ESMWriter& writer) const;
@@ -0,0 +1,50 @@
+#include "mainjournal.hpp"
+
+#include <components/esm/journalentry.hpp>
+
+namespace MWDialogue
+{
+    bool MainJournal::addEntry (const StampedJournalEntry& entry)
+    {
+        TEntryIndexContainer& entries = mQuestEntries[entry.mTopic];
+
+        for (TEntryIndexContainer::const_iterator iter (entries.begin()); iter!=entries.end(); ++iter)
+            if (mEntries[*iter].mInfoId==entry.mInfoId)
+                return false;
+
+        entries.push_back (mEntries.size());
+        mEntries.push_back (entry);
+        return true;
+    }
+
+    void MainJournal::insertEntry (const ESM::JournalEntry& record)
+    {
+        mQuestEntries[record.mTopic].push_back (mEntries.size());
+        mEntries.push_back (record);
+    }
+
+    void MainJournal::clear()
+    {
+        mEntries.clear();
+        mQuestEntries.clear();
+    }
+
+    MainJournal::TEntryIter MainJournal::begin() const
+    {
+        return mEntries.begin();
+    }
+
+    MainJournal::TEntryIter MainJournal::end() const
+    {
+        return mEntries.end();
+    }
+
+    const MainJournal::TEntryIndexContainer& MainJournal::getQuestEntries (const std::string& id) const
+    {
+        static const TEntryIndexContainer empty;
+
+        std::map<std::string, TEntryIndexContainer>::const_iterator iter = mQuestEntries.find (id);
+
+        return iter!=mQuestEntries.end() ? iter->second : empty;
+    }
+}
@@ -0,0 +1,43 @@
+#ifndef GAME_MWDIALOG_MAINJOURNAL_H
+#define GAME_MWDIALOG_MAINJOURNAL_H
+
+#include "../mwbase/journal.hpp"
+
+namespace MWDialogue
+{
+    /// \brief Entries of the main journal, indexed by quest
+    class MainJournal
+    {
+        public:
+
+            typedef MWBase::Journal::TEntryContainer TEntryContainer;
+            typedef MWBase::Journal::TEntryIter TEntryIter;
+            typedef MWBase::Journal::TEntryIndexContainer TEntryIndexContainer;
+
+        private:
+
+            TEntryContainer mEntries;
+            std::map<std::string, TEntryIndexContainer> mQuestEntries;
+
+        public:
+
+            bool addEntry (const StampedJournalEntry& entry);
+            ///< Append \a entry, unless there already is an entry for the same quest and info ID.
+            ///
+            /// \return Was \a entry added?
+
+            void insertEntry (const ESM::JournalEntry& record);
+            ///< Append an entry loaded from a saved game (without checking for redundant entries).
+
+            void clear();
+
+            TEntryIter begin() const;
+
+            TEntryIter end() const;
+
+            const TEntryIndexContainer& getQuestEntries (const std::string& id) const;
+            ///< Positions (relative to begin()) of the entries for quest \a id, in journal order.
+    };
+}
+
+#endif
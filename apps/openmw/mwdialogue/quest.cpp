@@ -91,9 +91,8 @@ namespace MWDialogue
         if (index > mIndex)
             setIndex (index);
 
-        for (TEntryIter iter (mEntries.begin()); iter!=mEntries.end(); ++iter)
-            if (iter->mInfoId==entry.mInfoId)
-                return;
+        if (!mInfoIds.insert (entry.mInfoId).second)
+            return;
 
         mEntries.push_back (entry); // we want slicing here
     }
@@ -1,6 +1,8 @@
 
 #include "topic.hpp"
 
+#include <components/esm/journalentry.hpp>
+
 #include "../mwbase/environment.hpp"
 #include "../mwbase/world.hpp"
 
@@ -25,20 +27,23 @@ namespace MWDialogue
             throw std::runtime_error ("topic does not match: " + mTopic);
 
         // bail out if we already have heard this
-        for (Topic::TEntryIter it = mEntries.begin(); it != mEntries.end(); ++it)
-        {
-            if (it->mInfoId == entry.mInfoId)
-                return;
-        }
+        if (!mInfoIds.insert (entry.mInfoId).second)
+            return;
 
         mEntries.push_back (entry); // we want slicing here
     }
 
     void Topic::insertEntry (const ESM::JournalEntry& entry)
     {
+        mInfoIds.insert (entry.mInfo);
         mEntries.push_back (entry);
     }
 
+    bool Topic::hasEntry (const std::string& infoId) const
+    {
+        return mInfoIds.find (infoId)!=mInfoIds.end();
+    }
+
     std::string Topic::getTopic() const
     {
         return mTopic;
@@ -1,6 +1,7 @@
 #ifndef GAME_MWDIALOG_TOPIC_H
 #define GAME_MWDIALOG_TOPIC_H
 
+#include <set>
 #include <string>
 #include <vector>
 
@@ -26,6 +27,7 @@ namespace MWDialogue
             std::string mTopic;
             std::string mName;
             TEntryContainer mEntries;
+            std::set<std::string> mInfoIds; // info IDs of all entries in mEntries
 
         public:
 
@@ -44,6 +46,8 @@ namespace MWDialogue
             ///< Add entry without checking for redundant entries or modifying the state of the
             /// topic otherwise
 
+            bool hasEntry (const std::string& infoId) const;
+
             std::string getTopic() const;
 
             virtual std::string getName() const;
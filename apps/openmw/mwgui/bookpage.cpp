@@ -6,6 +6,8 @@
 #include "MyGUI_TextureUtility.h"
 #include "MyGUI_FactoryManager.h"
 
+#include <algorithm>
+#include <map>
 #include <stdint.h>
 #include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
@@ -124,13 +126,28 @@ struct TypesetBookImpl : TypesetBook
         return std::make_pair (mRect.width (), mRect.height ());
     }
 
+    struct SectionBottomLess
+    {
+        bool operator () (Section const & section, int top) const
+        {
+            return section.mRect.bottom <= top;
+        }
+    };
+
+    /// Returns the first section that extends below \a top. Sections are stacked
+    /// vertically in the order they were written, so this is a binary search.
+    Sections::const_iterator firstSectionBelow (int top) const
+    {
+        return std::lower_bound (mSections.begin (), mSections.end (), top, SectionBottomLess ());
+    }
+
     template <typename Visitor>
     void visitRuns (int top, int bottom, MyGUI::IFont* Font, Visitor const & visitor) const
     {
-        for (Sections::const_iterator i = mSections.begin (); i != mSections.end (); ++i)
+        for (Sections::const_iterator i = firstSectionBelow (top); i != mSections.end (); ++i)
         {
-            if (top >= mRect.bottom || bottom <= i->mRect.top)
-                continue;
+            if (bottom <= i->mRect.top)
+                break;
 
             for (Lines::const_iterator j = i->mLines.begin (); j != i->mLines.end (); ++j)
             {
@@ -152,10 +169,10 @@ struct TypesetBookImpl : TypesetBook
 
     StyleImpl * hitTest (int left, int top) const
     {
-        for (Sections::const_iterator i = mSections.begin (); i != mSections.end (); ++i)
+        for (Sections::const_iterator i = firstSectionBelow (top); i != mSections.end (); ++i)
         {
-            if (top < i->mRect.top || top >= i->mRect.bottom)
-                continue;
+            if (top < i->mRect.top)
+                break;
 
             int left1 = left - i->mRect.left;
 
@@ -195,6 +212,38 @@ struct TypesetBookImpl::Typesetter : BookTypesetter
     typedef TypesetBookImpl Book;
     typedef boost::shared_ptr <Book> BookPtr;
 
+    /// Glyph widths of a single font; the widths of the first 256 code points
+    /// are kept in a table so that measuring text does not need a glyph lookup
+    /// for every character.
+    struct GlyphWidths
+    {
+        MyGUI::IFont* mFont;
+        std::vector <int> mTable; // -1: not looked up yet
+
+        GlyphWidths (MyGUI::IFont* font = NULL) : mFont (font), mTable (256, -1) {}
+
+        int lookup (int codePoint) const
+        {
+            MyGUI::GlyphInfo* gi = mFont->getGlyphInfo (codePoint);
+            return gi ? int (gi->advance + gi->bearingX) : 0;
+        }
+
+        int operator () (int codePoint)
+        {
+            if (codePoint < 0 || codePoint >= int (mTable.size ()))
+                return lookup (codePoint);
+
+            int & width = mTable [codePoint];
+
+            if (width < 0)
+                width = lookup (codePoint);
+
+            return width;
+        }
+    };
+
+    typedef std::map <MyGUI::IFont*, GlyphWidths> GlyphWidthCache;
+
     int mPageWidth;
     int mPageHeight;
 
@@ -208,6 +257,8 @@ struct TypesetBookImpl::Typesetter : BookTypesetter
     Book::Content const * mCurrentContent;
     Alignment mCurrentAlignment;
 
+    GlyphWidthCache mGlyphWidths;
+
     Typesetter (size_t width, size_t height) :
         mPageWidth (width), mPageHeight(height),
         mSection (NULL), mLine (NULL), mRun (NULL),
@@ -325,6 +376,8 @@ struct TypesetBookImpl::Typesetter : BookTypesetter
 
     TypesetBook::Ptr complete ()
     {
+        mBook->mPages.clear ();
+
         int curPageStart = 0;
         int curPageStop  = 0;
 
@@ -387,6 +440,13 @@ struct TypesetBookImpl::Typesetter : BookTypesetter
     {
         int line_height = style->mFont->getDefaultHeight ();
 
+        GlyphWidthCache::iterator widths = mGlyphWidths.find (style->mFont);
+
+        if (widths == mGlyphWidths.end ())
+            widths = mGlyphWidths.insert (std::make_pair (style->mFont, GlyphWidths (style->mFont))).first;
+
+        GlyphWidths & glyphWidth = widths->second;
+
         Utf8Stream stream (_begin, _end);
 
         while (!stream.eof ())
@@ -407,9 +467,7 @@ struct TypesetBookImpl::Typesetter : BookTypesetter
 
             while (!stream.eof () && !ucsLineBreak (stream.peek ()) && ucsBreakingSpace (stream.peek ()))
             {
-                MyGUI::GlyphInfo* gi = style->mFont->getGlyphInfo (stream.peek ());
-                if (gi)
-                    space_width += gi->advance + gi->bearingX;
+                space_width += glyphWidth (stream.peek ());
                 stream.consume ();
             }
 
@@ -417,9 +475,7 @@ struct TypesetBookImpl::Typesetter : BookTypesetter
 
             while (!stream.eof () && !ucsLineBreak (stream.peek ()) && !ucsBreakingSpace (stream.peek ()))
             {
-                MyGUI::GlyphInfo* gi = style->mFont->getGlyphInfo (stream.peek ());
-                if (gi)
-                    word_width += gi->advance + gi->bearingX;
+                word_width += glyphWidth (stream.peek ());
                 word_height = line_height;
                 ++character_count;
                 stream.consume ();
@@ -971,7 +1027,24 @@ public:
 
     void createActiveFormats (boost::shared_ptr <TypesetBookImpl> newBook)
     {
-        newBook->visitRuns (0, 0x7FFFFFFF, CreateActiveFormat (this));
+        // only one page is shown at a time, so the vertex buffers need to hold
+        // the largest page rather than the whole book
+        std::map <MyGUI::IFont*, int> pageVertices;
+
+        for (TypesetBookImpl::Pages::const_iterator i = newBook->mPages.begin (); i != newBook->mPages.end (); ++i)
+        {
+            newBook->visitRuns (i->first, i->second, CreateActiveFormat (this));
+
+            for (ActiveTextFormats::iterator j = mActiveTextFormats.begin (); j != mActiveTextFormats.end (); ++j)
+            {
+                int & count = pageVertices [j->first];
+                count = (std::max) (count, j->second->mCountVertex);
+                j->second->mCountVertex = 0;
+            }
+        }
+
+        for (ActiveTextFormats::iterator i = mActiveTextFormats.begin (); i != mActiveTextFormats.end (); ++i)
+            i->second->mCountVertex = pageVertices [i->first];
 
         if (mNode != NULL)
             for (ActiveTextFormats::iterator i = mActiveTextFormats.begin (); i != mActiveTextFormats.end (); ++i)
@@ -91,7 +91,10 @@ namespace MWGui
         /// using the specified style.
         virtual void write (Style * Style, size_t Begin, size_t End) = 0;
 
-        /// Finalize the document layout, and return a pointer to it.
+        /// Finalize the document layout, and return a pointer to it. More text
+        /// may be added afterwards, followed by another call to complete, which
+        /// paginates the extended document and returns the same book. A book
+        /// must not be shown while it is being extended.
         virtual TypesetBook::Ptr complete () = 0;
     };
 
@@ -108,7 +108,7 @@ void CompanionWindow::updateEncumbranceBar()
     float encumbrance = MWWorld::Class::get(mPtr).getEncumbrance(mPtr);
     mEncumbranceBar->setValue(encumbrance, capacity);
 
-    if (mPtr.getTypeName() != typeid(ESM::NPC).name())
+    if (!mPtr.is<ESM::NPC>())
         mProfitLabel->setCaption("");
     else
     {
@@ -119,7 +119,7 @@ void CompanionWindow::updateEncumbranceBar()
 
 void CompanionWindow::onCloseButtonClicked(MyGUI::Widget* _sender)
 {
-    if (mPtr.getTypeName() == typeid(ESM::NPC).name() && MWWorld::Class::get(mPtr).getNpcStats(mPtr).getProfit() < 0)
+    if (mPtr.is<ESM::NPC>() && MWWorld::Class::get(mPtr).getNpcStats(mPtr).getProfit() < 0)
     {
         std::vector<std::string> buttons;
         buttons.push_back("#{sCompanionWarningButtonOne}");
@@ -185,7 +185,7 @@ namespace MWGui
 
     void ContainerWindow::dropItem()
     {
-        if (mPtr.getTypeName() == typeid(ESM::Container).name())
+        if (mPtr.is<ESM::Container>())
         {
             // check that we don't exceed container capacity
             MWWorld::Ptr item = mDragAndDrop->mItem.mBase;
@@ -220,7 +220,7 @@ namespace MWGui
         mPickpocketDetected = false;
         mPtr = container;
 
-        if (mPtr.getTypeName() == typeid(ESM::NPC).name() && !loot)
+        if (mPtr.is<ESM::NPC>() && !loot)
         {
             // we are stealing stuff
             MWWorld::Ptr player = MWBase::Environment::get().getWorld()->getPlayerPtr();
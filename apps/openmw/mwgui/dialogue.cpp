@@ -407,12 +407,12 @@ namespace MWGui
         bool isCompanion = !MWWorld::Class::get(mPtr).getScript(mPtr).empty()
                 && mPtr.getRefData().getLocals().getIntVar(MWWorld::Class::get(mPtr).getScript(mPtr), "companion");
 
-        bool anyService = mServices > 0 || isCompanion || mPtr.getTypeName() == typeid(ESM::NPC).name();
+        bool anyService = mServices > 0 || isCompanion || mPtr.is<ESM::NPC>();
 
         const MWWorld::Store<ESM::GameSetting> &gmst =
             MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
 
-        if (mPtr.getTypeName() == typeid(ESM::NPC).name())
+        if (mPtr.is<ESM::NPC>())
             mTopicsList->addItem(gmst.find("sPersuasion")->getString());
 
         if (mServices & Service_Trade)
@@ -580,7 +580,7 @@ namespace MWGui
         //Clear the list of topics
         mTopicsList->clear();
 
-        if (mPtr.getTypeName() == typeid(ESM::NPC).name())
+        if (mPtr.is<ESM::NPC>())
         {
             mDispositionBar->setProgressRange(100);
             mDispositionBar->setProgressPosition(MWBase::Environment::get().getMechanicsManager()->getDerivedDisposition(mPtr));
@@ -605,7 +605,7 @@ namespace MWGui
 
     void DialogueWindow::onFrame()
     {
-        if(mMainWidget->getVisible() && mEnabled && mPtr.getTypeName() == typeid(ESM::NPC).name())
+        if(mMainWidget->getVisible() && mEnabled && mPtr.is<ESM::NPC>())
         {
             int disp = std::max(0, std::min(100,
                 MWBase::Environment::get().getMechanicsManager()->getDerivedDisposition(mPtr)
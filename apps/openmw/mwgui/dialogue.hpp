@@ -1,6 +1,8 @@
 #ifndef MWGUI_DIALOGE_H
 #define MWGUI_DIALOGE_H
 
+#include <list>
+
 #include "windowbase.hpp"
 #include "referenceinterface.hpp"
 
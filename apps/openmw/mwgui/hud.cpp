@@ -358,9 +358,9 @@ namespace MWGui
     {
         mCellNameTimer -= dt;
         mWeaponSpellTimer -= dt;
-        if (mCellNameTimer < 0)
+        if (mCellNameTimer < 0 && mCellNameBox->getVisible())
             mCellNameBox->setVisible(false);
-        if (mWeaponSpellTimer < 0)
+        if (mWeaponSpellTimer < 0 && mWeaponSpellBox->getVisible())
             mWeaponSpellBox->setVisible(false);
 
         mEnemyHealthTimer -= dt;
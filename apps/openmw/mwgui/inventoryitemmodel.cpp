@@ -1,5 +1,7 @@
 #include "inventoryitemmodel.hpp"
 
+#include <algorithm>
+
 #include "../mwworld/containerstore.hpp"
 #include "../mwworld/class.hpp"
 #include "../mwworld/inventorystore.hpp"
@@ -9,6 +11,7 @@ namespace MWGui
 
 InventoryItemModel::InventoryItemModel(const MWWorld::Ptr &actor)
     : mActor(actor)
+    , mSerial(0)
 {
 }
 
@@ -57,11 +60,26 @@ void InventoryItemModel::removeItem (const ItemStack& item, size_t count)
         throw std::runtime_error("Not enough items in the stack to remove");
 }
 
-void InventoryItemModel::update()
+void InventoryItemModel::getEquipped (std::vector<MWWorld::Ptr>& equipped)
+{
+    if (!mActor.getClass().hasInventoryStore(mActor))
+        return;
+
+    MWWorld::InventoryStore& store = mActor.getClass().getInventoryStore(mActor);
+    for (int slot=0; slot<MWWorld::InventoryStore::Slots; ++slot)
+    {
+        MWWorld::ContainerStoreIterator equippedItem = store.getSlot(slot);
+        if (equippedItem != store.end())
+            equipped.push_back(*equippedItem);
+    }
+}
+
+void InventoryItemModel::rebuild()
 {
     MWWorld::ContainerStore& store = MWWorld::Class::get(mActor).getContainerStore(mActor);
 
     mItems.clear();
+    mListed.clear();
 
     for (MWWorld::ContainerStoreIterator it = store.begin(); it != store.end(); ++it)
     {
@@ -74,21 +92,73 @@ void InventoryItemModel::update()
 
         ItemStack newItem (item, this, item.getRefData().getCount());
 
-        if (mActor.getClass().hasInventoryStore(mActor))
+        if (std::find(mEquipped.begin(), mEquipped.end(), newItem.mBase) != mEquipped.end())
+            newItem.mType = ItemStack::Type_Equipped;
+
+        mItems.push_back(newItem);
+        mListed.insert(item);
+    }
+}
+
+void InventoryItemModel::update()
+{
+    MWWorld::ContainerStore& store = MWWorld::Class::get(mActor).getContainerStore(mActor);
+
+    std::vector<MWWorld::Ptr> equipped;
+    getEquipped(equipped);
+    bool equipmentChanged = equipped != mEquipped;
+    mEquipped.swap(equipped);
+
+    std::vector<MWWorld::Ptr> changed;
+    if (!store.getChanges(mSerial, changed))
+    {
+        rebuild();
+        return;
+    }
+
+    // Catch up with the stacks that changed since the last update. Counts are refreshed for all
+    // items, since some code changes them directly via RefData::setCount.
+    std::vector<ItemStack> items;
+    items.reserve(mItems.size() + changed.size());
+
+    for (std::vector<ItemStack>::const_iterator it = mItems.begin(); it != mItems.end(); ++it)
+    {
+        int count = it->mBase.getRefData().getCount();
+        if (count <= 0)
         {
-            MWWorld::InventoryStore& store = mActor.getClass().getInventoryStore(mActor);
-            for (int slot=0; slot<MWWorld::InventoryStore::Slots; ++slot)
-            {
-                MWWorld::ContainerStoreIterator equipped = store.getSlot(slot);
-                if (equipped == store.end())
-                    continue;
-                if (*equipped == newItem.mBase)
-                    newItem.mType = ItemStack::Type_Equipped;
-            }
+            mListed.erase(it->mBase);
+            continue;
         }
 
-        mItems.push_back(newItem);
+        items.push_back(*it);
+        items.back().mCount = count;
+
+        if (equipmentChanged)
+            items.back().mType =
+                std::find(mEquipped.begin(), mEquipped.end(), it->mBase) != mEquipped.end() ?
+                ItemStack::Type_Equipped : ItemStack::Type_Normal;
     }
+
+    for (std::vector<MWWorld::Ptr>::const_iterator it = changed.begin(); it != changed.end(); ++it)
+    {
+        const MWWorld::Ptr& item = *it;
+
+        if (item.getRefData().getCount() <= 0 || item.getCellRef().mRefID == "werewolfrobe")
+            continue;
+
+        // also skips stacks that have been logged more than once
+        if (!mListed.insert(item).second)
+            continue;
+
+        ItemStack newItem (item, this, item.getRefData().getCount());
+
+        if (std::find(mEquipped.begin(), mEquipped.end(), item) != mEquipped.end())
+            newItem.mType = ItemStack::Type_Equipped;
+
+        items.push_back(newItem);
+    }
+
+    mItems.swap(items);
 }
 
 }
@@ -1,6 +1,10 @@
 #ifndef MWGUI_INVENTORY_ITEM_MODEL_H
 #define MWGUI_INVENTORY_ITEM_MODEL_H
 
+#include <set>
+
+#include "../mwworld/containerchangelog.hpp"
+
 #include "itemmodel.hpp"
 
 namespace MWGui
@@ -23,7 +27,16 @@ namespace MWGui
     protected:
         MWWorld::Ptr mActor;
     private:
+        void rebuild();
+        ///< recreate mItems from scratch
+
+        void getEquipped (std::vector<MWWorld::Ptr>& equipped);
+
         std::vector<ItemStack> mItems;
+        std::set<MWWorld::Ptr> mListed; ///< stacks in mItems
+
+        std::vector<MWWorld::Ptr> mEquipped; ///< equipped items at the last update
+        MWWorld::ContainerChangeLog::Serial mSerial; ///< last change of the container store seen by this model
     };
 
 }
@@ -515,19 +515,19 @@ namespace MWGui
     void InventoryWindow::pickUpObject (MWWorld::Ptr object)
     {
         // make sure the object is of a type that can be picked up
-        std::string type = object.getTypeName();
-        if ( (type != typeid(ESM::Apparatus).name())
-            && (type != typeid(ESM::Armor).name())
-            && (type != typeid(ESM::Book).name())
-            && (type != typeid(ESM::Clothing).name())
-            && (type != typeid(ESM::Ingredient).name())
-            && (type != typeid(ESM::Light).name())
-            && (type != typeid(ESM::Miscellaneous).name())
-            && (type != typeid(ESM::Lockpick).name())
-            && (type != typeid(ESM::Probe).name())
-            && (type != typeid(ESM::Repair).name())
-            && (type != typeid(ESM::Weapon).name())
-            && (type != typeid(ESM::Potion).name()))
+        unsigned int type = object.getType();
+        if ( (type != ESM::Apparatus::sRecordId)
+            && (type != ESM::Armor::sRecordId)
+            && (type != ESM::Book::sRecordId)
+            && (type != ESM::Clothing::sRecordId)
+            && (type != ESM::Ingredient::sRecordId)
+            && (type != ESM::Light::sRecordId)
+            && (type != ESM::Miscellaneous::sRecordId)
+            && (type != ESM::Lockpick::sRecordId)
+            && (type != ESM::Probe::sRecordId)
+            && (type != ESM::Repair::sRecordId)
+            && (type != ESM::Weapon::sRecordId)
+            && (type != ESM::Potion::sRecordId))
             return;
 
         if (MWWorld::Class::get(object).getName(object) == "") // objects without name presented to user can never be picked up
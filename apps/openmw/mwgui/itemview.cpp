@@ -33,6 +33,7 @@ namespace MWGui
 ItemView::ItemView()
     : mModel(NULL)
     , mScrollView(NULL)
+    , mDragArea(NULL)
 {
 }
 
@@ -43,6 +44,9 @@ ItemView::~ItemView()
 
 void ItemView::setModel(ItemModel *model)
 {
+    // the item widgets refer to the old model
+    destroyItemWidgets();
+
     delete mModel;
     mModel = model;
     update();
@@ -59,13 +63,54 @@ void ItemView::initialiseOverride()
     mScrollView->setCanvasAlign(MyGUI::Align::Left | MyGUI::Align::Top);
 }
 
-void ItemView::update()
+void ItemView::destroyItemWidgets()
 {
-    while (mScrollView->getChildCount())
-        MyGUI::Gui::getInstance().destroyWidget(mScrollView->getChildAt(0));
+    for (std::vector<ItemWidgets>::iterator it = mItemWidgets.begin(); it != mItemWidgets.end(); ++it)
+        MyGUI::Gui::getInstance().destroyWidget(it->mBackground);
 
+    mItemWidgets.clear();
+}
+
+ItemView::ItemWidgets ItemView::createItemWidgets(ItemModel::ModelIndex index)
+{
+    ItemWidgets widgets;
+
+    // background widget (for the "equipped" frame and magic item background image)
+    widgets.mBackground = mDragArea->createWidget<MyGUI::ImageBox>("ImageBox",
+        MyGUI::IntCoord(0, 0, 42, 42), MyGUI::Align::Default);
+    widgets.mBackground->setUserString("ToolTipType", "ItemModelIndex");
+    widgets.mBackground->setUserData(std::make_pair(index, mModel));
+    widgets.mBackground->setProperty("ImageCoord", "0 0 42 42");
+    widgets.mBackground->eventMouseButtonClick += MyGUI::newDelegate(this, &ItemView::onSelectedItem);
+    widgets.mBackground->eventMouseWheel += MyGUI::newDelegate(this, &ItemView::onMouseWheel);
+
+    // image
+    widgets.mImage = widgets.mBackground->createWidget<MyGUI::ImageBox>("ImageBox",
+        MyGUI::IntCoord(5, 5, 32, 32), MyGUI::Align::Default);
+    widgets.mImage->setNeedMouseFocus(false);
+
+    // text widget that shows item count
+    widgets.mCount = widgets.mImage->createWidget<MyGUI::TextBox>("SandBrightText",
+        MyGUI::IntCoord(0, 14, 32, 18), MyGUI::Align::Default, std::string("Label"));
+    widgets.mCount->setTextAlign(MyGUI::Align::Right);
+    widgets.mCount->setNeedMouseFocus(false);
+    widgets.mCount->setTextShadow(true);
+    widgets.mCount->setTextShadowColour(MyGUI::Colour(0,0,0));
+
+    return widgets;
+}
+
+void ItemView::update()
+{
     if (!mModel)
+    {
+        while (mScrollView->getChildCount())
+            MyGUI::Gui::getInstance().destroyWidget(mScrollView->getChildAt(0));
+
+        mDragArea = NULL;
+        mItemWidgets.clear();
         return;
+    }
 
     int x = 0;
     int y = 0;
@@ -73,26 +118,36 @@ void ItemView::update()
 
     mModel->update();
 
-    MyGUI::Widget* dragArea = mScrollView->createWidget<MyGUI::Widget>("",0,0,mScrollView->getWidth(),mScrollView->getHeight(),
-                                                                       MyGUI::Align::Stretch);
-    dragArea->setNeedMouseFocus(true);
-    dragArea->eventMouseButtonClick += MyGUI::newDelegate(this, &ItemView::onSelectedBackground);
-    dragArea->eventMouseWheel += MyGUI::newDelegate(this, &ItemView::onMouseWheel);
+    if (!mDragArea)
+    {
+        mDragArea = mScrollView->createWidget<MyGUI::Widget>("",0,0,mScrollView->getWidth(),mScrollView->getHeight(),
+                                                             MyGUI::Align::Stretch);
+        mDragArea->setNeedMouseFocus(true);
+        mDragArea->eventMouseButtonClick += MyGUI::newDelegate(this, &ItemView::onSelectedBackground);
+        mDragArea->eventMouseWheel += MyGUI::newDelegate(this, &ItemView::onMouseWheel);
+    }
+
+    // widgets are reused by position; only the ones that are not needed anymore are destroyed
+    size_t count = mModel->getItemCount();
+
+    while (mItemWidgets.size() > count)
+    {
+        MyGUI::Gui::getInstance().destroyWidget(mItemWidgets.back().mBackground);
+        mItemWidgets.pop_back();
+    }
 
-    for (ItemModel::ModelIndex i=0; i<static_cast<int>(mModel->getItemCount()); ++i)
+    for (ItemModel::ModelIndex i=0; i<static_cast<int>(count); ++i)
     {
         const ItemStack& item = mModel->getItem(i);
 
-        /// \todo performance improvement: don't create/destroy all the widgets everytime the container window changes size, only reposition them
-        std::string path = std::string("icons\\");
-        path += MWWorld::Class::get(item.mBase).getInventoryIcon(item.mBase);
+        if (static_cast<size_t>(i) >= mItemWidgets.size())
+            mItemWidgets.push_back(createItemWidgets(i));
+
+        ItemWidgets& widgets = mItemWidgets[i];
+
+        widgets.mBackground->setPosition(x, y);
 
-        // background widget (for the "equipped" frame and magic item background image)
         bool isMagic = (item.mFlags & ItemStack::Flag_Enchanted);
-        MyGUI::ImageBox* backgroundWidget = dragArea->createWidget<MyGUI::ImageBox>("ImageBox",
-            MyGUI::IntCoord(x, y, 42, 42), MyGUI::Align::Default);
-        backgroundWidget->setUserString("ToolTipType", "ItemModelIndex");
-        backgroundWidget->setUserData(std::make_pair(i, mModel));
 
         std::string backgroundTex = "textures\\menu_icon";
         if (isMagic)
@@ -110,32 +165,36 @@ void ItemView::update()
         if (backgroundTex != "")
             backgroundTex += ".dds";
 
-        backgroundWidget->setImageTexture(backgroundTex);
-        if ((item.mType == ItemStack::Type_Barter) && !isMagic)
-            backgroundWidget->setProperty("ImageCoord", "2 2 42 42");
-        else
-            backgroundWidget->setProperty("ImageCoord", "0 0 42 42");
-        backgroundWidget->eventMouseButtonClick += MyGUI::newDelegate(this, &ItemView::onSelectedItem);
-        backgroundWidget->eventMouseWheel += MyGUI::newDelegate(this, &ItemView::onMouseWheel);
+        if (backgroundTex != widgets.mBackgroundTexture)
+        {
+            widgets.mBackground->setImageTexture(backgroundTex);
+            if ((item.mType == ItemStack::Type_Barter) && !isMagic)
+                widgets.mBackground->setProperty("ImageCoord", "2 2 42 42");
+            else
+                widgets.mBackground->setProperty("ImageCoord", "0 0 42 42");
+            widgets.mBackgroundTexture = backgroundTex;
+        }
 
-        // image
-        MyGUI::ImageBox* image = backgroundWidget->createWidget<MyGUI::ImageBox>("ImageBox",
-            MyGUI::IntCoord(5, 5, 32, 32), MyGUI::Align::Default);
+        std::string path = std::string("icons\\");
+        path += MWWorld::Class::get(item.mBase).getInventoryIcon(item.mBase);
         std::string::size_type pos = path.rfind(".");
         if(pos != std::string::npos)
             path.erase(pos);
         path.append(".dds");
-        image->setImageTexture(path);
-        image->setNeedMouseFocus(false);
-
-        // text widget that shows item count
-        MyGUI::TextBox* text = image->createWidget<MyGUI::TextBox>("SandBrightText",
-            MyGUI::IntCoord(0, 14, 32, 18), MyGUI::Align::Default, std::string("Label"));
-        text->setTextAlign(MyGUI::Align::Right);
-        text->setNeedMouseFocus(false);
-        text->setTextShadow(true);
-        text->setTextShadowColour(MyGUI::Colour(0,0,0));
-        text->setCaption(getCountString(item.mCount));
+
+        if (path != widgets.mIcon)
+        {
+            widgets.mImage->setImageTexture(path);
+            widgets.mIcon = path;
+        }
+
+        std::string countText = getCountString(item.mCount);
+
+        if (countText != widgets.mCountText)
+        {
+            widgets.mCount->setCaption(countText);
+            widgets.mCountText = countText;
+        }
 
         y += 42;
         if (y > maxHeight)
@@ -148,7 +207,7 @@ void ItemView::update()
     x += 42;
     MyGUI::IntSize size = MyGUI::IntSize(std::max(mScrollView->getSize().width, x), mScrollView->getSize().height);
     mScrollView->setCanvasSize(size);
-    dragArea->setSize(size);
+    mDragArea->setSize(size);
 }
 
 void ItemView::onSelectedItem(MyGUI::Widget *sender)
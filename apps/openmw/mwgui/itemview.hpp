@@ -3,6 +3,8 @@
 
 #include <MyGUI_Widget.h>
 
+#include <vector>
+
 #include "itemmodel.hpp"
 
 namespace MWGui
@@ -42,8 +44,27 @@ namespace MWGui
         void onSelectedBackground (MyGUI::Widget* sender);
         void onMouseWheel(MyGUI::Widget* _sender, int _rel);
 
+        /// Widgets for one item slot, reused as long as the slot exists
+        struct ItemWidgets
+        {
+            MyGUI::ImageBox* mBackground;
+            MyGUI::ImageBox* mImage;
+            MyGUI::TextBox* mCount;
+
+            // what is currently shown, to skip redundant updates
+            std::string mBackgroundTexture;
+            std::string mIcon;
+            std::string mCountText;
+        };
+
+        ItemWidgets createItemWidgets (ItemModel::ModelIndex index);
+
+        void destroyItemWidgets();
+
         ItemModel* mModel;
         MyGUI::ScrollView* mScrollView;
+        MyGUI::Widget* mDragArea;
+        std::vector<ItemWidgets> mItemWidgets;
 
     };
 
@@ -1,5 +1,7 @@
 #include "journalbooks.hpp"
 
+#include "MyGUI_FontManager.h"
+
 namespace
 {
     MWGui::BookTypesetter::Utf8Span to_utf8_span (char const * text)
@@ -89,6 +91,26 @@ namespace
         }
     };
 
+    /// Skips the entries that have already been typeset.
+    struct AddNewJournalEntry
+    {
+        size_t mSkip;
+        AddJournalEntry mAddEntry;
+
+        AddNewJournalEntry (size_t skip, AddJournalEntry const & addEntry) :
+            mSkip (skip), mAddEntry (addEntry)
+        {
+        }
+
+        void operator () (MWGui::JournalViewModel::JournalEntry const & entry)
+        {
+            if (mSkip > 0)
+                --mSkip;
+            else
+                mAddEntry (entry);
+        }
+    };
+
     struct AddTopicEntry : AddEntry
     {
         intptr_t mContentId;
@@ -180,6 +202,11 @@ namespace MWGui
 
 typedef TypesetBook::Ptr book;
 
+JournalBooks::JournalCache::JournalCache () :
+    mHeader (NULL), mBody (NULL), mGeneration (0), mEntries (0)
+{
+}
+
 JournalBooks::JournalBooks (JournalViewModel::Ptr model) :
     mModel (model)
 {
@@ -201,14 +228,35 @@ book JournalBooks::createEmptyJournalBook ()
 
 book JournalBooks::createJournalBook ()
 {
-    BookTypesetter::Ptr typesetter = createTypesetter ();
+    JournalCache& cache = mJournalCache;
 
-    BookTypesetter::Style* header = typesetter->createStyle ("", MyGUI::Colour (0.60f, 0.00f, 0.00f));
-    BookTypesetter::Style* body   = typesetter->createStyle ("", MyGUI::Colour::Black);
+    std::string font = MyGUI::FontManager::getInstance().getDefaultFont();
+    int generation = mModel->getJournalGeneration ();
+    size_t entries = mModel->countJournalEntries ();
+
+    // new topics change the highlighting of the old entries, so start over
+    if (!cache.mTypesetter || cache.mFont != font || cache.mGeneration != generation ||
+        cache.mEntries > entries)
+    {
+        cache.mTypesetter = createTypesetter ();
+        cache.mHeader = cache.mTypesetter->createStyle ("", MyGUI::Colour (0.60f, 0.00f, 0.00f));
+        cache.mBody   = cache.mTypesetter->createStyle ("", MyGUI::Colour::Black);
+        cache.mBook.reset ();
+        cache.mFont = font;
+        cache.mGeneration = generation;
+        cache.mEntries = 0;
+    }
+
+    if (!cache.mBook || cache.mEntries != entries)
+    {
+        mModel->visitJournalEntries (0, AddNewJournalEntry (cache.mEntries,
+            AddJournalEntry (cache.mTypesetter, cache.mBody, cache.mHeader, true)));
 
-    mModel->visitJournalEntries (0, AddJournalEntry (typesetter, body, header, true));
+        cache.mEntries = entries;
+        cache.mBook = cache.mTypesetter->complete ();
+    }
 
-    return typesetter->complete ();
+    return cache.mBook;
 }
 
 book JournalBooks::createTopicBook (uintptr_t topicId)
@@ -1,6 +1,8 @@
 #ifndef MWGUI_JOURNALBOOKS_HPP
 #define MWGUI_JOURNALBOOKS_HPP
 
+#include <string>
+
 #include "bookpage.hpp"
 #include "journalviewmodel.hpp"
 
@@ -11,10 +13,29 @@ namespace MWGui
         typedef TypesetBook::Ptr Book;
         JournalViewModel::Ptr mModel;
 
+        /// The main journal book is kept between calls to createJournalBook. As long as entries
+        /// have only been appended to the journal, only the new entries are typeset.
+        struct JournalCache
+        {
+            BookTypesetter::Ptr mTypesetter;
+            BookTypesetter::Style* mHeader;
+            BookTypesetter::Style* mBody;
+            Book mBook;
+            std::string mFont;
+            int mGeneration;
+            size_t mEntries; ///< number of entries typeset so far
+
+            JournalCache ();
+        };
+
+        JournalCache mJournalCache;
+
         JournalBooks (JournalViewModel::Ptr model);
 
         Book createEmptyJournalBook ();
         Book createJournalBook ();
+        ///< \attention The returned book is extended by later calls and must not be shown
+        /// anymore when this function is called again.
         Book createTopicBook (uintptr_t topicId);
         Book createQuestBook (uintptr_t questId);
         Book createTopicIndexBook ();
@@ -81,6 +81,18 @@ struct JournalViewModelImpl : JournalViewModel
         return journal->begin () == journal->end ();
     }
 
+    size_t countJournalEntries () const
+    {
+        MWBase::Journal * journal = MWBase::Environment::get().getJournal();
+
+        return journal->end () - journal->begin ();
+    }
+
+    int getJournalGeneration () const
+    {
+        return MWBase::Environment::get().getJournal()->getGeneration ();
+    }
+
     template <typename t_iterator, typename Interface>
     struct BaseEntry : Interface
     {
@@ -266,13 +278,13 @@ struct JournalViewModelImpl : JournalViewModel
         {
             MWDialogue::Quest const * quest = reinterpret_cast <MWDialogue::Quest const *> (questId);
 
-            for(MWBase::Journal::TEntryIter i = journal->begin(); i != journal->end (); ++i)
+            MWBase::Journal::TEntryIndexContainer const & entries = journal->getQuestEntries (quest->getTopic ());
+
+            for (MWBase::Journal::TEntryIndexContainer::const_iterator i = entries.begin (); i != entries.end (); ++i)
             {
-                for (MWDialogue::Topic::TEntryIter j = quest->begin (); j != quest->end (); ++j)
-                {
-                    if (i->mInfoId == j->mInfoId)
-                        visitor (JournalEntryImpl <MWBase::Journal::TEntryIter> (this, i));
-                }
+                // only list entries that are also recorded in the quest
+                if (quest->hasEntry (journal->begin () [*i].mInfoId))
+                    visitor (JournalEntryImpl <MWBase::Journal::TEntryIter> (this, journal->begin () + *i));
             }
         }
         else
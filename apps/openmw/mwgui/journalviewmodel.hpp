@@ -67,6 +67,13 @@ namespace MWGui
         /// returns true if their are no journal entries to display
         virtual bool isEmpty () const = 0;
 
+        /// returns the number of entries in the main journal
+        virtual size_t countJournalEntries () const = 0;
+
+        /// returns a value that stays the same as long as journal entries have only been appended
+        /// (see MWBase::Journal::getGeneration)
+        virtual int getJournalGeneration () const = 0;
+
         /// provides access to the name of the quest with the specified identifier
         virtual void visitQuestName (TopicId topicId, boost::function <void (Utf8Span)> visitor) const = 0;
 
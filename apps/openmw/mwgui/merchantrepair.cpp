@@ -52,8 +52,7 @@ void MerchantRepair::startRepair(const MWWorld::Ptr &actor)
                 continue;
 
             int basePrice = MWWorld::Class::get(*iter).getValue(*iter);
-            float fRepairMult = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>()
-                    .find("fRepairMult")->getFloat();
+            float fRepairMult = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable().fRepairMult;
 
             float p = std::max(1, basePrice);
             float r = std::max(1, static_cast<int>(maxDurability / p));
@@ -17,42 +17,59 @@
 
 namespace
 {
-    bool compareType(const std::string& type1, const std::string& type2)
+    int getTypeOrder (unsigned int type)
     {
         // this defines the sorting order of types. types that are first in the vector appear before other types.
-        std::vector<std::string> mapping;
-        mapping.push_back( typeid(ESM::Weapon).name() );
-        mapping.push_back( typeid(ESM::Armor).name() );
-        mapping.push_back( typeid(ESM::Clothing).name() );
-        mapping.push_back( typeid(ESM::Potion).name() );
-        mapping.push_back( typeid(ESM::Ingredient).name() );
-        mapping.push_back( typeid(ESM::Apparatus).name() );
-        mapping.push_back( typeid(ESM::Book).name() );
-        mapping.push_back( typeid(ESM::Light).name() );
-        mapping.push_back( typeid(ESM::Miscellaneous).name() );
-        mapping.push_back( typeid(ESM::Lockpick).name() );
-        mapping.push_back( typeid(ESM::Repair).name() );
-        mapping.push_back( typeid(ESM::Probe).name() );
-
-        assert( std::find(mapping.begin(), mapping.end(), type1) != mapping.end() );
-        assert( std::find(mapping.begin(), mapping.end(), type2) != mapping.end() );
-
-        return std::find(mapping.begin(), mapping.end(), type1) < std::find(mapping.begin(), mapping.end(), type2);
+        static std::vector<unsigned int> mapping;
+        if (mapping.empty())
+        {
+            mapping.push_back( ESM::Weapon::sRecordId );
+            mapping.push_back( ESM::Armor::sRecordId );
+            mapping.push_back( ESM::Clothing::sRecordId );
+            mapping.push_back( ESM::Potion::sRecordId );
+            mapping.push_back( ESM::Ingredient::sRecordId );
+            mapping.push_back( ESM::Apparatus::sRecordId );
+            mapping.push_back( ESM::Book::sRecordId );
+            mapping.push_back( ESM::Light::sRecordId );
+            mapping.push_back( ESM::Miscellaneous::sRecordId );
+            mapping.push_back( ESM::Lockpick::sRecordId );
+            mapping.push_back( ESM::Repair::sRecordId );
+            mapping.push_back( ESM::Probe::sRecordId );
+        }
+
+        std::vector<unsigned int>::const_iterator iter = std::find(mapping.begin(), mapping.end(), type);
+        assert( iter != mapping.end() );
+
+        return iter - mapping.begin();
     }
 
-    bool compare (const MWGui::ItemStack& left, const MWGui::ItemStack& right)
+    /// Sort key of an item, looked up once per item instead of once per comparison
+    struct SortKey
+    {
+        MWGui::ItemStack::Type mType;
+        int mTypeOrder;
+        std::string mName;
+        size_t mIndex; ///< index in the unsorted list (keeps the sort stable)
+
+        SortKey (const MWGui::ItemStack& item, size_t index)
+        : mType (item.mType), mTypeOrder (getTypeOrder (item.mBase.getType())),
+          mName (MWWorld::Class::get(item.mBase).getName(item.mBase)), mIndex (index)
+        {}
+    };
+
+    bool operator< (const SortKey& left, const SortKey& right)
     {
         if (left.mType != right.mType)
             return left.mType < right.mType;
 
-        if (left.mBase.getTypeName() == right.mBase.getTypeName())
-        {
-            int cmp = MWWorld::Class::get(left.mBase).getName(left.mBase).compare(
-                        MWWorld::Class::get(right.mBase).getName(right.mBase));
+        if (left.mTypeOrder != right.mTypeOrder)
+            return left.mTypeOrder < right.mTypeOrder;
+
+        int cmp = left.mName.compare(right.mName);
+        if (cmp != 0)
             return cmp < 0;
-        }
-        else
-            return compareType(left.mBase.getTypeName(), right.mBase.getTypeName());
+
+        return left.mIndex < right.mIndex;
     }
 }
 
@@ -85,22 +102,22 @@ namespace MWGui
             return false;
 
         int category = 0;
-        if (base.getTypeName() == typeid(ESM::Armor).name()
-                || base.getTypeName() == typeid(ESM::Clothing).name())
+        if (base.is<ESM::Armor>()
+                || base.is<ESM::Clothing>())
             category = Category_Apparel;
-        else if (base.getTypeName() == typeid(ESM::Weapon).name())
+        else if (base.is<ESM::Weapon>())
             category = Category_Weapon;
-        else if (base.getTypeName() == typeid(ESM::Ingredient).name()
-                     || base.getTypeName() == typeid(ESM::Potion).name())
+        else if (base.is<ESM::Ingredient>()
+                     || base.is<ESM::Potion>())
             category = Category_Magic;
-        else if (base.getTypeName() == typeid(ESM::Miscellaneous).name()
-                 || base.getTypeName() == typeid(ESM::Ingredient).name()
-                 || base.getTypeName() == typeid(ESM::Repair).name()
-                 || base.getTypeName() == typeid(ESM::Lockpick).name()
-                 || base.getTypeName() == typeid(ESM::Light).name()
-                 || base.getTypeName() == typeid(ESM::Apparatus).name()
-                 || base.getTypeName() == typeid(ESM::Book).name()
-                 || base.getTypeName() == typeid(ESM::Probe).name())
+        else if (base.is<ESM::Miscellaneous>()
+                 || base.is<ESM::Ingredient>()
+                 || base.is<ESM::Repair>()
+                 || base.is<ESM::Lockpick>()
+                 || base.is<ESM::Light>()
+                 || base.is<ESM::Apparatus>()
+                 || base.is<ESM::Book>()
+                 || base.is<ESM::Probe>())
             category = Category_Misc;
 
         if (item.mFlags & ItemStack::Flag_Enchanted)
@@ -109,20 +126,20 @@ namespace MWGui
         if (!(category & mCategory))
             return false;
 
-        if ((mFilter & Filter_OnlyIngredients) && base.getTypeName() != typeid(ESM::Ingredient).name())
+        if ((mFilter & Filter_OnlyIngredients) && !base.is<ESM::Ingredient>())
             return false;
         if ((mFilter & Filter_OnlyEnchanted) && !(item.mFlags & ItemStack::Flag_Enchanted))
             return false;
-        if ((mFilter & Filter_OnlyChargedSoulstones) && (base.getTypeName() != typeid(ESM::Miscellaneous).name()
+        if ((mFilter & Filter_OnlyChargedSoulstones) && (!base.is<ESM::Miscellaneous>()
                                                      || base.getCellRef().mSoul == ""))
             return false;
         if ((mFilter & Filter_OnlyEnchantable) && (item.mFlags & ItemStack::Flag_Enchanted
-                                               || (base.getTypeName() != typeid(ESM::Armor).name()
-                                                   && base.getTypeName() != typeid(ESM::Clothing).name()
-                                                   && base.getTypeName() != typeid(ESM::Weapon).name()
-                                                   && base.getTypeName() != typeid(ESM::Book).name())))
+                                               || (!base.is<ESM::Armor>()
+                                                   && !base.is<ESM::Clothing>()
+                                                   && !base.is<ESM::Weapon>()
+                                                   && !base.is<ESM::Book>())))
             return false;
-        if ((mFilter & Filter_OnlyEnchantable) && base.getTypeName() == typeid(ESM::Book).name()
+        if ((mFilter & Filter_OnlyEnchantable) && base.is<ESM::Book>()
                 && !base.get<ESM::Book>()->mBase->mData.mIsScroll)
             return false;
 
@@ -178,7 +195,19 @@ namespace MWGui
                 mItems.push_back(item);
         }
 
-        std::sort(mItems.begin(), mItems.end(), compare);
+        std::vector<SortKey> keys;
+        keys.reserve(mItems.size());
+        for (size_t i=0; i<mItems.size(); ++i)
+            keys.push_back(SortKey(mItems[i], i));
+
+        std::sort(keys.begin(), keys.end());
+
+        std::vector<ItemStack> sorted;
+        sorted.reserve(mItems.size());
+        for (std::vector<SortKey>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+            sorted.push_back(mItems[it->mIndex]);
+
+        mItems.swap(sorted);
     }
 
 }
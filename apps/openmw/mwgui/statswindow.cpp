@@ -8,6 +8,7 @@
 
 #include "../mwworld/class.hpp"
 #include "../mwworld/player.hpp"
+#include "../mwworld/esmstore.hpp"
 
 #include "../mwmechanics/npcstats.hpp"
 
@@ -33,6 +34,8 @@ namespace MWGui
       , mReputation(0)
       , mBounty(0)
       , mSkillWidgets()
+      , mLevelProgress(-1)
+      , mLevelUpTotal(-1)
       , mChanged(true)
     {
         setCoord(0,0,498, 342);
@@ -231,15 +234,27 @@ namespace MWGui
         const MWMechanics::NpcStats &PCstats = MWWorld::Class::get(player).getNpcStats(player);
 
         // level progress
-        MyGUI::Widget* levelWidget;
-        for (int i=0; i<2; ++i)
+        int levelUpTotal =
+            MWBase::Environment::get().getWorld()->getStore().getGameSettingTable().iLevelUpTotal;
+
+        int levelProgress = PCstats.getLevelProgress();
+
+        if (levelProgress!=mLevelProgress || levelUpTotal!=mLevelUpTotal)
         {
-            int max = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("iLevelUpTotal")->getInt();
-            getWidget(levelWidget, i==0 ? "Level_str" : "LevelText");
-            levelWidget->setUserString("RangePosition_LevelProgress", boost::lexical_cast<std::string>(PCstats.getLevelProgress()));
-            levelWidget->setUserString("Range_LevelProgress", boost::lexical_cast<std::string>(max));
-            levelWidget->setUserString("Caption_LevelProgressText", boost::lexical_cast<std::string>(PCstats.getLevelProgress()) + "/"
-                                       + boost::lexical_cast<std::string>(max));
+            mLevelProgress = levelProgress;
+            mLevelUpTotal = levelUpTotal;
+
+            std::string progress = boost::lexical_cast<std::string>(levelProgress);
+            std::string max = boost::lexical_cast<std::string>(mLevelUpTotal);
+
+            MyGUI::Widget* levelWidget;
+            for (int i=0; i<2; ++i)
+            {
+                getWidget(levelWidget, i==0 ? "Level_str" : "LevelText");
+                levelWidget->setUserString("RangePosition_LevelProgress", progress);
+                levelWidget->setUserString("Range_LevelProgress", max);
+                levelWidget->setUserString("Caption_LevelProgressText", progress + "/" + max);
+            }
         }
 
         setFactions(PCstats.getFactionRanks());
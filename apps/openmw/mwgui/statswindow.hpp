@@ -69,6 +69,8 @@ namespace MWGui
             int mReputation, mBounty;
             std::vector<MyGUI::Widget*> mSkillWidgets; //< Skills and other information
             std::set<std::string> mExpelled;
+            int mLevelProgress; ///< last value shown in the level progress widgets (-1: not set yet)
+            int mLevelUpTotal; ///< last iLevelUpTotal GMST shown in the level progress widgets
 
             bool mChanged;
 
@@ -15,6 +15,38 @@
 
 #include "itemmodel.hpp"
 
+namespace
+{
+    bool isEqual (const MWGui::Widgets::SpellEffectParams& left,
+        const MWGui::Widgets::SpellEffectParams& right)
+    {
+        // SpellEffectParams::operator== only compares what makes two effects stack, we need
+        // everything that ends up in the tooltip
+        return left.mNoTarget==right.mNoTarget && left.mIsConstant==right.mIsConstant &&
+            left.mKnown==right.mKnown && left.mEffectID==right.mEffectID &&
+            left.mSkill==right.mSkill && left.mAttribute==right.mAttribute &&
+            left.mMagnMin==right.mMagnMin && left.mMagnMax==right.mMagnMax &&
+            left.mRange==right.mRange && left.mDuration==right.mDuration &&
+            left.mArea==right.mArea;
+    }
+
+    bool isEqual (const MWGui::ToolTipInfo& left, const MWGui::ToolTipInfo& right)
+    {
+        if (left.caption!=right.caption || left.text!=right.text || left.icon!=right.icon ||
+            left.imageSize!=right.imageSize || left.enchant!=right.enchant ||
+            left.remainingEnchantCharge!=right.remainingEnchantCharge ||
+            left.isPotion!=right.isPotion || left.wordWrap!=right.wordWrap ||
+            left.effects.size()!=right.effects.size())
+            return false;
+
+        for (std::size_t i=0; i<left.effects.size(); ++i)
+            if (!isEqual (left.effects[i], right.effects[i]))
+                return false;
+
+        return true;
+    }
+}
+
 namespace MWGui
 {
 
@@ -29,6 +61,9 @@ namespace MWGui
         , mLastMouseX(0)
         , mLastMouseY(0)
         , mHorizontalScrollIndex(0)
+        , mToolTipShown(false)
+        , mCacheValid(false)
+        , mLayoutToolTip(0)
     {
         getWidget(mDynamicToolTipBox, "DynamicToolTipBox");
 
@@ -55,18 +90,40 @@ namespace MWGui
 
     void ToolTips::onFrame(float frameDuration)
     {
+        mToolTipShown = false;
 
-        while (mDynamicToolTipBox->getChildCount())
+        update(frameDuration);
+
+        if (!mToolTipShown)
+            clear();
+    }
+
+    void ToolTips::clear()
+    {
+        if (mLayoutToolTip)
         {
-            MyGUI::Gui::getInstance().destroyWidget(mDynamicToolTipBox->getChildAt(0));
+            mLayoutToolTip->setVisible(false);
+            mLayoutToolTip = 0;
         }
 
-        // start by hiding everything
-        for (unsigned int i=0; i < mMainWidget->getChildCount(); ++i)
+        clearDynamicToolTip();
+    }
+
+    void ToolTips::clearDynamicToolTip()
+    {
+        while (mDynamicToolTipBox->getChildCount())
         {
-            mMainWidget->getChildAt(i)->setVisible(false);
+            MyGUI::Gui::getInstance().destroyWidget(mDynamicToolTipBox->getChildAt(0));
         }
 
+        mCacheValid = false;
+
+        if (mDynamicToolTipBox->getVisible())
+            mDynamicToolTipBox->setVisible(false);
+    }
+
+    void ToolTips::update(float frameDuration)
+    {
         const MyGUI::IntSize &viewSize = MyGUI::RenderManager::getInstance().getViewSize();
 
         if (!mEnabled)
@@ -94,12 +151,10 @@ namespace MWGui
                 MyGUI::IntSize tooltipSize;
                 if ((!objectclass.hasToolTip(mFocusObject))&&(MWBase::Environment::get().getWindowManager()->getMode() == GM_Console))
                 {
-                    setCoord(0, 0, 300, 300);
-                    mDynamicToolTipBox->setVisible(true);
                     ToolTipInfo info;
                     info.caption=mFocusObject.getCellRef().mRefID;
                     info.icon="";
-                    tooltipSize = createToolTip(info);
+                    tooltipSize = showToolTip(info);
                 }
                 else
                     tooltipSize = getToolTipViaPtr(true);
@@ -180,7 +235,7 @@ namespace MWGui
                 }
                 else if (type == "ToolTipInfo")
                 {
-                    tooltipSize = createToolTip(*focus->getUserData<MWGui::ToolTipInfo>());
+                    tooltipSize = showToolTip(*focus->getUserData<MWGui::ToolTipInfo>());
                 }
                 else if (type == "AvatarItemSelection")
                 {
@@ -219,38 +274,12 @@ namespace MWGui
                         effects.push_back(params);
                     }
                     info.effects = effects;
-                    tooltipSize = createToolTip(info);
+                    tooltipSize = showToolTip(info);
                 }
                 else if (type == "Layout")
                 {
                     // tooltip defined in the layout
-                    MyGUI::Widget* tooltip;
-                    getWidget(tooltip, focus->getUserString("ToolTipLayout"));
-
-                    tooltip->setVisible(true);
-
-                    std::map<std::string, std::string> userStrings = focus->getUserStrings();
-                    for (std::map<std::string, std::string>::iterator it = userStrings.begin();
-                        it != userStrings.end(); ++it)
-                    {
-                        if (it->first == "ToolTipType"
-                            || it->first == "ToolTipLayout"
-                            || it->first == "IsMarker")
-                            continue;
-
-
-                        size_t underscorePos = it->first.find("_");
-                        std::string propertyKey = it->first.substr(0, underscorePos);
-                        std::string widgetName = it->first.substr(underscorePos+1, it->first.size()-(underscorePos+1));
-
-                        MyGUI::Widget* w;
-                        getWidget(w, widgetName);
-                        w->setProperty(propertyKey, it->second);
-                    }
-
-                    tooltipSize = tooltip->getSize();
-
-                    tooltip->setCoord(0, 0, tooltipSize.width, tooltipSize.height);
+                    tooltipSize = showLayoutToolTip(focus);
                 }
                 else
                     throw std::runtime_error ("unknown tooltip type");
@@ -272,8 +301,6 @@ namespace MWGui
                         std::max(0, int(mFocusToolTipY*viewSize.height - tooltipSize.height)),
                         tooltipSize.width,
                         tooltipSize.height);
-
-                mDynamicToolTipBox->setVisible(true);
             }
         }
     }
@@ -300,26 +327,90 @@ namespace MWGui
 
     MyGUI::IntSize ToolTips::getToolTipViaPtr (bool image)
     {
-        // this the maximum width of the tooltip before it starts word-wrapping
-        setCoord(0, 0, 300, 300);
-
-        MyGUI::IntSize tooltipSize;
-
         const MWWorld::Class& object = MWWorld::Class::get (mFocusObject);
         if (!object.hasToolTip(mFocusObject))
+            return MyGUI::IntSize();
+
+        ToolTipInfo info = object.getToolTipInfo(mFocusObject);
+        if (!image)
+            info.icon = "";
+
+        return showToolTip(info);
+    }
+
+    MyGUI::IntSize ToolTips::showToolTip(const ToolTipInfo& info)
+    {
+        mToolTipShown = true;
+
+        if (mLayoutToolTip)
         {
-            mDynamicToolTipBox->setVisible(false);
+            mLayoutToolTip->setVisible(false);
+            mLayoutToolTip = 0;
         }
-        else
+
+        if (mCacheValid && isEqual(info, mCachedInfo))
+        {
+            if (!mDynamicToolTipBox->getVisible())
+                mDynamicToolTipBox->setVisible(true);
+
+            return mCachedSize;
+        }
+
+        clearDynamicToolTip();
+
+        // createToolTip resets this, if the caption is scrolling (needs to be rebuilt every frame)
+        mCacheValid = true;
+        mCachedSize = createToolTip(info);
+        mCachedInfo = info;
+
+        return mCachedSize;
+    }
+
+    MyGUI::IntSize ToolTips::showLayoutToolTip(MyGUI::Widget* focus)
+    {
+        mToolTipShown = true;
+
+        MyGUI::Widget* tooltip;
+        getWidget(tooltip, focus->getUserString("ToolTipLayout"));
+
+        clearDynamicToolTip();
+
+        const std::map<std::string, std::string>& userStrings = focus->getUserStrings();
+
+        // the content of a layout tooltip depends only on the user strings of the focus widget
+        if (tooltip==mLayoutToolTip && userStrings==mLayoutUserStrings)
+            return tooltip->getSize();
+
+        if (mLayoutToolTip)
+            mLayoutToolTip->setVisible(false);
+
+        mLayoutToolTip = tooltip;
+        mLayoutUserStrings = userStrings;
+
+        tooltip->setVisible(true);
+
+        for (std::map<std::string, std::string>::const_iterator it = userStrings.begin();
+            it != userStrings.end(); ++it)
         {
-            mDynamicToolTipBox->setVisible(true);
+            if (it->first == "ToolTipType"
+                || it->first == "ToolTipLayout"
+                || it->first == "IsMarker")
+                continue;
 
-            ToolTipInfo info = object.getToolTipInfo(mFocusObject);
-            if (!image)
-                info.icon = "";
-            tooltipSize = createToolTip(info);
+
+            size_t underscorePos = it->first.find("_");
+            std::string propertyKey = it->first.substr(0, underscorePos);
+            std::string widgetName = it->first.substr(underscorePos+1, it->first.size()-(underscorePos+1));
+
+            MyGUI::Widget* w;
+            getWidget(w, widgetName);
+            w->setProperty(propertyKey, it->second);
         }
 
+        MyGUI::IntSize tooltipSize = tooltip->getSize();
+
+        tooltip->setCoord(0, 0, tooltipSize.width, tooltipSize.height);
+
         return tooltipSize;
     }
 
@@ -483,6 +574,7 @@ namespace MWGui
                 mHorizontalScrollIndex = -totalSize.width;
             }
             int horizontal_scroll = mHorizontalScrollIndex;
+            mCacheValid = false;
             if (horizontal_scroll < 40){
                 horizontal_scroll = 40;
             }else{
@@ -83,12 +83,39 @@ namespace MWGui
 
         void findImageExtension(std::string& image);
 
+        void update(float frameDuration);
+        ///< show the tooltip for the current focus (if any)
+
+        void clear();
+        ///< hide all tooltips and release the cached dynamic tooltip
+
+        void clearDynamicToolTip();
+
         MyGUI::IntSize getToolTipViaPtr (bool image=true);
         ///< @return requested tooltip size
 
+        MyGUI::IntSize showToolTip(const ToolTipInfo& info);
+        ///< show a dynamic tooltip, reusing the widgets from the last frame if \a info has not changed
+        /// @return requested tooltip size
+
+        MyGUI::IntSize showLayoutToolTip(MyGUI::Widget* focus);
+        ///< show a tooltip defined in the layout, filled in from the user strings of \a focus
+        /// @return requested tooltip size
+
         MyGUI::IntSize createToolTip(const ToolTipInfo& info);
         ///< @return requested tooltip size
 
+        bool mToolTipShown; ///< has a tooltip been shown during the current frame?
+
+        // retained dynamic tooltip
+        bool mCacheValid;
+        ToolTipInfo mCachedInfo;
+        MyGUI::IntSize mCachedSize;
+
+        // retained layout tooltip
+        MyGUI::Widget* mLayoutToolTip;
+        std::map<std::string, std::string> mLayoutUserStrings;
+
         float mFocusToolTipX;
         float mFocusToolTipY;
 
@@ -236,8 +236,8 @@ namespace MWGui
     {
         TradeItemModel* playerItemModel = MWBase::Environment::get().getWindowManager()->getInventoryWindow()->getTradeModel();
 
-        const MWWorld::Store<ESM::GameSetting> &gmst =
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const ESM::GameSettingTable& gmst =
+            MWBase::Environment::get().getWorld()->getStore().getGameSettingTable();
 
         // were there any items traded at all?
         std::vector<ItemStack> playerBought = playerItemModel->getItemsBorrowedToUs();
@@ -276,7 +276,8 @@ namespace MWGui
         {
             if (Misc::StringUtils::ciEqual(it->mBase.getCellRef().mOwner, mPtr.getCellRef().mRefID))
             {
-                std::string msg = gmst.find("sNotifyMessage49")->getString();
+                std::string msg =
+                    MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("sNotifyMessage49")->getString();
                 if (msg.find("%s") != std::string::npos)
                     msg.replace(msg.find("%s"), 2, it->mBase.getClass().getName(it->mBase));
                 MWBase::Environment::get().getWindowManager()->messageBox(msg);
@@ -293,7 +294,7 @@ namespace MWGui
         if(mCurrentBalance > mCurrentMerchantOffer)
         {
             //if npc is a creature: reject (no haggle)
-            if (mPtr.getTypeName() != typeid(ESM::NPC).name())
+            if (!mPtr.is<ESM::NPC>())
             {
                 MWBase::Environment::get().getWindowManager()->
                     messageBox("#{sNotifyMessage9}");
@@ -323,7 +324,7 @@ namespace MWGui
 
             float pcTerm = (clampedDisposition - 50 + a1 + b1 + c1) * playerStats.getFatigueTerm();
             float npcTerm = (d1 + e1 + f1) * sellerStats.getFatigueTerm();
-            float x = gmst.find("fBargainOfferMulti")->getFloat() * d + gmst.find("fBargainOfferBase")->getFloat();
+            float x = gmst.fBargainOfferMulti * d + gmst.fBargainOfferBase;
             if (mCurrentBalance<0)
                 x += abs(int(pcTerm - npcTerm));
             else
@@ -335,7 +336,7 @@ namespace MWGui
                 MWBase::Environment::get().getWindowManager()->
                     messageBox("#{sNotifyMessage9}");
 
-                int iBarterFailDisposition = gmst.find("iBarterFailDisposition")->getInt();
+                int iBarterFailDisposition = gmst.iBarterFailDisposition;
                 if (mPtr.getClass().isNpc())
                     MWBase::Environment::get().getDialogueManager()->applyDispositionChange(iBarterFailDisposition);
                 return;
@@ -345,7 +346,7 @@ namespace MWGui
             player.getClass().skillUsageSucceeded(player, ESM::Skill::Mercantile, 0);
         }
 
-        int iBarterSuccessDisposition = gmst.find("iBarterSuccessDisposition")->getInt();
+        int iBarterSuccessDisposition = gmst.iBarterSuccessDisposition;
         if (mPtr.getClass().isNpc())
             MWBase::Environment::get().getDialogueManager()->applyDispositionChange(iBarterSuccessDisposition);
 
@@ -1,5 +1,7 @@
 #include "travelwindow.hpp"
 
+#include <stdexcept>
+
 #include <boost/lexical_cast.hpp>
 
 #include <OgreVector3.h>
@@ -16,6 +18,25 @@
 #include "../mwworld/esmstore.hpp"
 #include "../mwworld/cellstore.hpp"
 
+namespace
+{
+    /// Check \a value, the GMST table's copy of the GMST \a id, before dividing a travel
+    /// distance by it.
+    ///
+    /// The table holds a missing GMST as 0, so for values <= 0 the GMST is looked up in the store
+    /// first, which reports a missing GMST as such.
+    float getTravelDivisor (float value, const char *id)
+    {
+        if (value<=0)
+        {
+            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find (id);
+            throw std::runtime_error (std::string ("invalid travel GMST: ") + id);
+        }
+
+        return value;
+    }
+}
+
 namespace MWGui
 {
     const int TravelWindow::sLineHeight = 18;
@@ -49,21 +70,20 @@ namespace MWGui
     {
         int price = 0;
 
-        const MWWorld::Store<ESM::GameSetting> &gmst =
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const ESM::GameSettingTable& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable();
 
         MWWorld::Ptr player = MWBase::Environment::get().getWorld ()->getPlayerPtr();
         int playerGold = player.getClass().getContainerStore(player).count(MWWorld::ContainerStore::sGoldId);
 
         if(interior)
         {
-            price = gmst.find("fMagesGuildTravel")->getFloat();
+            price = gmst.fMagesGuildTravel;
         }
         else
         {
             ESM::Position PlayerPos = player.getRefData().getPosition();
             float d = sqrt( pow(pos.pos[0] - PlayerPos.pos[0],2) + pow(pos.pos[1] - PlayerPos.pos[1],2) + pow(pos.pos[2] - PlayerPos.pos[2],2)   );
-            price = d/gmst.find("fTravelMult")->getFloat();
+            price = d/getTravelDivisor (gmst.fTravelMult, "fTravelMult");
         }
 
         price = MWBase::Environment::get().getMechanicsManager()->getBarterOffer(mPtr,price,true);
@@ -151,7 +171,9 @@ namespace MWGui
             ESM::Position playerPos = player.getRefData().getPosition();
             float d = Ogre::Vector3(pos.pos[0], pos.pos[1], 0).distance(
                         Ogre::Vector3(playerPos.pos[0], playerPos.pos[1], 0));
-            int hours = static_cast<int>(d /MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fTravelTimeMult")->getFloat());
+            int hours = static_cast<int>(d /getTravelDivisor (
+                MWBase::Environment::get().getWorld()->getStore().getGameSettingTable().fTravelTimeMult,
+                "fTravelTimeMult"));
             for(int i = 0;i < hours;i++)
             {
                 MWBase::Environment::get().getMechanicsManager ()->rest (true);
@@ -86,7 +86,7 @@ bool disintegrateSlot (MWWorld::Ptr ptr, int slot, float disintegrate)
 void getRestorationPerHourOfSleep (const MWWorld::Ptr& ptr, float& health, float& magicka)
 {
     MWMechanics::CreatureStats& stats = ptr.getClass().getCreatureStats (ptr);
-    const MWWorld::Store<ESM::GameSetting>& settings = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+    const ESM::GameSettingTable& settings = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable();
 
     bool stunted = stats.getMagicEffects ().get(ESM::MagicEffect::StuntedMagicka).mMagnitude > 0;
     int endurance = stats.getAttribute (ESM::Attribute::Endurance).getModified ();
@@ -96,7 +96,7 @@ void getRestorationPerHourOfSleep (const MWWorld::Ptr& ptr, float& health, float
     magicka = 0;
     if (!stunted)
     {
-        float fRestMagicMult = settings.find("fRestMagicMult")->getFloat ();
+        float fRestMagicMult = settings.fRestMagicMult;
         magicka = fRestMagicMult * stats.getAttribute(ESM::Attribute::Intelligence).getModified();
     }
 }
@@ -129,7 +129,7 @@ namespace MWMechanics
             if (caster.isEmpty() || !caster.getClass().isActor())
                 return;
 
-            static const float fSoulgemMult = world->getStore().get<ESM::GameSetting>().find("fSoulgemMult")->getFloat();
+            const float fSoulgemMult = world->getStore().getGameSettingTable().fSoulgemMult;
 
             float creatureSoulValue = mCreature.get<ESM::Creature>()->mBase->mData.mSoul;
             if (creatureSoulValue == 0)
@@ -192,7 +192,7 @@ namespace MWMechanics
                     +(actorpos.pos[2] - playerpos.pos[2])*(actorpos.pos[2] - playerpos.pos[2]));
                 float fight = ptr.getClass().getCreatureStats(ptr).getAiSetting(CreatureStats::AI_Fight).getModified();
                 float disp = 100; //creatures don't have disposition, so set it to 100 by default
-                if(ptr.getTypeName() == typeid(ESM::NPC).name())
+                if(ptr.is<ESM::NPC>())
                 {
                     disp = MWBase::Environment::get().getMechanicsManager()->getDerivedDisposition(ptr);
                 }
@@ -238,7 +238,7 @@ namespace MWMechanics
 
         MagicEffects now = creatureStats.getSpells().getMagicEffects();
 
-        if (creature.getTypeName()==typeid (ESM::NPC).name())
+        if (creature.is<ESM::NPC>())
         {
             MWWorld::InventoryStore& store = MWWorld::Class::get (creature).getInventoryStore (creature);
             now += store.getMagicEffects();
@@ -283,7 +283,7 @@ namespace MWMechanics
             return;
 
         MWMechanics::CreatureStats& stats = ptr.getClass().getCreatureStats (ptr);
-        const MWWorld::Store<ESM::GameSetting>& settings = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const ESM::GameSettingTable& settings = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable();
 
         if (sleep)
         {
@@ -308,9 +308,9 @@ namespace MWMechanics
             normalizedEncumbrance = 1;
 
         // restore fatigue
-        float fFatigueReturnBase = settings.find("fFatigueReturnBase")->getFloat ();
-        float fFatigueReturnMult = settings.find("fFatigueReturnMult")->getFloat ();
-        float fEndFatigueMult = settings.find("fEndFatigueMult")->getFloat ();
+        float fFatigueReturnBase = settings.fFatigueReturnBase;
+        float fFatigueReturnMult = settings.fFatigueReturnMult;
+        float fEndFatigueMult = settings.fEndFatigueMult;
 
         float x = fFatigueReturnBase + fFatigueReturnMult * (1 - normalizedEncumbrance);
         x *= fEndFatigueMult * endurance;
@@ -595,7 +595,7 @@ namespace MWMechanics
             if(timeLeft == 0.0f)
             {
                 // If drowning, apply 3 points of damage per second
-                static const float fSuffocationDamage = world->getStore().get<ESM::GameSetting>().find("fSuffocationDamage")->getFloat();
+                const float fSuffocationDamage = world->getStore().getGameSettingTable().fSuffocationDamage;
                 ptr.getClass().setActorHealth(ptr, stats.getHealth().getCurrent() - fSuffocationDamage*duration);
 
                 // Play a drowning sound as necessary for the player
@@ -609,7 +609,7 @@ namespace MWMechanics
         }
         else
         {
-            static const float fHoldBreathTime = world->getStore().get<ESM::GameSetting>().find("fHoldBreathTime")->getFloat();
+            const float fHoldBreathTime = world->getStore().getGameSettingTable().fHoldBreathTime;
             stats.setTimeToStartDrowning(fHoldBreathTime);
         }
     }
@@ -629,7 +629,7 @@ namespace MWMechanics
             MWWorld::ContainerStoreIterator torch = inventoryStore.end();
             for (MWWorld::ContainerStoreIterator it = inventoryStore.begin(); it != inventoryStore.end(); ++it)
             {
-                if (it->getTypeName() == typeid(ESM::Light).name())
+                if (it->is<ESM::Light>())
                 {
                     torch = it;
                     break;
@@ -643,7 +643,7 @@ namespace MWMechanics
                     if (!MWWorld::Class::get (ptr).getCreatureStats (ptr).isHostile())
                     {
                         // For non-hostile NPCs, unequip whatever is in the left slot in favor of a light.
-                        if (heldIter != inventoryStore.end() && heldIter->getTypeName() != typeid(ESM::Light).name())
+                        if (heldIter != inventoryStore.end() && !heldIter->is<ESM::Light>())
                             inventoryStore.unequipItem(*heldIter, ptr);
 
                         // Also unequip twohanded weapons which conflict with anything in CarriedLeft
@@ -664,7 +664,7 @@ namespace MWMechanics
             }
             else
             {
-                if (heldIter != inventoryStore.end() && heldIter->getTypeName() == typeid(ESM::Light).name())
+                if (heldIter != inventoryStore.end() && heldIter->is<ESM::Light>())
                 {
                     // At day, unequip lights and auto equip shields or other suitable items
                     // (Note: autoEquip will ignore lights)
@@ -791,7 +791,7 @@ namespace MWMechanics
                 if (!iter->first.getClass().getCreatureStats(iter->first).isDead())
                 {
                     updateActor(iter->first, duration);
-                    if(iter->first.getTypeName() == typeid(ESM::NPC).name())
+                    if(iter->first.is<ESM::NPC>())
                         updateNpc(iter->first, duration, paused);
                 }
             }
@@ -859,7 +859,7 @@ namespace MWMechanics
                     ++mDeathCount[cls.getId(iter->first)];
 
                     // Apply soultrap
-                    if (iter->first.getTypeName() == typeid(ESM::Creature).name())
+                    if (iter->first.is<ESM::Creature>())
                     {
                         SoulTrap soulTrap (iter->first);
                         stats.getActiveSpells().visitEffectSources(soulTrap);
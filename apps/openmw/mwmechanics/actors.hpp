@@ -2,6 +2,7 @@
 #define GAME_MWMECHANICS_ACTORS_H
 
 #include <set>
+#include <list>
 #include <vector>
 #include <string>
 #include <map>
@@ -112,7 +112,7 @@ namespace MWMechanics
                 if (actor.getClass().isNpc())
                 {
                     const MWWorld::ESMStore &store = MWBase::Environment::get().getWorld()->getStore();
-                    int chance = store.get<ESM::GameSetting>().find("iVoiceAttackOdds")->getInt();
+                    int chance = store.getGameSettingTable().iVoiceAttackOdds;
                     int roll = std::rand()/ (static_cast<double> (RAND_MAX) + 1) * 100; // [0, 99]
                     if (roll < chance)
                     {
@@ -148,9 +148,8 @@ namespace MWMechanics
 
             if (weaptype == WeapType_HandToHand)
             {
-                const MWWorld::Store<ESM::GameSetting> &gmst =
-                    MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
-                weapRange = gmst.find("fHandToHandReach")->getFloat();
+                const ESM::GameSettingTable& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable();
+                weapRange = gmst.fHandToHandReach;
             }
             else
             {
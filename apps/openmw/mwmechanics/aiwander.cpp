@@ -55,7 +55,7 @@ namespace MWMechanics
         mPlayedIdle = 0;
         mPathgrid = NULL;
         mIdleChanceMultiplier =
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fIdleChanceMultiplier")->getFloat();
+            MWBase::Environment::get().getWorld()->getStore().getGameSettingTable().fIdleChanceMultiplier;
 
         mStoredAvailableNodes = false;
         mChooseAction = true;
@@ -197,7 +197,7 @@ namespace MWMechanics
                 if (hello > 0)
                 {
                     const MWWorld::ESMStore &store = MWBase::Environment::get().getWorld()->getStore();
-                    float chance = store.get<ESM::GameSetting>().find("fVoiceIdleOdds")->getFloat();
+                    float chance = store.getGameSettingTable().fVoiceIdleOdds;
                     int roll = std::rand()/ (static_cast<double> (RAND_MAX) + 1) * 100; // [0, 99]
                     MWWorld::Ptr player = MWBase::Environment::get().getWorld()->getPlayerPtr();
 
@@ -215,7 +215,7 @@ namespace MWMechanics
 
             int hello = actor.getClass().getCreatureStats(actor).getAiSetting(CreatureStats::AI_Hello).getModified();
             float helloDistance = hello;
-            int iGreetDistanceMultiplier = store.get<ESM::GameSetting>().find("iGreetDistanceMultiplier")->getInt();
+            int iGreetDistanceMultiplier = store.getGameSettingTable().iGreetDistanceMultiplier;
             helloDistance *= iGreetDistanceMultiplier;
 
             MWWorld::Ptr player = MWBase::Environment::get().getWorld()->getPlayerPtr();
@@ -236,7 +236,7 @@ namespace MWMechanics
             }
             else
             {
-                float fGreetDistanceReset = store.get<ESM::GameSetting>().find("fGreetDistanceReset")->getFloat();
+                float fGreetDistanceReset = store.getGameSettingTable().fGreetDistanceReset;
                 if (playerDist >= fGreetDistanceReset * iGreetDistanceMultiplier)
                     mSaidGreeting = false;
             }
@@ -131,11 +131,11 @@ void MWMechanics::Alchemy::updateEffects()
     float x = getChance();
 
     x *= mTools[ESM::Apparatus::MortarPestle].get<ESM::Apparatus>()->mBase->mData.mQuality;
-    x *= MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find ("fPotionStrengthMult")->getFloat();
+    x *= MWBase::Environment::get().getWorld()->getStore().getGameSettingTable().fPotionStrengthMult;
 
     // value
     mValue = static_cast<int> (
-        x * MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find ("iAlchemyMod")->getFloat());
+        x * MWBase::Environment::get().getWorld()->getStore().getGameSettingTable().iAlchemyMod);
 
     // build quantified effect list
     for (std::set<EffectKey>::const_iterator iter (effects.begin()); iter!=effects.end(); ++iter)
@@ -151,13 +151,13 @@ void MWMechanics::Alchemy::updateEffects()
         }
 
         float fPotionT1MagMul =
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find ("fPotionT1MagMult")->getFloat();
+            MWBase::Environment::get().getWorld()->getStore().getGameSettingTable().fPotionT1MagMult;
 
         if (fPotionT1MagMul<=0)
             throw std::runtime_error ("invalid gmst: fPotionT1MagMul");
 
         float fPotionT1DurMult =
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find ("fPotionT1DurMult")->getFloat();
+            MWBase::Environment::get().getWorld()->getStore().getGameSettingTable().fPotionT1DurMult;
 
         if (fPotionT1DurMult<=0)
             throw std::runtime_error ("invalid gmst: fPotionT1DurMult");
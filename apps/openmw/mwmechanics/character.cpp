@@ -21,6 +21,8 @@
 
 #include <OgreStringConverter.h>
 
+#include <components/settings/settings.hpp>
+
 #include "movement.hpp"
 #include "npcstats.hpp"
 #include "creaturestats.hpp"
@@ -41,6 +43,8 @@
 namespace
 {
 
+const Settings::BoolSetting sBestAttack ("best attack", "Game");
+
 std::string getBestAttack (const ESM::Weapon* weapon)
 {
     int slash = (weapon->mData.mSlash[0] + weapon->mData.mSlash[1])/2;
@@ -362,10 +366,10 @@ MWWorld::ContainerStoreIterator getActiveWeapon(CreatureStats &stats, MWWorld::I
             *weaptype = WeapType_HandToHand;
         else
         {
-            const std::string &type = weapon->getTypeName();
-            if(type == typeid(ESM::Lockpick).name() || type == typeid(ESM::Probe).name())
+            unsigned int type = weapon->getType();
+            if(type == ESM::Lockpick::sRecordId || type == ESM::Probe::sRecordId)
                 *weaptype = WeapType_PickProbe;
-            else if(type == typeid(ESM::Weapon).name())
+            else if(type == ESM::Weapon::sRecordId)
             {
                 MWWorld::LiveCellRef<ESM::Weapon> *ref = weapon->get<ESM::Weapon>();
                 ESM::Weapon::Type type = (ESM::Weapon::Type)ref->mBase->mData.mType;
@@ -613,7 +617,7 @@ bool CharacterController::updateWeaponState()
             sndMgr->stopSound3D(mPtr, "WolfRun");
     }
 
-    bool isWeapon = (weapon != inv.end() && weapon->getTypeName() == typeid(ESM::Weapon).name());
+    bool isWeapon = (weapon != inv.end() && weapon->is<ESM::Weapon>());
     float weapSpeed = 1.0f;
     if(isWeapon)
         weapSpeed = weapon->get<ESM::Weapon>()->mBase->mData.mSpeed;
@@ -716,9 +720,9 @@ bool CharacterController::updateWeaponState()
 
                 if(!target.isEmpty())
                 {
-                    if(item.getTypeName() == typeid(ESM::Lockpick).name())
+                    if(item.is<ESM::Lockpick>())
                         Security(mPtr).pickLock(target, item, resultMessage, resultSound);
-                    else if(item.getTypeName() == typeid(ESM::Probe).name())
+                    else if(item.is<ESM::Probe>())
                         Security(mPtr).probeTrap(target, item, resultMessage, resultSound);
                 }
                 mAnimation->play(mCurrentWeapon, Priority_Weapon,
@@ -743,7 +747,7 @@ bool CharacterController::updateWeaponState()
                 else
                 {
                     if(isWeapon && mPtr.getRefData().getHandle() == "player" &&
-                            Settings::Manager::getBool("best attack", "Game"))
+                            sBestAttack.get())
                         mAttackType = getBestAttack(weapon->get<ESM::Weapon>()->mBase);
                     else
                         determineAttackType();
@@ -953,7 +957,7 @@ bool CharacterController::updateWeaponState()
     }
 
     MWWorld::ContainerStoreIterator torch = inv.getSlot(MWWorld::InventoryStore::Slot_CarriedLeft);
-    if(torch != inv.end() && torch->getTypeName() == typeid(ESM::Light).name()
+    if(torch != inv.end() && torch->is<ESM::Light>()
             && mWeaponType != WeapType_Spell && mWeaponType != WeapType_HandToHand)
 
     {
@@ -1040,16 +1044,16 @@ void CharacterController::update(float duration)
         }
 
         // reduce fatigue
-        const MWWorld::Store<ESM::GameSetting> &gmst = world->getStore().get<ESM::GameSetting>();
+        const ESM::GameSettingTable& gmst = world->getStore().getGameSettingTable();
         float fatigueLoss = 0;
-        static const float fFatigueRunBase = gmst.find("fFatigueRunBase")->getFloat();
-        static const float fFatigueRunMult = gmst.find("fFatigueRunMult")->getFloat();
-        static const float fFatigueSwimWalkBase = gmst.find("fFatigueSwimWalkBase")->getFloat();
-        static const float fFatigueSwimRunBase = gmst.find("fFatigueSwimRunBase")->getFloat();
-        static const float fFatigueSwimWalkMult = gmst.find("fFatigueSwimWalkMult")->getFloat();
-        static const float fFatigueSwimRunMult = gmst.find("fFatigueSwimRunMult")->getFloat();
-        static const float fFatigueSneakBase = gmst.find("fFatigueSneakBase")->getFloat();
-        static const float fFatigueSneakMult = gmst.find("fFatigueSneakMult")->getFloat();
+        const float fFatigueRunBase = gmst.fFatigueRunBase;
+        const float fFatigueRunMult = gmst.fFatigueRunMult;
+        const float fFatigueSwimWalkBase = gmst.fFatigueSwimWalkBase;
+        const float fFatigueSwimRunBase = gmst.fFatigueSwimRunBase;
+        const float fFatigueSwimWalkMult = gmst.fFatigueSwimWalkMult;
+        const float fFatigueSwimRunMult = gmst.fFatigueSwimRunMult;
+        const float fFatigueSneakBase = gmst.fFatigueSneakBase;
+        const float fFatigueSneakMult = gmst.fFatigueSneakMult;
 
         const float encumbrance = cls.getEncumbrance(mPtr) / cls.getCapacity(mPtr);
         if (encumbrance < 1)
@@ -1100,9 +1104,9 @@ void CharacterController::update(float duration)
             if(cls.isNpc())
             {
                 const NpcStats &stats = cls.getNpcStats(mPtr);
-                mult = gmst.find("fJumpMoveBase")->getFloat() +
+                mult = gmst.fJumpMoveBase +
                        (stats.getSkill(ESM::Skill::Acrobatics).getModified()/100.0f *
-                        gmst.find("fJumpMoveMult")->getFloat());
+                        gmst.fJumpMoveMult);
             }
 
             vec.x *= mult;
@@ -1126,9 +1130,8 @@ void CharacterController::update(float duration)
                 cls.skillUsageSucceeded(mPtr, ESM::Skill::Acrobatics, 0);
 
             // decrease fatigue
-            const MWWorld::Store<ESM::GameSetting> &gmst = world->getStore().get<ESM::GameSetting>();
-            const float fatigueJumpBase = gmst.find("fFatigueJumpBase")->getFloat();
-            const float fatigueJumpMult = gmst.find("fFatigueJumpMult")->getFloat();
+            const float fatigueJumpBase = gmst.fFatigueJumpBase;
+            const float fatigueJumpMult = gmst.fFatigueJumpMult;
             const float normalizedEncumbrance = cls.getEncumbrance(mPtr) / cls.getCapacity(mPtr);
             const int fatigueDecrease = fatigueJumpBase + (1 - normalizedEncumbrance) * fatigueJumpMult;
             DynamicStat<float> fatigue = cls.getCreatureStats(mPtr).getFatigue();
@@ -60,16 +60,16 @@ namespace MWMechanics
 
         MWWorld::InventoryStore& inv = blocker.getClass().getInventoryStore(blocker);
         MWWorld::ContainerStoreIterator shield = inv.getSlot(MWWorld::InventoryStore::Slot_CarriedLeft);
-        if (shield == inv.end() || shield->getTypeName() != typeid(ESM::Armor).name())
+        if (shield == inv.end() || !shield->is<ESM::Armor>())
             return false;
 
         Ogre::Degree angle = signedAngle (Ogre::Vector3(attacker.getRefData().getPosition().pos) - Ogre::Vector3(blocker.getRefData().getPosition().pos),
                                           blocker.getRefData().getBaseNode()->getOrientation().yAxis(), Ogre::Vector3(0,0,1));
 
-        const MWWorld::Store<ESM::GameSetting>& gmst = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
-        if (angle.valueDegrees() < gmst.find("fCombatBlockLeftAngle")->getFloat())
+        const ESM::GameSettingTable& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable();
+        if (angle.valueDegrees() < gmst.fCombatBlockLeftAngle)
             return false;
-        if (angle.valueDegrees() > gmst.find("fCombatBlockRightAngle")->getFloat())
+        if (angle.valueDegrees() > gmst.fCombatBlockRightAngle)
             return false;
 
         MWMechanics::CreatureStats& blockerStats = blocker.getClass().getCreatureStats(blocker);
@@ -81,11 +81,11 @@ namespace MWMechanics
         float blockTerm = blocker.getClass().getSkill(blocker, ESM::Skill::Block) + 0.2 * blockerStats.getAttribute(ESM::Attribute::Agility).getModified()
             + 0.1 * blockerStats.getAttribute(ESM::Attribute::Luck).getModified();
         float enemySwing = attackerStats.getAttackStrength();
-        float swingTerm = enemySwing * gmst.find("fSwingBlockMult")->getFloat() + gmst.find("fSwingBlockBase")->getFloat();
+        float swingTerm = enemySwing * gmst.fSwingBlockMult + gmst.fSwingBlockBase;
 
         float blockerTerm = blockTerm * swingTerm;
         if (blocker.getClass().getMovementSettings(blocker).mPosition[1] <= 0)
-            blockerTerm *= gmst.find("fBlockStillBonus")->getFloat();
+            blockerTerm *= gmst.fBlockStillBonus;
         blockerTerm *= blockerStats.getFatigueTerm();
 
         float attackerSkill = attacker.getClass().getSkill(attacker, weapon.getClass().getEquipmentSkill(weapon));
@@ -94,8 +94,8 @@ namespace MWMechanics
         attackerTerm *= attackerStats.getFatigueTerm();
 
         int x = int(blockerTerm - attackerTerm);
-        int iBlockMaxChance = gmst.find("iBlockMaxChance")->getInt();
-        int iBlockMinChance = gmst.find("iBlockMinChance")->getInt();
+        int iBlockMaxChance = gmst.iBlockMaxChance;
+        int iBlockMinChance = gmst.iBlockMinChance;
         x = std::min(iBlockMaxChance, std::max(iBlockMinChance, x));
 
         int roll = std::rand()/ (static_cast<double> (RAND_MAX) + 1) * 100; // [0, 99]
@@ -109,9 +109,9 @@ namespace MWMechanics
                 inv.unequipItem(*shield, blocker);
 
             // Reduce blocker fatigue
-            const float fFatigueBlockBase = gmst.find("fFatigueBlockBase")->getFloat();
-            const float fFatigueBlockMult = gmst.find("fFatigueBlockMult")->getFloat();
-            const float fWeaponFatigueBlockMult = gmst.find("fWeaponFatigueBlockMult")->getFloat();
+            const float fFatigueBlockBase = gmst.fFatigueBlockBase;
+            const float fFatigueBlockMult = gmst.fFatigueBlockMult;
+            const float fWeaponFatigueBlockMult = gmst.fWeaponFatigueBlockMult;
             MWMechanics::DynamicStat<float> fatigue = blockerStats.getFatigue();
             float normalizedEncumbrance = blocker.getClass().getEncumbrance(blocker) / blocker.getClass().getCapacity(blocker);
             normalizedEncumbrance = std::min(1.f, normalizedEncumbrance);
@@ -148,7 +148,7 @@ namespace MWMechanics
 
         if (weapon.get<ESM::Weapon>()->mBase->mData.mFlags & ESM::Weapon::Silver
                 & actor.getClass().isNpc() && actor.getClass().getNpcStats(actor).isWerewolf())
-            damage *= MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fWereWolfSilverWeaponDamageMult")->getFloat();
+            damage *= MWBase::Environment::get().getWorld()->getStore().getGameSettingTable().fWereWolfSilverWeaponDamageMult;
 
         if (damage == 0 && attacker.getRefData().getHandle() == "player")
             MWBase::Environment::get().getWindowManager()->messageBox("#{sMagicTargetResistsWeapons}");
@@ -158,7 +158,7 @@ namespace MWMechanics
                        const Ogre::Vector3& hitPosition)
     {
         MWBase::World *world = MWBase::Environment::get().getWorld();
-        const MWWorld::Store<ESM::GameSetting> &gmst = world->getStore().get<ESM::GameSetting>();
+        const ESM::GameSettingTable& gmst = world->getStore().getGameSettingTable();
 
         MWMechanics::CreatureStats& attackerStats = attacker.getClass().getCreatureStats(attacker);
 
@@ -187,8 +187,8 @@ namespace MWMechanics
 
         float damage = 0.0f;
 
-        float fDamageStrengthBase = gmst.find("fDamageStrengthBase")->getFloat();
-        float fDamageStrengthMult = gmst.find("fDamageStrengthMult")->getFloat();
+        float fDamageStrengthBase = gmst.fDamageStrengthBase;
+        float fDamageStrengthMult = gmst.fDamageStrengthMult;
 
         const unsigned char* attack = weapon.get<ESM::Weapon>()->mBase->mData.mChop;
         damage = attack[0] + ((attack[1]-attack[0])*attackerStats.getAttackStrength()); // Bow/crossbow damage
@@ -208,12 +208,12 @@ namespace MWMechanics
         bool detected = MWBase::Environment::get().getMechanicsManager()->awarenessCheck(attacker, victim);
         if(!detected)
         {
-            damage *= gmst.find("fCombatCriticalStrikeMult")->getFloat();
+            damage *= gmst.fCombatCriticalStrikeMult;
             MWBase::Environment::get().getWindowManager()->messageBox("#{sTargetCriticalStrike}");
             MWBase::Environment::get().getSoundManager()->playSound3D(victim, "critical damage", 1.0f, 1.0f);
         }
         if (victim.getClass().getCreatureStats(victim).getKnockedDown())
-            damage *= gmst.find("fCombatKODamageMult")->getFloat();
+            damage *= gmst.fCombatKODamageMult;
 
         // Apply "On hit" effect of the weapon
         applyEnchantment(attacker, victim, weapon, hitPosition);
@@ -223,7 +223,7 @@ namespace MWMechanics
         if (damage > 0)
             MWBase::Environment::get().getWorld()->spawnBloodEffect(victim, hitPosition);
 
-        float fProjectileThrownStoreChance = gmst.find("fProjectileThrownStoreChance")->getFloat();
+        float fProjectileThrownStoreChance = gmst.fProjectileThrownStoreChance;
         if ((::rand()/(RAND_MAX+1.0)) < fProjectileThrownStoreChance/100.f)
             victim.getClass().getContainerStore(victim).add(projectile, 1, victim);
 
@@ -41,11 +41,10 @@ namespace MWMechanics
 
         float normalised = max==0 ? 1 : std::max (0.0f, static_cast<float> (current)/max);
 
-        const MWWorld::Store<ESM::GameSetting> &gmst =
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const ESM::GameSettingTable& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable();
 
-        return gmst.find ("fFatigueBase")->getFloat()
-            - gmst.find ("fFatigueMult")->getFloat() * (1-normalised);
+        return gmst.fFatigueBase
+            - gmst.fFatigueMult * (1-normalised);
     }
 
     const AttributeValue &CreatureStats::getAttribute(int index) const
@@ -323,7 +322,7 @@ namespace MWMechanics
         {
             MWWorld::Ptr targetPtr;
             targetPtr = MWBase::Environment::get().getWorld()->getPtr(target, true);
-            return targetPtr.getTypeName() == typeid(ESM::Creature).name();
+            return targetPtr.is<ESM::Creature>();
         }
         return false;
     }
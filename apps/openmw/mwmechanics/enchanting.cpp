@@ -12,6 +12,7 @@ namespace MWMechanics
     Enchanting::Enchanting()
         : mCastStyle(ESM::Enchantment::CastOnce)
         , mSelfEnchanting(false)
+        , mObjectType(0)
     {}
 
     void Enchanting::setOldItem(MWWorld::Ptr oldItem)
@@ -19,12 +20,12 @@ namespace MWMechanics
         mOldItemPtr=oldItem;
         if(!itemEmpty())
         {
-            mObjectType = mOldItemPtr.getTypeName();
+            mObjectType = mOldItemPtr.getType();
             mOldItemId = mOldItemPtr.getCellRef().mRefID;
         }
         else
         {
-            mObjectType="";
+            mObjectType=0;
             mOldItemId="";
         }
     }
@@ -105,8 +106,8 @@ namespace MWMechanics
         }
 
         const bool powerfulSoul = getGemCharge() >= \
-                MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find ("iSoulAmountForConstantEffect")->getInt();
-        if ((mObjectType == typeid(ESM::Armor).name()) || (mObjectType == typeid(ESM::Clothing).name()))
+                MWBase::Environment::get().getWorld()->getStore().getGameSettingTable().iSoulAmountForConstantEffect;
+        if ((mObjectType == ESM::Armor::sRecordId) || (mObjectType == ESM::Clothing::sRecordId))
         { // Armor or Clothing
             switch(mCastStyle)
             {
@@ -119,7 +120,7 @@ namespace MWMechanics
                     return;
             }
         }
-        else if(mObjectType == typeid(ESM::Weapon).name())
+        else if(mObjectType == ESM::Weapon::sRecordId)
         { // Weapon
             switch(mCastStyle)
             {
@@ -137,7 +138,7 @@ namespace MWMechanics
                     return;
             }
         }
-        else if(mObjectType == typeid(ESM::Book).name())
+        else if(mObjectType == ESM::Book::sRecordId)
         { // Scroll or Book
             mCastStyle = ESM::Enchantment::CastOnce;
             return;
@@ -230,7 +231,7 @@ namespace MWMechanics
         if(mEnchanter.isEmpty())
             return 0;
 
-        float priceMultipler = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find ("fEnchantmentValueMult")->getFloat();
+        float priceMultipler = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable().fEnchantmentValueMult;
         int price = MWBase::Environment::get().getMechanicsManager()->getBarterOffer(mEnchanter, (getEnchantPoints() * priceMultipler), true);
         return price;
     }
@@ -253,7 +254,7 @@ namespace MWMechanics
 
         const MWWorld::ESMStore &store = MWBase::Environment::get().getWorld()->getStore();
 
-        return mOldItemPtr.getClass().getEnchantmentPoints(mOldItemPtr) * store.get<ESM::GameSetting>().find("fEnchantmentMult")->getFloat();
+        return mOldItemPtr.getClass().getEnchantmentPoints(mOldItemPtr) * store.getGameSettingTable().fEnchantmentMult;
     }
     bool Enchanting::soulEmpty() const
     {
@@ -283,10 +284,10 @@ namespace MWMechanics
         (0.25 * npcStats.getAttribute (ESM::Attribute::Intelligence).getModified())
         + (0.125 * npcStats.getAttribute (ESM::Attribute::Luck).getModified()));
 
-        const MWWorld::Store<ESM::GameSetting>& gmst = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const ESM::GameSettingTable& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable();
 
-        float chance2 = 7.5 / (gmst.find("fEnchantmentChanceMult")->getFloat() * ((mCastStyle == ESM::Enchantment::ConstantEffect) ?
-                                                                          gmst.find("fEnchantmentConstantChanceMult")->getFloat() : 1 ))
+        float chance2 = 7.5 / (gmst.fEnchantmentChanceMult * ((mCastStyle == ESM::Enchantment::ConstantEffect) ?
+                                                                          gmst.fEnchantmentConstantChanceMult : 1 ))
                 * getEnchantPoints();
 
         return (chance1-chance2);
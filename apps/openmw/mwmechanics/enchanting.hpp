@@ -20,7 +20,7 @@ namespace MWMechanics
             ESM::EffectList mEffectList;
 
             std::string mNewItemName;
-            std::string mObjectType;
+            unsigned int mObjectType; ///< record ID of the item type (0: no item)
             std::string mOldItemId;
 
         public:
@@ -57,14 +57,14 @@ namespace MWMechanics
         try
         {
             MWWorld::ManualRef ref (MWBase::Environment::get().getWorld()->getStore(), item, 1);
-            if (ref.getPtr().getTypeName() != typeid(ESM::ItemLevList).name()
-                    && ref.getPtr().getTypeName() != typeid(ESM::CreatureLevList).name())
+            if (!ref.getPtr().is<ESM::ItemLevList>()
+                    && !ref.getPtr().is<ESM::CreatureLevList>())
             {
                 return item;
             }
             else
             {
-                if (ref.getPtr().getTypeName() == typeid(ESM::ItemLevList).name())
+                if (ref.getPtr().is<ESM::ItemLevList>())
                     return getLevelledItem(ref.getPtr().get<ESM::ItemLevList>()->mBase, failChance);
                 else
                     return getLevelledItem(ref.getPtr().get<ESM::CreatureLevList>()->mBase, failChance);
@@ -460,12 +460,13 @@ namespace MWMechanics
         MWWorld::Ptr playerPtr = MWBase::Environment::get().getWorld()->getPlayerPtr();
         MWWorld::LiveCellRef<ESM::NPC>* player = playerPtr.get<ESM::NPC>();
         const MWMechanics::NpcStats &playerStats = MWWorld::Class::get(playerPtr).getNpcStats(playerPtr);
+        const ESM::GameSettingTable& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable();
 
         if (Misc::StringUtils::ciEqual(npc->mBase->mRace, player->mBase->mRace))
-            x += MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fDispRaceMod")->getFloat();
+            x += gmst.fDispRaceMod;
 
-        x += MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fDispPersonalityMult")->getFloat()
-            * (playerStats.getAttribute(ESM::Attribute::Personality).getModified() - MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fDispPersonalityBase")->getFloat());
+        x += gmst.fDispPersonalityMult
+            * (playerStats.getAttribute(ESM::Attribute::Personality).getModified() - gmst.fDispPersonalityBase);
 
         float reaction = 0;
         int rank = 0;
@@ -503,16 +504,16 @@ namespace MWMechanics
             reaction = 0;
             rank = 0;
         }
-        x += (MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fDispFactionRankMult")->getFloat() * rank
-            + MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fDispFactionRankBase")->getFloat())
-            * MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fDispFactionMod")->getFloat() * reaction;
+        x += (gmst.fDispFactionRankMult * rank
+            + gmst.fDispFactionRankBase)
+            * gmst.fDispFactionMod * reaction;
 
-        x -= MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fDispCrimeMod")->getFloat() * playerStats.getBounty();
+        x -= gmst.fDispCrimeMod * playerStats.getBounty();
         if (playerStats.hasCommonDisease() || playerStats.hasBlightDisease())
-            x += MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fDispDiseaseMod")->getFloat();
+            x += gmst.fDispDiseaseMod;
 
         if (playerStats.getDrawState() == MWMechanics::DrawState_Weapon)
-            x += MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fDispWeaponDrawn")->getFloat();
+            x += gmst.fDispWeaponDrawn;
 
         x += ptr.getClass().getCreatureStats(ptr).getMagicEffects().get(ESM::MagicEffect::Charm).mMagnitude;
 
@@ -522,7 +523,7 @@ namespace MWMechanics
 
     int MechanicsManager::getBarterOffer(const MWWorld::Ptr& ptr,int basePrice, bool buying)
     {
-        if (ptr.getTypeName() == typeid(ESM::Creature).name())
+        if (ptr.is<ESM::Creature>())
             return basePrice;
 
         const MWMechanics::NpcStats &sellerStats = MWWorld::Class::get(ptr).getNpcStats(ptr);
@@ -567,8 +568,7 @@ namespace MWMechanics
     void MechanicsManager::getPersuasionDispositionChange (const MWWorld::Ptr& npc, PersuasionType type,
         float currentTemporaryDispositionDelta, bool& success, float& tempChange, float& permChange)
     {
-        const MWWorld::Store<ESM::GameSetting> &gmst =
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const ESM::GameSettingTable& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable();
 
         MWMechanics::NpcStats& npcStats = MWWorld::Class::get(npc).getNpcStats(npc);
 
@@ -576,13 +576,13 @@ namespace MWMechanics
         const MWMechanics::NpcStats &playerStats = MWWorld::Class::get(playerPtr).getNpcStats(playerPtr);
 
         float persTerm = playerStats.getAttribute(ESM::Attribute::Personality).getModified()
-                            / gmst.find("fPersonalityMod")->getFloat();
+                            / gmst.fPersonalityMod;
 
         float luckTerm = playerStats.getAttribute(ESM::Attribute::Luck).getModified()
-                            / gmst.find("fLuckMod")->getFloat();
+                            / gmst.fLuckMod;
 
-        float repTerm = playerStats.getReputation() * gmst.find("fReputationMod")->getFloat();
-        float levelTerm = playerStats.getLevel() * gmst.find("fLevelMod")->getFloat();
+        float repTerm = playerStats.getReputation() * gmst.fReputationMod;
+        float levelTerm = playerStats.getLevel() * gmst.fLevelMod;
 
         float fatigueTerm = playerStats.getFatigueTerm();
 
@@ -601,16 +601,16 @@ namespace MWMechanics
         float target2 = d * (playerRating2 - npcRating2 + 50);
 
         float bribeMod;
-        if (type == PT_Bribe10) bribeMod = gmst.find("fBribe10Mod")->getFloat();
-        else if (type == PT_Bribe100) bribeMod = gmst.find("fBribe100Mod")->getFloat();
-        else bribeMod = gmst.find("fBribe1000Mod")->getFloat();
+        if (type == PT_Bribe10) bribeMod = gmst.fBribe10Mod;
+        else if (type == PT_Bribe100) bribeMod = gmst.fBribe100Mod;
+        else bribeMod = gmst.fBribe1000Mod;
 
         float target3 = d * (playerRating3 - npcRating3 + 50) + bribeMod;
 
-        float iPerMinChance = gmst.find("iPerMinChance")->getInt();
-        float iPerMinChange = gmst.find("iPerMinChange")->getInt();
-        float fPerDieRollMult = gmst.find("fPerDieRollMult")->getFloat();
-        float fPerTempMult = gmst.find("fPerTempMult")->getFloat();
+        float iPerMinChance = gmst.iPerMinChance;
+        float iPerMinChange = gmst.iPerMinChange;
+        float fPerDieRollMult = gmst.fPerDieRollMult;
+        float fPerTempMult = gmst.fPerTempMult;
 
         float x = 0;
         float y = 0;
@@ -804,22 +804,30 @@ namespace MWMechanics
         if (ptr.getRefData().getHandle() != "player")
             return false;
 
-        bool reported=false;
+        std::vector<MWWorld::Ptr> observers;
         for (Actors::PtrControllerMap::const_iterator it = mActors.begin(); it != mActors.end(); ++it)
+            if (it->first != ptr)
+                observers.push_back(it->first);
+
+        std::vector<bool> lineOfSight;
+        MWBase::Environment::get().getWorld()->getLOS(ptr, observers, lineOfSight);
+
+        bool reported=false;
+        for (std::size_t i = 0; i < observers.size(); ++i)
         {
-            if (it->first != ptr &&
-                    MWBase::Environment::get().getWorld()->getLOS(ptr, it->first) &&
-                    awarenessCheck(ptr, it->first))
+            const MWWorld::Ptr& observer = observers[i];
+
+            if (lineOfSight[i] && awarenessCheck(ptr, observer))
             {
                 // NPCs will always curse you when they notice you steal their items, even if they don't report the crime
-                if (it->first == victim && type == OT_Theft)
+                if (observer == victim && type == OT_Theft)
                 {
                     MWBase::Environment::get().getDialogueManager()->say(victim, "Thief");
                 }
 
                 // Actor has witnessed a crime. Will he report it?
                 // (not sure, is > 0 correct?)
-                if (it->first.getClass().getCreatureStats(it->first).getAiSetting(CreatureStats::AI_Alarm).getModified() > 0)
+                if (observer.getClass().getCreatureStats(observer).getAiSetting(CreatureStats::AI_Alarm).getModified() > 0)
                 {
                     // TODO: stats.setAlarmed(true) on NPCs within earshot
                     // fAlarmRadius ?
@@ -836,18 +844,18 @@ namespace MWMechanics
 
     void MechanicsManager::reportCrime(const MWWorld::Ptr &ptr, const MWWorld::Ptr &victim, OffenseType type, int arg)
     {
-        const MWWorld::Store<ESM::GameSetting>& store = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const ESM::GameSettingTable& store = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable();
         // Bounty for each type of crime
         if (type == OT_Trespassing || type == OT_SleepingInOwnedBed)
-            arg = store.find("iCrimeTresspass")->getInt();
+            arg = store.iCrimeTresspass;
         else if (type == OT_Pickpocket)
-            arg = store.find("iCrimePickPocket")->getInt();
+            arg = store.iCrimePickPocket;
         else if (type == OT_Assault)
-            arg = store.find("iCrimeAttack")->getInt();
+            arg = store.iCrimeAttack;
         else if (type == OT_Murder)
-            arg = store.find("iCrimeKilling")->getInt();
+            arg = store.iCrimeKilling;
         else if (type == OT_Theft)
-            arg *= store.find("fCrimeStealing")->getFloat();
+            arg *= store.fCrimeStealing;
 
         // TODO: In some cases (type == Assault), if no NPCs are within earshot, the report will have no effect.
         // however other crime types seem to be always produce a bounty.
@@ -861,15 +869,15 @@ namespace MWMechanics
             int fight = 0;
             // Increase in fight rating for each type of crime
             if (type == OT_Trespassing || type == OT_SleepingInOwnedBed)
-                fight = store.find("iFightTrespass")->getFloat();
+                fight = store.iFightTrespass;
             else if (type == OT_Pickpocket)
-                fight = store.find("iFightPickpocket")->getInt();
+                fight = store.iFightPickpocket;
             else if (type == OT_Assault)
-                fight = store.find("iFightAttack")->getInt();
+                fight = store.iFightAttack;
             else if (type == OT_Murder)
-                fight = store.find("iFightKilling")->getInt();
+                fight = store.iFightKilling;
             else if (type == OT_Theft)
-                fight = store.find("fFightStealing")->getFloat();
+                fight = store.fFightStealing;
             // Not sure if this should be permanent?
             fight = victim.getClass().getCreatureStats(victim).getAiSetting(CreatureStats::AI_Fight).getBase() + fight;
             victim.getClass().getCreatureStats(victim).setAiSetting(CreatureStats::AI_Fight, fight);
@@ -895,7 +903,7 @@ namespace MWMechanics
         if (observer.getClass().getCreatureStats(observer).isDead())
             return false;
 
-        const MWWorld::Store<ESM::GameSetting>& store = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const ESM::GameSettingTable& store = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable();
 
         CreatureStats& stats = ptr.getClass().getCreatureStats(ptr);
 
@@ -908,8 +916,8 @@ namespace MWMechanics
                 && !MWBase::Environment::get().getWorld()->isSwimming(ptr)
                 && MWBase::Environment::get().getWorld()->isOnGround(ptr))
         {
-            static float fSneakSkillMult = store.find("fSneakSkillMult")->getFloat();
-            static float fSneakBootMult = store.find("fSneakBootMult")->getFloat();
+            float fSneakSkillMult = store.fSneakSkillMult;
+            float fSneakBootMult = store.fSneakBootMult;
             float sneak = ptr.getClass().getSkill(ptr, ESM::Skill::Sneak);
             int agility = stats.getAttribute(ESM::Attribute::Agility).getModified();
             int luck = stats.getAttribute(ESM::Attribute::Luck).getModified();
@@ -924,8 +932,8 @@ namespace MWMechanics
             sneakTerm = fSneakSkillMult * sneak + 0.2 * agility + 0.1 * luck + bootWeight * fSneakBootMult;
         }
 
-        static float fSneakDistBase = store.find("fSneakDistanceBase")->getFloat();
-        static float fSneakDistMult = store.find("fSneakDistanceMultiplier")->getFloat();
+        float fSneakDistBase = store.fSneakDistanceBase;
+        float fSneakDistMult = store.fSneakDistanceMultiplier;
 
         Ogre::Vector3 pos1 (ptr.getRefData().getPosition().pos);
         Ogre::Vector3 pos2 (observer.getRefData().getPosition().pos);
@@ -943,8 +951,8 @@ namespace MWMechanics
         float obsTerm = obsSneak + 0.2 * obsAgility + 0.1 * obsLuck - obsBlind;
 
         // is ptr behind the observer?
-        static float fSneakNoViewMult = store.find("fSneakNoViewMult")->getFloat();
-        static float fSneakViewMult = store.find("fSneakViewMult")->getFloat();
+        float fSneakNoViewMult = store.fSneakNoViewMult;
+        float fSneakViewMult = store.fSneakViewMult;
         float y = 0;
         Ogre::Vector3 vec = pos1 - pos2;
         Ogre::Radian angle = observer.getRefData().getBaseNode()->getOrientation().yAxis().angleBetween(vec);
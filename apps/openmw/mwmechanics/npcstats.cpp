@@ -24,6 +24,19 @@
 #include "../mwbase/windowmanager.hpp"
 #include "../mwbase/soundmanager.hpp"
 
+namespace
+{
+    /// Report a skill gain factor GMST that the GMST table holds as <= 0.
+    ///
+    /// The table holds a missing GMST as 0, so the GMST is looked up in the store first, which
+    /// reports a missing GMST as such.
+    void throwInvalidFactor (const char *id, const char *error)
+    {
+        MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find (id);
+        throw std::runtime_error (error);
+    }
+}
+
 MWMechanics::NpcStats::NpcStats()
     : mBounty (0)
 , mLevelProgress(0)
@@ -131,15 +144,16 @@ float MWMechanics::NpcStats::getSkillGain (int skillIndex, const ESM::Class& cla
             return 0;
     }
 
-    const MWWorld::Store<ESM::GameSetting> &gmst =
-        MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+    const ESM::GameSettingTable& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable();
 
-    float typeFactor = gmst.find ("fMiscSkillBonus")->getFloat();
+    float typeFactor = gmst.fMiscSkillBonus;
+    const char *typeFactorId = "fMiscSkillBonus";
 
     for (int i=0; i<5; ++i)
         if (class_.mData.mSkills[i][0]==skillIndex)
         {
-            typeFactor = gmst.find ("fMinorSkillBonus")->getFloat();
+            typeFactor = gmst.fMinorSkillBonus;
+            typeFactorId = "fMinorSkillBonus";
 
             break;
         }
@@ -147,22 +161,23 @@ float MWMechanics::NpcStats::getSkillGain (int skillIndex, const ESM::Class& cla
     for (int i=0; i<5; ++i)
         if (class_.mData.mSkills[i][1]==skillIndex)
         {
-            typeFactor = gmst.find ("fMajorSkillBonus")->getFloat();
+            typeFactor = gmst.fMajorSkillBonus;
+            typeFactorId = "fMajorSkillBonus";
 
             break;
         }
 
     if (typeFactor<=0)
-        throw std::runtime_error ("invalid skill type factor");
+        throwInvalidFactor (typeFactorId, "invalid skill type factor");
 
     float specialisationFactor = 1;
 
     if (skill->mData.mSpecialization==class_.mData.mSpecialization)
     {
-        specialisationFactor = gmst.find ("fSpecialSkillBonus")->getFloat();
+        specialisationFactor = gmst.fSpecialSkillBonus;
 
         if (specialisationFactor<=0)
-            throw std::runtime_error ("invalid skill specialisation factor");
+            throwInvalidFactor ("fSpecialSkillBonus", "invalid skill specialisation factor");
     }
     return 1.0 / ((level+1) * (1.0/skillFactor) * typeFactor * specialisationFactor);
 }
@@ -193,25 +208,24 @@ void MWMechanics::NpcStats::increaseSkill(int skillIndex, const ESM::Class &clas
 
     base += 1;
 
-    const MWWorld::Store<ESM::GameSetting> &gmst =
-        MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+    const ESM::GameSettingTable& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable();
 
     // is this a minor or major skill?
-    int increase = gmst.find("iLevelupMiscMultAttriubte")->getInt(); // Note: GMST has a typo
+    int increase = gmst.iLevelupMiscMultAttriubte; // Note: GMST has a typo
     for (int k=0; k<5; ++k)
     {
         if (class_.mData.mSkills[k][0] == skillIndex)
         {
-            mLevelProgress += gmst.find("iLevelUpMinorMult")->getInt();
-            increase = gmst.find("iLevelUpMajorMultAttribute")->getInt();
+            mLevelProgress += gmst.iLevelUpMinorMult;
+            increase = gmst.iLevelUpMajorMultAttribute;
         }
     }
     for (int k=0; k<5; ++k)
     {
         if (class_.mData.mSkills[k][1] == skillIndex)
         {
-            mLevelProgress += gmst.find("iLevelUpMajorMult")->getInt();
-            increase = gmst.find("iLevelUpMinorMultAttribute")->getInt();
+            mLevelProgress += gmst.iLevelUpMajorMult;
+            increase = gmst.iLevelUpMinorMultAttribute;
         }
     }
 
@@ -231,7 +245,7 @@ void MWMechanics::NpcStats::increaseSkill(int skillIndex, const ESM::Class &clas
                % static_cast<int> (base);
     MWBase::Environment::get().getWindowManager ()->messageBox(message.str(), noButtons, MWGui::ShowInDialogueMode_Never);
 
-    if (mLevelProgress >= gmst.find("iLevelUpTotal")->getInt())
+    if (mLevelProgress >= gmst.iLevelUpTotal)
     {
         // levelup is possible now
         MWBase::Environment::get().getWindowManager ()->messageBox ("#{sLevelUpMsg}", noButtons, MWGui::ShowInDialogueMode_Never);
@@ -253,15 +267,14 @@ void MWMechanics::NpcStats::levelUp()
     for (int i=0; i<ESM::Attribute::Length; ++i)
         mSkillIncreases[i] = 0;
 
-    const MWWorld::Store<ESM::GameSetting> &gmst =
-        MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+    const ESM::GameSettingTable& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable();
 
     const int endurance = getAttribute(ESM::Attribute::Endurance).getBase();
 
     // "When you gain a level, in addition to increasing three primary attributes, your Health
     // will automatically increase by 10% of your Endurance attribute. If you increased Endurance this level,
     // the Health increase is calculated from the increased Endurance"
-    mLevelHealthBonus += endurance * gmst.find("fLevelUpHealthEndMult")->getFloat();
+    mLevelHealthBonus += endurance * gmst.fLevelUpHealthEndMult;
     updateHealth();
 
     setLevel(getLevel()+1);
@@ -304,7 +317,7 @@ bool MWMechanics::NpcStats::hasBeenUsed (const std::string& id) const
 int MWMechanics::NpcStats::getBounty() const
 {
     if (mIsWerewolf)
-        return MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("iWereWolfBounty")->getInt();
+        return MWBase::Environment::get().getWorld()->getStore().getGameSettingTable().iWereWolfBounty;
     else
         return mBounty;
 }
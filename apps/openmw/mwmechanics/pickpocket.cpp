@@ -34,10 +34,8 @@ namespace MWMechanics
         float t = 2*x - y;
 
         float pcSneak = mThief.getClass().getSkill(mThief, ESM::Skill::Sneak);
-        int iPickMinChance = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>()
-                .find("iPickMinChance")->getInt();
-        int iPickMaxChance = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>()
-                .find("iPickMaxChance")->getInt();
+        int iPickMinChance = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable().iPickMinChance;
+        int iPickMaxChance = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable().iPickMaxChance;
 
         int roll = std::rand()/ (static_cast<double> (RAND_MAX) + 1) * 100; // [0, 99]
         if (t < pcSneak / iPickMinChance)
@@ -54,8 +52,7 @@ namespace MWMechanics
     bool Pickpocket::pick(MWWorld::Ptr item, int count)
     {
         float stackValue = item.getClass().getValue(item) * count;
-        float fPickPocketMod = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>()
-                .find("fPickPocketMod")->getFloat();
+        float fPickPocketMod = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable().fPickPocketMod;
         float valueTerm = 10 * fPickPocketMod * stackValue;
 
         return getDetected(valueTerm);
@@ -39,8 +39,7 @@ void Repair::repair(const MWWorld::Ptr &itemToRepair)
     int pcLuck = stats.getAttribute(ESM::Attribute::Luck).getModified();
     int armorerSkill = npcStats.getSkill(ESM::Skill::Armorer).getModified();
 
-    float fRepairAmountMult = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>()
-            .find("fRepairAmountMult")->getFloat();
+    float fRepairAmountMult = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable().fRepairAmountMult;
 
     float toolQuality = ref->mBase->mData.mQuality;
 
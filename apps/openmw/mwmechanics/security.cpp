@@ -36,7 +36,7 @@ namespace MWMechanics
 
         float pickQuality = lockpick.get<ESM::Lockpick>()->mBase->mData.mQuality;
 
-        float fPickLockMult = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fPickLockMult")->getFloat();
+        float fPickLockMult = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable().fPickLockMult;
 
         float x = 0.2 * mAgility + 0.1 * mLuck + mSecuritySkill;
         x *= pickQuality * mFatigueTerm;
@@ -78,7 +78,7 @@ namespace MWMechanics
         const ESM::Spell* trapSpell = MWBase::Environment::get().getWorld()->getStore().get<ESM::Spell>().find(trap.getCellRef().mTrap);
         float trapSpellPoints = trapSpell->mData.mCost;
 
-        float fTrapCostMult = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fTrapCostMult")->getFloat();
+        float fTrapCostMult = MWBase::Environment::get().getWorld()->getStore().getGameSettingTable().fTrapCostMult;
 
         float x = 0.2 * mAgility + 0.1 * mLuck + mSecuritySkill;
         x += fTrapCostMult * trapSpellPoints;
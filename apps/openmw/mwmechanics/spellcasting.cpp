@@ -452,7 +452,7 @@ namespace MWMechanics
             }
             else if (effectId == ESM::MagicEffect::DamageSkill || effectId == ESM::MagicEffect::RestoreSkill)
             {
-                if (target.getTypeName() != typeid(ESM::NPC).name())
+                if (!target.is<ESM::NPC>())
                     return;
                 int skill = effect.mArg;
                 SkillValue& value = target.getClass().getNpcStats(target).getSkill(skill);
@@ -620,8 +620,8 @@ namespace MWMechanics
             CreatureStats& stats = mCaster.getClass().getCreatureStats(mCaster);
 
             // Reduce fatigue (note that in the vanilla game, both GMSTs are 0, and there's no fatigue loss)
-            static const float fFatigueSpellBase = store.get<ESM::GameSetting>().find("fFatigueSpellBase")->getFloat();
-            static const float fFatigueSpellMult = store.get<ESM::GameSetting>().find("fFatigueSpellMult")->getFloat();
+            const float fFatigueSpellBase = store.getGameSettingTable().fFatigueSpellBase;
+            const float fFatigueSpellMult = store.getGameSettingTable().fFatigueSpellMult;
             DynamicStat<float> fatigue = stats.getFatigue();
             const float normalizedEncumbrance = mCaster.getClass().getEncumbrance(mCaster) / mCaster.getClass().getCapacity(mCaster);
             float fatigueLoss = spell->mData.mCost * (fFatigueSpellBase + normalizedEncumbrance * fFatigueSpellMult);
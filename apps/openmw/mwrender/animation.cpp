@@ -22,6 +22,8 @@
 
 #include <extern/shiny/Main/Factory.hpp>
 
+#include <components/settings/settings.hpp>
+
 #include "../mwbase/environment.hpp"
 #include "../mwbase/soundmanager.hpp"
 #include "../mwbase/world.hpp"
@@ -36,6 +38,12 @@
 
 #include "renderconst.hpp"
 
+namespace
+{
+    const Settings::IntSetting sSmallObjectSize ("small object size", "Viewing distance");
+    const Settings::BoolSetting sLimitSmallObjectDistance ("limit small object distance", "Viewing distance");
+    const Settings::IntSetting sSmallObjectDistance ("small object distance", "Viewing distance");
+}
 
 namespace MWRender
 {
@@ -1255,15 +1263,14 @@ ObjectAnimation::ObjectAnimation(const MWWorld::Ptr& ptr, const std::string &mod
     Ogre::Vector3 extents = getWorldBounds().getSize();
     float size = std::max(std::max(extents.x, extents.y), extents.z);
 
-    bool small = (size < Settings::Manager::getInt("small object size", "Viewing distance")) &&
-                 Settings::Manager::getBool("limit small object distance", "Viewing distance");
+    bool small = (size < sSmallObjectSize.get()) && sLimitSmallObjectDistance.get();
     // do not fade out doors. that will cause holes and look stupid
-    if(ptr.getTypeName().find("Door") != std::string::npos)
+    if(ptr.is<ESM::Door>())
         small = false;
 
-    float dist = small ? Settings::Manager::getInt("small object distance", "Viewing distance") : 0.0f;
+    float dist = small ? sSmallObjectDistance.get() : 0.0f;
     Ogre::Vector3 col = getEnchantmentColor(ptr);
-    setRenderProperties(mObjectRoot, (mPtr.getTypeName() == typeid(ESM::Static).name()) ?
+    setRenderProperties(mObjectRoot, (mPtr.is<ESM::Static>()) ?
                                      (small ? RV_StaticsSmall : RV_Statics) : RV_Misc,
                         RQG_Main, RQG_Alpha, dist, !ptr.getClass().getEnchantment(ptr).empty(), &col);
 }
@@ -26,6 +26,14 @@
 
 using namespace MWRender;
 
+namespace
+{
+    const Settings::IntSetting sSmallObjectSize ("small object size", "Viewing distance");
+    const Settings::BoolSetting sLimitSmallObjectDistance ("limit small object distance", "Viewing distance");
+    const Settings::IntSetting sSmallObjectDistance ("small object distance", "Viewing distance");
+    const Settings::BoolSetting sUseStaticGeometry ("use static geometry", "Objects");
+}
+
 int Objects::uniqueID = 0;
 
 void Objects::setRootNode(Ogre::SceneNode* root)
@@ -84,21 +92,20 @@ void Objects::insertModel(const MWWorld::Ptr &ptr, const std::string &mesh)
     extents *= ptr.getRefData().getBaseNode()->getScale();
     float size = std::max(std::max(extents.x, extents.y), extents.z);
 
-    bool small = (size < Settings::Manager::getInt("small object size", "Viewing distance")) &&
-                 Settings::Manager::getBool("limit small object distance", "Viewing distance");
+    bool small = (size < sSmallObjectSize.get()) && sLimitSmallObjectDistance.get();
     // do not fade out doors. that will cause holes and look stupid
-    if(ptr.getTypeName().find("Door") != std::string::npos)
+    if(ptr.is<ESM::Door>())
         small = false;
 
     if (mBounds.find(ptr.getCell()) == mBounds.end())
         mBounds[ptr.getCell()] = Ogre::AxisAlignedBox::BOX_NULL;
     mBounds[ptr.getCell()].merge(bounds);
 
-    if(ptr.getTypeName() == typeid(ESM::Light).name())
+    if(ptr.is<ESM::Light>())
         anim->addLight(ptr.get<ESM::Light>()->mBase);
 
-    if(ptr.getTypeName() == typeid(ESM::Static).name() &&
-       Settings::Manager::getBool("use static geometry", "Objects") &&
+    if(ptr.is<ESM::Static>() &&
+       sUseStaticGeometry.get() &&
        anim->canBatch())
     {
         Ogre::StaticGeometry* sg = 0;
@@ -112,7 +119,7 @@ void Objects::insertModel(const MWWorld::Ptr &ptr, const std::string &mesh)
                 sg->setOrigin(ptr.getRefData().getBaseNode()->getPosition());
                 mStaticGeometrySmall[ptr.getCell()] = sg;
 
-                sg->setRenderingDistance(Settings::Manager::getInt("small object distance", "Viewing distance"));
+                sg->setRenderingDistance(sSmallObjectDistance.get());
             }
             else
                 sg = mStaticGeometrySmall[ptr.getCell()];
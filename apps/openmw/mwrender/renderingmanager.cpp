@@ -50,6 +50,14 @@
 using namespace MWRender;
 using namespace Ogre;
 
+namespace
+{
+    // used by configureFog, which runs whenever the weather changes the fog
+    const Settings::FloatSetting sMaxViewingDistance ("max viewing distance", "Viewing distance");
+    const Settings::FloatSetting sFogStartFactor ("fog start factor", "Viewing distance");
+    const Settings::FloatSetting sFogEndFactor ("fog end factor", "Viewing distance");
+}
+
 namespace MWRender {
 
 RenderingManager::RenderingManager(OEngine::Render::OgreRenderer& _rend, const boost::filesystem::path& resDir,
@@ -511,12 +519,12 @@ void RenderingManager::configureFog(MWWorld::CellStore &mCell)
 void RenderingManager::configureFog(const float density, const Ogre::ColourValue& colour)
 {
     mFogColour = colour;
-    float max = Settings::Manager::getFloat("max viewing distance", "Viewing distance");
+    float max = sMaxViewingDistance.get();
 
-    mFogStart = max / (density) * Settings::Manager::getFloat("fog start factor", "Viewing distance");
-    mFogEnd = max / (density) * Settings::Manager::getFloat("fog end factor", "Viewing distance");
+    mFogStart = max / (density) * sFogStartFactor.get();
+    mFogEnd = max / (density) * sFogEndFactor.get();
 
-    mRendering.getCamera()->setFarClipDistance ( Settings::Manager::getFloat("max viewing distance", "Viewing distance") / density );
+    mRendering.getCamera()->setFarClipDistance ( max / density );
 }
 
 void RenderingManager::applyFog (bool underwater)
@@ -234,7 +234,7 @@ namespace MWScript
                     MWWorld::InventoryStore& invStore = MWWorld::Class::get(ptr).getInventoryStore (ptr);
 
                     MWWorld::ContainerStoreIterator it = invStore.getSlot (slot);
-                    if (it == invStore.end() || it->getTypeName () != typeid(ESM::Armor).name())
+                    if (it == invStore.end() || !it->is<ESM::Armor>())
                     {
                         runtime.push(-1);
                         return;
@@ -316,7 +316,7 @@ namespace MWScript
 
                     MWWorld::InventoryStore& invStore = MWWorld::Class::get(ptr).getInventoryStore (ptr);
                     MWWorld::ContainerStoreIterator it = invStore.getSlot (MWWorld::InventoryStore::Slot_CarriedRight);
-                    if (it == invStore.end() || it->getTypeName () != typeid(ESM::Weapon).name())
+                    if (it == invStore.end() || !it->is<ESM::Weapon>())
                     {
                         runtime.push(-1);
                         return;
@@ -3,7 +3,6 @@
 
 #include <cassert>
 #include <iostream>
-#include <sstream>
 #include <exception>
 
 #include <components/esm/loadscpt.hpp>
@@ -44,9 +43,10 @@ namespace MWScript
 
             try
             {
-                std::istringstream input (script->mScriptText);
+                const std::string& text = script->mScriptText;
 
-                Compiler::Scanner scanner (mErrorHandler, input, mCompilerContext.getExtensions());
+                Compiler::Scanner scanner (mErrorHandler, text.c_str(), text.c_str()+text.size(),
+                    mCompilerContext.getExtensions());
 
                 scanner.scan (mParser);
 
@@ -164,9 +164,10 @@ namespace MWScript
         {
             Compiler::Locals locals;
 
-            std::istringstream stream (script->mScriptText);
+            const std::string& text = script->mScriptText;
             Compiler::QuickFileParser parser (mErrorHandler, mCompilerContext, locals);
-            Compiler::Scanner scanner (mErrorHandler, stream, mCompilerContext.getExtensions());
+            Compiler::Scanner scanner (mErrorHandler, text.c_str(), text.c_str()+text.size(),
+                mCompilerContext.getExtensions());
             scanner.scan (parser);
 
             std::map<std::string, Compiler::Locals>::iterator iter =
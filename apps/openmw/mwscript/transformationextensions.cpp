@@ -310,7 +310,7 @@ namespace MWScript
                         MWBase::Environment::get().getWorld()->moveObject(ptr,store,x,y,z);
                         float ax = Ogre::Radian(ptr.getRefData().getPosition().rot[0]).valueDegrees();
                         float ay = Ogre::Radian(ptr.getRefData().getPosition().rot[1]).valueDegrees();
-                        if(ptr.getTypeName() == typeid(ESM::NPC).name())//some morrowind oddity
+                        if(ptr.is<ESM::NPC>())//some morrowind oddity
                         {
                             ax = ax/60.;
                             ay = ay/60.;
@@ -358,7 +358,7 @@ namespace MWScript
                         MWBase::Environment::get().getWorld()->getExterior(cx,cy),x,y,z);
                     float ax = Ogre::Radian(ptr.getRefData().getPosition().rot[0]).valueDegrees();
                     float ay = Ogre::Radian(ptr.getRefData().getPosition().rot[1]).valueDegrees();
-                    if(ptr.getTypeName() == typeid(ESM::NPC).name())//some morrowind oddity
+                    if(ptr.is<ESM::NPC>())//some morrowind oddity
                     {
                         ax = ax/60.;
                         ay = ay/60.;
@@ -1,9 +1,8 @@
 #ifndef GAME_MWWORLD_CELLREFLIST_H
 #define GAME_MWWORLD_CELLREFLIST_H
 
-#include <list>
-
 #include "livecellref.hpp"
+#include "cellrefpool.hpp"
 
 namespace MWWorld
 {
@@ -12,7 +11,7 @@ namespace MWWorld
     struct CellRefList
     {
         typedef LiveCellRef<X> LiveRef;
-        typedef std::list<LiveRef> List;
+        typedef CellRefPool<LiveRef> List;
         List mList;
 
         /// Search for the given reference in the given reclist from
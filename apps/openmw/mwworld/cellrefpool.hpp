@@ -0,0 +1,180 @@
+#ifndef GAME_MWWORLD_CELLREFPOOL_H
+#define GAME_MWWORLD_CELLREFPOOL_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace MWWorld
+{
+    /// \brief Append-only storage for references, organised in fixed-size blocks
+    ///
+    /// Blocks are never moved or reallocated once created, so pointers to stored references
+    /// (and therefore Ptrs) stay valid for the lifetime of the pool. Iterators are index-based
+    /// and stay valid when new references are appended. Neighbouring references share a block,
+    /// which keeps iteration over a cell or a container cache-friendly compared to a linked list.
+    template<typename T, std::size_t BlockSize = 16>
+    class CellRefPool
+    {
+        public:
+
+            template<typename Pool, typename Value>
+            class IteratorBase : public std::iterator<std::bidirectional_iterator_tag, Value>
+            {
+                    Pool *mPool;
+                    std::size_t mIndex;
+
+                public:
+
+                    IteratorBase() : mPool (0), mIndex (0) {}
+
+                    IteratorBase (Pool *pool, std::size_t index) : mPool (pool), mIndex (index) {}
+
+                    /// Allows conversion from iterator to const_iterator (but not the other way
+                    /// around).
+                    template<typename Pool2, typename Value2>
+                    IteratorBase (const IteratorBase<Pool2, Value2>& iter)
+                    : mPool (iter.getPool()), mIndex (iter.getIndex())
+                    {}
+
+                    Pool *getPool() const { return mPool; }
+
+                    std::size_t getIndex() const { return mIndex; }
+
+                    Value& operator*() const { return (*mPool)[mIndex]; }
+
+                    Value *operator->() const { return &(*mPool)[mIndex]; }
+
+                    IteratorBase& operator++() { ++mIndex; return *this; }
+
+                    IteratorBase operator++ (int)
+                    {
+                        IteratorBase iter (*this);
+                        ++mIndex;
+                        return iter;
+                    }
+
+                    IteratorBase& operator--() { --mIndex; return *this; }
+
+                    IteratorBase operator-- (int)
+                    {
+                        IteratorBase iter (*this);
+                        --mIndex;
+                        return iter;
+                    }
+
+                    bool operator== (const IteratorBase& iter) const
+                    {
+                        return mPool==iter.mPool && mIndex==iter.mIndex;
+                    }
+
+                    bool operator!= (const IteratorBase& iter) const
+                    {
+                        return !(*this==iter);
+                    }
+            };
+
+            typedef T value_type;
+            typedef std::size_t size_type;
+            typedef IteratorBase<CellRefPool, T> iterator;
+            typedef IteratorBase<const CellRefPool, const T> const_iterator;
+
+        private:
+
+            std::vector<T *> mBlocks;
+            std::size_t mSize;
+            std::allocator<T> mAllocator;
+
+        public:
+
+            CellRefPool() : mSize (0) {}
+
+            CellRefPool (const CellRefPool& pool) : mSize (0)
+            {
+                mBlocks.reserve (pool.mBlocks.size());
+
+                for (const_iterator iter (pool.begin()); iter!=pool.end(); ++iter)
+                    push_back (*iter);
+            }
+
+            ~CellRefPool()
+            {
+                clear();
+            }
+
+            CellRefPool& operator= (const CellRefPool& pool)
+            {
+                if (this!=&pool)
+                {
+                    CellRefPool copy (pool);
+                    swap (copy);
+                }
+
+                return *this;
+            }
+
+            void swap (CellRefPool& pool)
+            {
+                mBlocks.swap (pool.mBlocks);
+                std::swap (mSize, pool.mSize);
+            }
+
+            T& operator[] (std::size_t index)
+            {
+                return mBlocks[index / BlockSize][index % BlockSize];
+            }
+
+            const T& operator[] (std::size_t index) const
+            {
+                return mBlocks[index / BlockSize][index % BlockSize];
+            }
+
+            void push_back (const T& item)
+            {
+                if (mSize==mBlocks.size()*BlockSize)
+                    mBlocks.push_back (mAllocator.allocate (BlockSize));
+
+                mAllocator.construct (&(*this)[mSize], item);
+                ++mSize;
+            }
+
+            /// Destroy all references and release the blocks.
+            ///
+            /// \attention Invalidates all pointers into the pool.
+            void clear()
+            {
+                for (std::size_t i=0; i<mSize; ++i)
+                    mAllocator.destroy (&(*this)[i]);
+
+                for (typename std::vector<T *>::iterator iter (mBlocks.begin());
+                    iter!=mBlocks.end(); ++iter)
+                    mAllocator.deallocate (*iter, BlockSize);
+
+                mBlocks.clear();
+                mSize = 0;
+            }
+
+            std::size_t size() const { return mSize; }
+
+            bool empty() const { return mSize==0; }
+
+            T& front() { return (*this)[0]; }
+
+            const T& front() const { return (*this)[0]; }
+
+            T& back() { return (*this)[mSize-1]; }
+
+            const T& back() const { return (*this)[mSize-1]; }
+
+            iterator begin() { return iterator (this, 0); }
+
+            iterator end() { return iterator (this, mSize); }
+
+            const_iterator begin() const { return const_iterator (this, 0); }
+
+            const_iterator end() const { return const_iterator (this, mSize); }
+    };
+}
+
+#endif
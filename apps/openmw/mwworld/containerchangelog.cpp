@@ -0,0 +1,48 @@
+#include "containerchangelog.hpp"
+
+namespace MWWorld
+{
+    ContainerChangeLog::Serial ContainerChangeLog::sSerial = 0;
+
+    ContainerChangeLog::ContainerChangeLog() : mFirst (++sSerial) {}
+
+    ContainerChangeLog::ContainerChangeLog (const ContainerChangeLog& log) : mFirst (++sSerial) {}
+
+    ContainerChangeLog& ContainerChangeLog::operator= (const ContainerChangeLog& log)
+    {
+        reset();
+        return *this;
+    }
+
+    void ContainerChangeLog::add (const Ptr& stack)
+    {
+        mChanges.push_back (std::make_pair (++sSerial, stack));
+
+        if (mChanges.size()>sCapacity)
+        {
+            mFirst = mChanges.front().first;
+            mChanges.pop_front();
+        }
+    }
+
+    void ContainerChangeLog::reset()
+    {
+        mChanges.clear();
+        mFirst = ++sSerial;
+    }
+
+    bool ContainerChangeLog::getChanges (Serial& since, std::vector<Ptr>& changed) const
+    {
+        bool complete = since>=mFirst;
+
+        if (complete)
+            for (std::deque<std::pair<Serial, Ptr> >::const_iterator iter (mChanges.begin());
+                iter!=mChanges.end(); ++iter)
+                if (iter->first>since)
+                    changed.push_back (iter->second);
+
+        since = sSerial;
+
+        return complete;
+    }
+}
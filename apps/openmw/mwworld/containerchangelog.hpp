@@ -0,0 +1,60 @@
+#ifndef GAME_MWWORLD_CONTAINERCHANGELOG_H
+#define GAME_MWWORLD_CONTAINERCHANGELOG_H
+
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include "ptr.hpp"
+
+namespace MWWorld
+{
+    /// \brief Bounded log of the item stacks of a container that have been created or have
+    /// changed their count
+    ///
+    /// Lets item views catch up with a container incrementally instead of rebuilding their item
+    /// lists. Changes are numbered with serials that are unique across all logs. If a consumer has
+    /// fallen too far behind, the log has been reset or the container has been replaced, the
+    /// consumer is told to rebuild instead.
+    ///
+    /// A copy of a log is a new, empty log (the logged stacks belong to the original container).
+    class ContainerChangeLog
+    {
+        public:
+
+            typedef unsigned int Serial;
+
+        private:
+
+            static const std::size_t sCapacity = 64;
+
+            static Serial sSerial;
+
+            std::deque<std::pair<Serial, Ptr> > mChanges;
+            Serial mFirst; ///< all changes with a higher serial are in mChanges
+
+        public:
+
+            ContainerChangeLog();
+
+            ContainerChangeLog (const ContainerChangeLog& log);
+
+            ContainerChangeLog& operator= (const ContainerChangeLog& log);
+
+            void add (const Ptr& stack);
+            ///< Log a stack that has been created or has changed its count.
+
+            void reset();
+            ///< Drop all logged changes and force all consumers to rebuild (e.g. after a bulk
+            /// change of the container).
+
+            bool getChanges (Serial& since, std::vector<Ptr>& changed) const;
+            ///< Append the stacks that have been logged after \a since to \a changed and update
+            /// \a since. A stack can be listed more than once.
+            ///
+            /// \param since Use 0 for a consumer that has not seen this log yet.
+            /// \return Could the changes be provided? If not, the consumer needs to rebuild.
+    };
+}
+
+#endif
@@ -249,6 +249,7 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::addImp (const Ptr& ptr,
             if (Misc::StringUtils::ciEqual((*iter).getCellRef().mRefID, MWWorld::ContainerStore::sGoldId))
             {
                 iter->getRefData().setCount(iter->getRefData().getCount() + realCount);
+                logChange(*iter);
                 flagAsModified();
                 return iter;
             }
@@ -266,6 +267,7 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::addImp (const Ptr& ptr,
             // stack
             iter->getRefData().setCount( iter->getRefData().getCount() + count );
 
+            logChange(*iter);
             flagAsModified();
             return iter;
         }
@@ -296,6 +298,7 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::addNewStack (const Ptr&
 
     it->getRefData().setCount(count);
 
+    logChange(*it);
     flagAsModified();
     return it;
 }
@@ -332,6 +335,9 @@ int MWWorld::ContainerStore::remove(const Ptr& item, int count, const Ptr& actor
         toRemove = 0;
     }
 
+    if (toRemove<count)
+        logChange(item);
+
     flagAsModified();
 
     // number of removed items
@@ -357,7 +363,7 @@ void MWWorld::ContainerStore::addInitialItem (const std::string& id, const std::
 
     ManualRef ref (MWBase::Environment::get().getWorld()->getStore(), id, count);
 
-    if (ref.getPtr().getTypeName()==typeid (ESM::ItemLevList).name())
+    if (ref.getPtr().is<ESM::ItemLevList>())
     {
         const ESM::ItemLevList* levItem = ref.getPtr().get<ESM::ItemLevList>()->mBase;
 
@@ -388,6 +394,7 @@ void MWWorld::ContainerStore::clear()
     for (ContainerStoreIterator iter (begin()); iter!=end(); ++iter)
         iter->getRefData().setCount (0);
 
+    mChangeLog.reset();
     flagAsModified();
 }
 
@@ -396,6 +403,17 @@ void MWWorld::ContainerStore::flagAsModified()
     mWeightUpToDate = false;
 }
 
+void MWWorld::ContainerStore::logChange (const Ptr& stack)
+{
+    mChangeLog.add (stack);
+}
+
+bool MWWorld::ContainerStore::getChanges (ContainerChangeLog::Serial& since,
+    std::vector<Ptr>& changed) const
+{
+    return mChangeLog.getChanges (since, changed);
+}
+
 float MWWorld::ContainerStore::getWeight() const
 {
     if (!mWeightUpToDate)
@@ -426,40 +444,40 @@ int MWWorld::ContainerStore::getType (const Ptr& ptr)
     if (ptr.isEmpty())
         throw std::runtime_error ("can't put a non-existent object into a container");
 
-    if (ptr.getTypeName()==typeid (ESM::Potion).name())
+    if (ptr.is<ESM::Potion>())
         return Type_Potion;
 
-    if (ptr.getTypeName()==typeid (ESM::Apparatus).name())
+    if (ptr.is<ESM::Apparatus>())
         return Type_Apparatus;
 
-    if (ptr.getTypeName()==typeid (ESM::Armor).name())
+    if (ptr.is<ESM::Armor>())
         return Type_Armor;
 
-    if (ptr.getTypeName()==typeid (ESM::Book).name())
+    if (ptr.is<ESM::Book>())
         return Type_Book;
 
-    if (ptr.getTypeName()==typeid (ESM::Clothing).name())
+    if (ptr.is<ESM::Clothing>())
         return Type_Clothing;
 
-    if (ptr.getTypeName()==typeid (ESM::Ingredient).name())
+    if (ptr.is<ESM::Ingredient>())
         return Type_Ingredient;
 
-    if (ptr.getTypeName()==typeid (ESM::Light).name())
+    if (ptr.is<ESM::Light>())
         return Type_Light;
 
-    if (ptr.getTypeName()==typeid (ESM::Lockpick).name())
+    if (ptr.is<ESM::Lockpick>())
         return Type_Lockpick;
 
-    if (ptr.getTypeName()==typeid (ESM::Miscellaneous).name())
+    if (ptr.is<ESM::Miscellaneous>())
         return Type_Miscellaneous;
 
-    if (ptr.getTypeName()==typeid (ESM::Probe).name())
+    if (ptr.is<ESM::Probe>())
         return Type_Probe;
 
-    if (ptr.getTypeName()==typeid (ESM::Repair).name())
+    if (ptr.is<ESM::Repair>())
         return Type_Repair;
 
-    if (ptr.getTypeName()==typeid (ESM::Weapon).name())
+    if (ptr.is<ESM::Weapon>())
         return Type_Weapon;
 
     throw std::runtime_error (
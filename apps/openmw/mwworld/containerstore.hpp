@@ -17,6 +17,7 @@
 #include <components/esm/loadweap.hpp>
 
 #include "ptr.hpp"
+#include "containerchangelog.hpp"
 
 namespace ESM
 {
@@ -67,6 +68,7 @@ namespace MWWorld
             MWWorld::CellRefList<ESM::Weapon>            weapons;
             mutable float mCachedWeight;
             mutable bool mWeightUpToDate;
+            ContainerChangeLog mChangeLog;
             ContainerStoreIterator addImp (const Ptr& ptr, int count);
             void addInitialItem (const std::string& id, const std::string& owner, const std::string& faction, int count, bool topLevel=true);
 
@@ -137,6 +139,9 @@ namespace MWWorld
 
             virtual void flagAsModified();
 
+            void logChange (const Ptr& stack);
+            ///< Record that \a stack has been created or has changed its count (see getChanges).
+
         public:
 
             virtual bool stacks (const Ptr& ptr1, const Ptr& ptr2);
@@ -157,6 +162,14 @@ namespace MWWorld
 
             Ptr search (const std::string& id);
 
+            bool getChanges (ContainerChangeLog::Serial& since, std::vector<Ptr>& changed) const;
+            ///< Append the stacks that have been created or have changed their count since
+            /// \a since to \a changed and update \a since.
+            ///
+            /// \note Counts changed via RefData::setCount outside of this class are not logged.
+            /// \return Could the changes be provided? If not, the caller needs to look at all
+            /// stacks again (e.g. because the container has been cleared or replaced).
+
             void writeState (ESM::InventoryState& state) const;
 
             void readState (const ESM::InventoryState& state);
@@ -137,6 +137,8 @@ void ESMStore::setUp()
     mSkills.setUp();
     mMagicEffects.setUp();
     mAttributes.setUp();
+
+    mGameSettingTable.fill (mGameSettings);
 }
 
     int ESMStore::countSavedGameRecords() const
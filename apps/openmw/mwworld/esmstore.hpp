@@ -4,6 +4,8 @@
 #include <stdexcept>
 
 #include <components/esm/records.hpp>
+#include <components/esm/gamesettingtable.hpp>
+
 #include "store.hpp"
 
 namespace Loading
@@ -52,6 +54,9 @@ namespace MWWorld
         Store<ESM::GameSetting>     mGameSettings;
         Store<ESM::Script>          mScripts;
 
+        // Copy of frequently used GMSTs, filled in setUp
+        ESM::GameSettingTable mGameSettingTable;
+
         // Lists that need special rules
         Store<ESM::Cell>        mCells;
         Store<ESM::Land>        mLands;
@@ -210,6 +215,14 @@ namespace MWWorld
         //  from the outside, so it must be public.
         void setUp();
 
+        const ESM::GameSettingTable& getGameSettingTable() const
+        {
+            return mGameSettingTable;
+        }
+        ///< Typed GMSTs; valid after setUp (in contrast to get<ESM::GameSetting>().find(), no
+        /// exception is thrown for missing GMSTs, their value is 0 instead; setUp reports them on
+        /// std::cerr).
+
         int countSavedGameRecords() const;
 
         void write (ESM::ESMWriter& writer) const;
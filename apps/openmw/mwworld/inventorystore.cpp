@@ -107,8 +107,8 @@ MWWorld::ContainerStoreIterator MWWorld::InventoryStore::add(const Ptr& itemPtr,
             && !(actorPtr.getClass().isNpc() && actorPtr.getClass().getNpcStats(actorPtr).isWerewolf())
             && !actorPtr.getClass().getCreatureStats(actorPtr).isDead())
     {
-        std::string type = itemPtr.getTypeName();
-        if ((type == typeid(ESM::Armor).name()) || (type == typeid(ESM::Clothing).name()) || (type == typeid(ESM::Weapon).name()))
+        unsigned int type = itemPtr.getType();
+        if ((type == ESM::Armor::sRecordId) || (type == ESM::Clothing::sRecordId) || (type == ESM::Weapon::sRecordId))
             autoEquip(actorPtr);
     }
 
@@ -198,7 +198,7 @@ void MWWorld::InventoryStore::autoEquip (const MWWorld::Ptr& actor)
         Ptr test = *iter;
 
         // Don't autoEquip lights
-        if (test.getTypeName() == typeid(ESM::Light).name())
+        if (test.is<ESM::Light>())
         {
             continue;
         }
@@ -484,8 +484,8 @@ int MWWorld::InventoryStore::remove(const Ptr& item, int count, const Ptr& actor
     if ((actor.getRefData().getHandle() != "player")
             && !(actor.getClass().isNpc() && actor.getClass().getNpcStats(actor).isWerewolf()))
     {
-        std::string type = item.getTypeName();
-        if (((type == typeid(ESM::Armor).name()) || (type == typeid(ESM::Clothing).name()))
+        unsigned int type = item.getType();
+        if (((type == ESM::Armor::sRecordId) || (type == ESM::Clothing::sRecordId))
                 && !actor.getClass().getCreatureStats(actor).isDead())
             autoEquip(actor);
     }
@@ -520,6 +520,8 @@ MWWorld::ContainerStoreIterator MWWorld::InventoryStore::unequipSlot(int slot, c
             {
                 iter->getRefData().setCount(iter->getRefData().getCount() + it->getRefData().getCount());
                 it->getRefData().setCount(0);
+                logChange(*iter);
+                logChange(*it);
                 retval = iter;
                 break;
             }
@@ -23,6 +23,9 @@ namespace MWWorld
     {
         const Class *mClass;
 
+        /// Record ID of the object type (e.g. ESM::REC_NPC_); see Ptr::is
+        unsigned int mType;
+
         /** Information about this instance, such as 3D location and rotation
          * and individual type-dependent data.
          */
@@ -31,7 +34,8 @@ namespace MWWorld
         /** runtime-data */
         RefData mData;
 
-        LiveCellRefBase(std::string type, const ESM::CellRef &cref=ESM::CellRef());
+        LiveCellRefBase(std::string type, unsigned int recordType,
+            const ESM::CellRef &cref=ESM::CellRef());
         /* Need this for the class to be recognized as polymorphic */
         virtual ~LiveCellRefBase() { }
 
@@ -77,11 +81,11 @@ namespace MWWorld
     struct LiveCellRef : public LiveCellRefBase
     {
         LiveCellRef(const ESM::CellRef& cref, const X* b = NULL)
-            : LiveCellRefBase(typeid(X).name(), cref), mBase(b)
+            : LiveCellRefBase(typeid(X).name(), X::sRecordId, cref), mBase(b)
         {}
 
         LiveCellRef(const X* b = NULL)
-            : LiveCellRefBase(typeid(X).name()), mBase(b)
+            : LiveCellRefBase(typeid(X).name(), X::sRecordId), mBase(b)
         {}
 
         // The object that this instance is based on.
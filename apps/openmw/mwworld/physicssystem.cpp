@@ -37,6 +37,21 @@ namespace MWWorld
     static const float sStepSize = 32.0f;
     // Arbitrary number. To prevent infinite loops. They shouldn't happen but it's good to be prepared.
     static const int sMaxIterations = 8;
+    // Cached line of sight results are discarded once an actor has moved further than this
+    // or the result is older than sLineOfSightMaxAge seconds (other objects, e.g. doors, may move).
+    static const float sLineOfSightMoveThreshold = 16.0f;
+    static const float sLineOfSightMaxAge = 0.5f;
+
+    /// Return the physics handle of \a ptr. A stale handle cached in RefData (e.g. after the
+    /// object has been re-added to the scene) is refreshed via a lookup by scene node name.
+    static OEngine::Physic::ObjectHandle getPhysicsHandle(const MWWorld::Ptr &ptr,
+        OEngine::Physic::PhysicEngine *engine)
+    {
+        RefData &data = ptr.getRefData();
+        if (!engine->isValidHandle(data.getPhysicsHandle()) && data.getBaseNode())
+            data.setPhysicsHandle(engine->getHandle(data.getHandle()));
+        return data.getPhysicsHandle();
+    }
 
     class MovementSolver
     {
@@ -92,7 +107,7 @@ namespace MWWorld
             const ESM::Position &refpos = ptr.getRefData().getPosition();
             Ogre::Vector3 position(refpos.pos);
 
-            OEngine::Physic::PhysicActor *physicActor = engine->getCharacter(ptr.getRefData().getHandle());
+            OEngine::Physic::PhysicActor *physicActor = engine->getCharacter(getPhysicsHandle(ptr, engine));
             if (!physicActor)
                 return position;
 
@@ -117,7 +132,7 @@ namespace MWWorld
             Ogre::Vector3 position(refpos.pos);
 
             /* Anything to collide with? */
-            OEngine::Physic::PhysicActor *physicActor = engine->getCharacter(ptr.getRefData().getHandle());
+            OEngine::Physic::PhysicActor *physicActor = engine->getCharacter(getPhysicsHandle(ptr, engine));
             if(!physicActor || !physicActor->getCollisionMode())
             {
                 return position +  (Ogre::Quaternion(Ogre::Radian(refpos.rot[2]), Ogre::Vector3::NEGATIVE_UNIT_Z) *
@@ -421,6 +436,7 @@ namespace MWWorld
         OEngine::Physic::RigidBody* raycastingBody = mEngine->createAndAdjustRigidBody(
             mesh, node->getName(), node->getScale().x, node->getPosition(), node->getOrientation(), 0, 0, true, placeable);
         mEngine->addRigidBody(body, true, raycastingBody);
+        ptr.getRefData().setPhysicsHandle(mEngine->getHandle(node->getName()));
     }
 
     void PhysicsSystem::addActor (const Ptr& ptr)
@@ -429,10 +445,14 @@ namespace MWWorld
         Ogre::SceneNode* node = ptr.getRefData().getBaseNode();
         //TODO:optimize this. Searching the std::map isn't very efficient i think.
         mEngine->addCharacter(node->getName(), mesh, node->getPosition(), node->getScale().x, node->getOrientation());
+        ptr.getRefData().setPhysicsHandle(mEngine->getHandle(node->getName()));
     }
 
     void PhysicsSystem::removeObject (const std::string& handle)
     {
+        // cached entries are keyed by reference address, which may be reused after removal
+        clearLineOfSightCache();
+
         mEngine->removeCharacter(handle);
         mEngine->removeRigidBody(handle);
         mEngine->deleteRigidBody(handle);
@@ -441,7 +461,7 @@ namespace MWWorld
     void PhysicsSystem::moveObject (const Ptr& ptr)
     {
         Ogre::SceneNode *node = ptr.getRefData().getBaseNode();
-        const std::string &handle = node->getName();
+        OEngine::Physic::ObjectHandle handle = getPhysicsHandle(ptr, mEngine);
         const Ogre::Vector3 &position = node->getPosition();
 
         if(OEngine::Physic::RigidBody *body = mEngine->getRigidBody(handle))
@@ -457,7 +477,7 @@ namespace MWWorld
     void PhysicsSystem::rotateObject (const Ptr& ptr)
     {
         Ogre::SceneNode* node = ptr.getRefData().getBaseNode();
-        const std::string &handle = node->getName();
+        OEngine::Physic::ObjectHandle handle = getPhysicsHandle(ptr, mEngine);
         const Ogre::Quaternion &rotation = node->getOrientation();
         if (OEngine::Physic::PhysicActor* act = mEngine->getCharacter(handle))
         {
@@ -469,14 +489,14 @@ namespace MWWorld
             if(dynamic_cast<btBoxShape*>(body->getCollisionShape()) == NULL)
                 body->getWorldTransform().setRotation(btQuaternion(rotation.x, rotation.y, rotation.z, rotation.w));
             else
-                mEngine->boxAdjustExternal(handleToMesh[handle], body, node->getScale().x, node->getPosition(), rotation);
+                mEngine->boxAdjustExternal(handleToMesh[node->getName()], body, node->getScale().x, node->getPosition(), rotation);
         }
         if (OEngine::Physic::RigidBody* body = mEngine->getRigidBody(handle, true))
         {
             if(dynamic_cast<btBoxShape*>(body->getCollisionShape()) == NULL)
                 body->getWorldTransform().setRotation(btQuaternion(rotation.x, rotation.y, rotation.z, rotation.w));
             else
-                mEngine->boxAdjustExternal(handleToMesh[handle], body, node->getScale().x, node->getPosition(), rotation);
+                mEngine->boxAdjustExternal(handleToMesh[node->getName()], body, node->getScale().x, node->getPosition(), rotation);
         }
     }
 
@@ -486,19 +506,137 @@ namespace MWWorld
         const std::string &handle = node->getName();
         if(handleToMesh.find(handle) != handleToMesh.end())
         {
+            OEngine::Physic::ObjectHandle physicsHandle = getPhysicsHandle(ptr, mEngine);
             bool placeable = false;
-            if (OEngine::Physic::RigidBody* body = mEngine->getRigidBody(handle,true))
+            if (OEngine::Physic::RigidBody* body = mEngine->getRigidBody(physicsHandle,true))
                 placeable = body->mPlaceable;
-            else if (OEngine::Physic::RigidBody* body = mEngine->getRigidBody(handle,false))
+            else if (OEngine::Physic::RigidBody* body = mEngine->getRigidBody(physicsHandle,false))
                 placeable = body->mPlaceable;
             removeObject(handle);
             addObject(ptr, placeable);
         }
 
-        if (OEngine::Physic::PhysicActor* act = mEngine->getCharacter(handle))
+        if (OEngine::Physic::PhysicActor* act = mEngine->getCharacter(getPhysicsHandle(ptr, mEngine)))
             act->setScale(node->getScale().x);
     }
 
+    OEngine::Physic::PhysicActor *PhysicsSystem::getActor(const MWWorld::Ptr &ptr)
+    {
+        return mEngine->getCharacter(getPhysicsHandle(ptr, mEngine));
+    }
+
+    Ogre::Vector3 PhysicsSystem::getEyePosition(const MWWorld::Ptr& actor)
+    {
+        Ogre::Vector3 position(actor.getRefData().getPosition().pos);
+
+        if (OEngine::Physic::PhysicActor *physicActor = getActor(actor))
+            position.z += physicActor->getHalfExtents().z;
+
+        return position;
+    }
+
+    const PhysicsSystem::LineOfSight *PhysicsSystem::searchLineOfSight(const MWWorld::Ptr& actor1,
+        const MWWorld::Ptr& actor2, const Ogre::Vector3& from, const Ogre::Vector3& to) const
+    {
+        bool swapped = actor2.mRef < actor1.mRef;
+
+        LineOfSightCache::const_iterator iter = mLineOfSightCache.find(swapped ?
+            std::make_pair(actor2.mRef, actor1.mRef) : std::make_pair(actor1.mRef, actor2.mRef));
+
+        if (iter==mLineOfSightCache.end())
+            return 0;
+
+        const LineOfSight& entry = iter->second;
+
+        const Ogre::Vector3& cachedFrom = swapped ? entry.mTo : entry.mFrom;
+        const Ogre::Vector3& cachedTo = swapped ? entry.mFrom : entry.mTo;
+
+        const float threshold = sLineOfSightMoveThreshold*sLineOfSightMoveThreshold;
+
+        if (cachedFrom.squaredDistance(from) > threshold || cachedTo.squaredDistance(to) > threshold)
+            return 0;
+
+        return &entry;
+    }
+
+    void PhysicsSystem::storeLineOfSight(const MWWorld::Ptr& actor1, const MWWorld::Ptr& actor2,
+        const Ogre::Vector3& from, const Ogre::Vector3& to, bool result)
+    {
+        bool swapped = actor2.mRef < actor1.mRef;
+
+        LineOfSight entry;
+        entry.mFrom = swapped ? to : from;
+        entry.mTo = swapped ? from : to;
+        entry.mAge = 0;
+        entry.mResult = result;
+
+        mLineOfSightCache[swapped ?
+            std::make_pair(actor2.mRef, actor1.mRef) : std::make_pair(actor1.mRef, actor2.mRef)] = entry;
+    }
+
+    bool PhysicsSystem::getLineOfSight(const MWWorld::Ptr& actor1, const MWWorld::Ptr& actor2)
+    {
+        Ogre::Vector3 from = getEyePosition(actor1);
+        Ogre::Vector3 to = getEyePosition(actor2);
+
+        if (const LineOfSight *cached = searchLineOfSight(actor1, actor2, from, to))
+            return cached->mResult;
+
+        btVector3 btFrom(from.x, from.y, from.z);
+        btVector3 btTo(to.x, to.y, to.z);
+
+        bool result = mEngine->rayTest(btFrom, btTo, false).first.empty();
+
+        storeLineOfSight(actor1, actor2, from, to, result);
+
+        return result;
+    }
+
+    void PhysicsSystem::getLineOfSight(const MWWorld::Ptr& actor, const std::vector<MWWorld::Ptr>& targets,
+        std::vector<bool>& results)
+    {
+        results.assign(targets.size(), false);
+
+        Ogre::Vector3 from = getEyePosition(actor);
+        btVector3 btFrom(from.x, from.y, from.z);
+
+        for (std::size_t i=0; i<targets.size(); ++i)
+        {
+            Ogre::Vector3 to = getEyePosition(targets[i]);
+
+            if (const LineOfSight *cached = searchLineOfSight(actor, targets[i], from, to))
+            {
+                results[i] = cached->mResult;
+                continue;
+            }
+
+            btVector3 btTo(to.x, to.y, to.z);
+
+            bool result = mEngine->rayTest(btFrom, btTo, false).first.empty();
+            results[i] = result;
+            storeLineOfSight(actor, targets[i], from, to, result);
+        }
+    }
+
+    void PhysicsSystem::updateLineOfSightCache(float duration)
+    {
+        LineOfSightCache::iterator iter = mLineOfSightCache.begin();
+        while (iter!=mLineOfSightCache.end())
+        {
+            iter->second.mAge += duration;
+
+            if (iter->second.mAge > sLineOfSightMaxAge)
+                mLineOfSightCache.erase(iter++);
+            else
+                ++iter;
+        }
+    }
+
+    void PhysicsSystem::clearLineOfSightCache()
+    {
+        mLineOfSightCache.clear();
+    }
+
     bool PhysicsSystem::toggleCollisionMode()
     {
         for(std::map<std::string,OEngine::Physic::PhysicActor*>::iterator it = mEngine->mActorMap.begin(); it != mEngine->mActorMap.end();++it)
@@ -17,6 +17,7 @@ namespace OEngine
     namespace Physic
     {
         class PhysicEngine;
+        class PhysicActor;
     }
 }
 
@@ -75,6 +76,23 @@ namespace MWWorld
 
             OEngine::Physic::PhysicEngine* getEngine();
 
+            OEngine::Physic::PhysicActor *getActor(const MWWorld::Ptr &ptr);
+            ///< Return the physics actor of \a ptr (0 if there is none), without a lookup by name.
+
+            bool getLineOfSight(const MWWorld::Ptr& actor1, const MWWorld::Ptr& actor2);
+            ///< Is there a line of sight between the two actors? Results are cached per actor pair
+            /// until one of the actors moves noticeably or the entry expires.
+
+            void getLineOfSight(const MWWorld::Ptr& actor, const std::vector<MWWorld::Ptr>& targets,
+                std::vector<bool>& results);
+            ///< Line of sight between \a actor and each of \a targets. The eye position of \a actor
+            /// is computed once; pairs that are not cached are cast one ray each.
+
+            void updateLineOfSightCache(float duration);
+            ///< Age cached line of sight results and drop expired ones. Call once per frame.
+
+            void clearLineOfSightCache();
+
             bool getObjectAABB(const MWWorld::Ptr &ptr, Ogre::Vector3 &min, Ogre::Vector3 &max);
 
             /// Queues velocity movement for a Ptr. If a Ptr is already queued, its velocity will
@@ -85,6 +103,25 @@ namespace MWWorld
 
         private:
 
+            struct LineOfSight
+            {
+                Ogre::Vector3 mFrom;
+                Ogre::Vector3 mTo;
+                float mAge;
+                bool mResult;
+            };
+
+            typedef std::map<std::pair<const LiveCellRefBase *, const LiveCellRefBase *>, LineOfSight>
+                LineOfSightCache;
+
+            Ogre::Vector3 getEyePosition(const MWWorld::Ptr& actor);
+
+            const LineOfSight *searchLineOfSight(const MWWorld::Ptr& actor1, const MWWorld::Ptr& actor2,
+                const Ogre::Vector3& from, const Ogre::Vector3& to) const;
+
+            void storeLineOfSight(const MWWorld::Ptr& actor1, const MWWorld::Ptr& actor2,
+                const Ogre::Vector3& from, const Ogre::Vector3& to, bool result);
+
             OEngine::Render::OgreRenderer &mRender;
             OEngine::Physic::PhysicEngine* mEngine;
             std::map<std::string, std::string> handleToMesh;
@@ -94,6 +131,8 @@ namespace MWWorld
 
             float mTimeAccum;
 
+            LineOfSightCache mLineOfSightCache;
+
             PhysicsSystem (const PhysicsSystem&);
             PhysicsSystem& operator= (const PhysicsSystem&);
     };
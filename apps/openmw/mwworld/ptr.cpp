@@ -8,8 +8,9 @@
 
 
 /* This shouldn't really be here. */
-MWWorld::LiveCellRefBase::LiveCellRefBase(std::string type, const ESM::CellRef &cref)
-  : mClass(&Class::get(type)), mRef(cref), mData(mRef)
+MWWorld::LiveCellRefBase::LiveCellRefBase(std::string type, unsigned int recordType,
+    const ESM::CellRef &cref)
+  : mClass(&Class::get(type)), mType(recordType), mRef(cref), mData(mRef)
 {
 }
 
@@ -37,6 +37,23 @@ namespace MWWorld
 
             const std::string& getTypeName() const;
 
+            unsigned int getType() const
+            {
+                if(mRef != 0)
+                    return mRef->mType;
+                throw std::runtime_error("Can't get type of an empty object.");
+            }
+            ///< Record ID of the object type (e.g. ESM::REC_NPC_)
+
+            template<typename T>
+            bool is() const
+            {
+                return getType()==T::sRecordId;
+            }
+            ///< Is this an object of type \a T (e.g. ESM::NPC)?
+            ///
+            /// \note Prefer this over comparing getTypeName() with a type name.
+
             const Class& getClass() const
             {
                 if(mRef != 0)
@@ -47,12 +64,12 @@ namespace MWWorld
             template<typename T>
             MWWorld::LiveCellRef<T> *get() const
             {
-                MWWorld::LiveCellRef<T> *ref = dynamic_cast<MWWorld::LiveCellRef<T>*>(mRef);
-                if(ref) return ref;
+                if(mRef != 0 && mRef->mType==T::sRecordId)
+                    return static_cast<MWWorld::LiveCellRef<T>*>(mRef);
 
                 std::stringstream str;
                 str<< "Bad LiveCellRef cast to "<<typeid(T).name()<<" from ";
-                if(mRef != 0) str<< getTypeName();
+                if(mRef != 0) str<< typeid(*mRef).name();
                 else str<< "an empty object";
 
                 throw std::runtime_error(str.str());
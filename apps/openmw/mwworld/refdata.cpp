@@ -16,6 +16,9 @@ namespace MWWorld
     void RefData::copy (const RefData& refData)
     {
         mBaseNode = refData.mBaseNode;
+        // the handle refers to the physics object of refData's scene node; looked up again on
+        // demand (see PhysicsSystem)
+        mPhysicsHandle = -1;
         mLocals = refData.mLocals;
         mHasLocals = refData.mHasLocals;
         mEnabled = refData.mEnabled;
@@ -29,13 +32,15 @@ namespace MWWorld
     void RefData::cleanup()
     {
         mBaseNode = 0;
+        mPhysicsHandle = -1;
 
         delete mCustomData;
         mCustomData = 0;
     }
 
     RefData::RefData()
-    : mBaseNode(0), mHasLocals (false), mEnabled (true), mCount (1), mCustomData (0)
+    : mBaseNode(0), mPhysicsHandle (-1), mHasLocals (false), mEnabled (true), mCount (1),
+      mCustomData (0)
     {
         for (int i=0; i<3; ++i)
         {
@@ -46,8 +51,8 @@ namespace MWWorld
     }
 
     RefData::RefData (const ESM::CellRef& cellRef)
-    : mBaseNode(0), mHasLocals (false), mEnabled (true), mCount (1), mPosition (cellRef.mPos),
-      mCustomData (0)
+    : mBaseNode(0), mPhysicsHandle (-1), mHasLocals (false), mEnabled (true), mCount (1),
+      mPosition (cellRef.mPos), mCustomData (0)
     {
         mLocalRotation.rot[0]=0;
         mLocalRotation.rot[1]=0;
@@ -55,7 +60,7 @@ namespace MWWorld
     }
 
     RefData::RefData (const ESM::ObjectState& objectState)
-    : mBaseNode (0), mHasLocals (false), mEnabled (objectState.mEnabled),
+    : mBaseNode (0), mPhysicsHandle (-1), mHasLocals (false), mEnabled (objectState.mEnabled),
       mCount (objectState.mCount), mPosition (objectState.mPosition), mCustomData (0)
     {
         for (int i=0; i<3; ++i)
@@ -63,7 +68,7 @@ namespace MWWorld
     }
 
     RefData::RefData (const RefData& refData)
-    : mBaseNode(0), mCustomData (0)
+    : mBaseNode(0), mPhysicsHandle (-1), mCustomData (0)
     {
         try
         {
@@ -134,6 +139,16 @@ namespace MWWorld
          mBaseNode = base;
     }
 
+    int RefData::getPhysicsHandle() const
+    {
+        return mPhysicsHandle;
+    }
+
+    void RefData::setPhysicsHandle (int handle)
+    {
+        mPhysicsHandle = handle;
+    }
+
     int RefData::getCount() const
     {
         return mCount;
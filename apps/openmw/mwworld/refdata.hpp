@@ -29,6 +29,7 @@ namespace MWWorld
     {
             Ogre::SceneNode* mBaseNode;
 
+            int mPhysicsHandle; // OEngine::Physic::ObjectHandle, -1 if none
 
             MWScript::Locals mLocals; // if we find the overhead of heaving a locals
                                       // object in the refdata of refs without a script,
@@ -79,6 +80,12 @@ namespace MWWorld
             /// Set OGRE base node (can be a null pointer).
             void setBaseNode (Ogre::SceneNode* base);
 
+            /// Return handle of the physics object (-1 if none; may be stale, the physics engine
+            /// checks for that).
+            int getPhysicsHandle() const;
+
+            void setPhysicsHandle (int handle);
+
             int getCount() const;
 
             void setLocals (const ESM::Script& script);
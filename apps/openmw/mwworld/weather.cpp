@@ -15,156 +15,13 @@ using namespace Ogre;
 using namespace MWWorld;
 using namespace MWSound;
 
-namespace
-{
-    float lerp (float x, float y, float factor)
-    {
-        return x * (1-factor) + y * factor;
-    }
-
-    Ogre::ColourValue lerp (const Ogre::ColourValue& x, const Ogre::ColourValue& y, float factor)
-    {
-        return x * (1-factor) + y * factor;
-    }
-}
-
-void WeatherManager::setFallbackWeather(Weather& weather,const std::string& name)
-{
-    std::string upper=name;
-    upper[0]=toupper(name[0]);
-    weather.mCloudsMaximumPercent = mFallback->getFallbackFloat("Weather_"+upper+"_Clouds_Maximum_Percent");
-    weather.mTransitionDelta = mFallback->getFallbackFloat("Weather_"+upper+"_Transition_Delta");
-    weather.mSkySunriseColor=mFallback->getFallbackColour("Weather_"+upper+"_Sky_Sunrise_Color");
-    weather.mSkyDayColor = mFallback->getFallbackColour("Weather_"+upper+"_Sky_Day_Color");
-    weather.mSkySunsetColor = mFallback->getFallbackColour("Weather_"+upper+"_Sky_Sunset_Color");
-    weather.mSkyNightColor = mFallback->getFallbackColour("Weather_"+upper+"_Sky_Night_Color");
-    weather.mFogSunriseColor = mFallback->getFallbackColour("Weather_"+upper+"_Fog_Sunrise_Color");
-    weather.mFogDayColor = mFallback->getFallbackColour("Weather_"+upper+"_Fog_Day_Color");
-    weather.mFogSunsetColor = mFallback->getFallbackColour("Weather_"+upper+"_Fog_Sunset_Color");
-    weather.mFogNightColor = mFallback->getFallbackColour("Weather_"+upper+"_Fog_Night_Color");
-    weather.mAmbientSunriseColor = mFallback->getFallbackColour("Weather_"+upper+"_Ambient_Sunrise_Color");
-    weather.mAmbientDayColor = mFallback->getFallbackColour("Weather_"+upper+"_Ambient_Day_Color");
-    weather.mAmbientSunsetColor = mFallback->getFallbackColour("Weather_"+upper+"_Ambient_Sunset_Color");
-    weather.mAmbientNightColor = mFallback->getFallbackColour("Weather_"+upper+"_Ambient_Night_Color");
-    weather.mSunSunriseColor = mFallback->getFallbackColour("Weather_"+upper+"_Sun_Sunrise_Color");
-    weather.mSunDayColor = mFallback->getFallbackColour("Weather_"+upper+"_Sun_Day_Color");
-    weather.mSunSunsetColor = mFallback->getFallbackColour("Weather_"+upper+"_Sun_Sunset_Color");
-    weather.mSunNightColor = mFallback->getFallbackColour("Weather_"+upper+"_Sun_Night_Color");
-    weather.mSunDiscSunsetColor = mFallback->getFallbackColour("Weather_"+upper+"_Sun_Disc_Sunset_Color");
-    weather.mLandFogDayDepth = mFallback->getFallbackFloat("Weather_"+upper+"_Land_Fog_Day_Depth");
-    weather.mLandFogNightDepth = mFallback->getFallbackFloat("Weather_"+upper+"_Land_Fog_Night_Depth");
-    weather.mWindSpeed = mFallback->getFallbackFloat("Weather_"+upper+"_Wind_Speed");
-    weather.mCloudSpeed = mFallback->getFallbackFloat("Weather_"+upper+"_Cloud_Speed");
-    weather.mGlareView = mFallback->getFallbackFloat("Weather_"+upper+"_Glare_View");
-    mWeatherSettings[name] = weather;
-}
-
-
-float WeatherManager::calculateHourFade (const std::string& moonName) const
-{
-    float fadeOutStart=mFallback->getFallbackFloat("Moons_"+moonName+"_Fade_Out_Start");
-    float fadeOutFinish=mFallback->getFallbackFloat("Moons_"+moonName+"_Fade_Out_Finish");
-    float fadeInStart=mFallback->getFallbackFloat("Moons_"+moonName+"_Fade_In_Start");
-    float fadeInFinish=mFallback->getFallbackFloat("Moons_"+moonName+"_Fade_In_Finish");
-
-    if (mHour >= fadeOutStart && mHour <= fadeOutFinish)
-        return (1 - ((mHour - fadeOutStart) / (fadeOutFinish - fadeOutStart)));
-    if (mHour >= fadeInStart && mHour <= fadeInFinish)
-        return (1 - ((mHour - fadeInStart) / (fadeInFinish - fadeInStart)));
-    else
-        return 1;
-}
-
-float WeatherManager::calculateAngleFade (const std::string& moonName, float angle) const
-{
-    float endAngle=mFallback->getFallbackFloat("Moons_"+moonName+"_Fade_End_Angle");
-    float startAngle=mFallback->getFallbackFloat("Moons_"+moonName+"_Fade_Start_Angle");
-    if (angle <= startAngle && angle >= endAngle)
-        return (1 - ((angle - endAngle)/(startAngle-endAngle)));
-    else if (angle > startAngle)
-        return 0.f;
-    else
-        return 1.f;
-}
-
 WeatherManager::WeatherManager(MWRender::RenderingManager* rendering,MWWorld::Fallback* fallback) :
-     mHour(14), mCurrentWeather("clear"), mNextWeather(""), mFirstUpdate(true),
-     mWeatherUpdateTime(0), mThunderFlash(0), mThunderChance(0),
-     mThunderChanceNeeded(50), mThunderSoundDelay(0), mRemainingTransitionTime(0),
-     mMonth(0), mDay(0), mTimePassed(0), mFallback(fallback), mWindSpeed(0.f),
-     mRendering(rendering)
+     mHour(14), mDay(0), mMonth(0), mWindSpeed(0.f), mTable(*fallback), mRendering(rendering),
+     mCurrentWeather(WeatherTable::Weather_Clear), mNextWeather(-1), mFirstUpdate(true),
+     mRemainingTransitionTime(0), mThunderFlash(0), mThunderChance(0), mThunderChanceNeeded(50),
+     mTimePassed(0), mWeatherUpdateTime(mTable.mHoursBetweenWeatherChanges * 3600),
+     mThunderSoundDelay(0.25)
 {
-    //Globals
-    mThunderSoundID0 = mFallback->getFallbackString("Weather_Thunderstorm_Thunder_Sound_ID_0");
-    mThunderSoundID1 = mFallback->getFallbackString("Weather_Thunderstorm_Thunder_Sound_ID_1");
-    mThunderSoundID2 = mFallback->getFallbackString("Weather_Thunderstorm_Thunder_Sound_ID_2");
-    mThunderSoundID3 = mFallback->getFallbackString("Weather_Thunderstorm_Thunder_Sound_ID_3");
-    mSunriseTime = mFallback->getFallbackFloat("Weather_Sunrise_Time");
-    mSunsetTime = mFallback->getFallbackFloat("Weather_Sunset_Time");
-    mSunriseDuration = mFallback->getFallbackFloat("Weather_Sunrise_Duration");
-    mSunsetDuration = mFallback->getFallbackFloat("Weather_Sunset_Duration");
-    mHoursBetweenWeatherChanges = mFallback->getFallbackFloat("Weather_Hours_Between_Weather_Changes");
-    mWeatherUpdateTime = mHoursBetweenWeatherChanges * 3600;
-    mThunderFrequency = mFallback->getFallbackFloat("Weather_Thunderstorm_Thunder_Frequency");
-    mThunderThreshold = mFallback->getFallbackFloat("Weather_Thunderstorm_Thunder_Threshold");
-    mThunderSoundDelay = 0.25;
-
-    //Some useful values
-    /* TODO: Use pre-sunrise_time, pre-sunset_time,
-     * post-sunrise_time, and post-sunset_time to better
-     * describe sunrise/sunset time.
-     * These values are fallbacks attached to weather.
-     */
-    mNightStart = mSunsetTime + mSunsetDuration;
-    mNightEnd = mSunriseTime - 0.5;
-    mDayStart = mSunriseTime + mSunriseDuration;
-    mDayEnd = mSunsetTime;
-
-    //Weather
-    Weather clear;
-    clear.mCloudTexture = "tx_sky_clear.dds";
-    setFallbackWeather(clear,"clear");
-
-    Weather cloudy;
-    cloudy.mCloudTexture = "tx_sky_cloudy.dds";
-    setFallbackWeather(cloudy,"cloudy");
-
-    Weather foggy;
-    foggy.mCloudTexture = "tx_sky_foggy.dds";
-    setFallbackWeather(foggy,"foggy");
-
-    Weather thunderstorm;
-    thunderstorm.mCloudTexture = "tx_sky_thunder.dds";
-    thunderstorm.mRainLoopSoundID = "rain heavy";
-    setFallbackWeather(thunderstorm,"thunderstorm");
-
-    Weather rain;
-    rain.mCloudTexture = "tx_sky_rainy.dds";
-    rain.mRainLoopSoundID = "rain";
-    setFallbackWeather(rain,"rain");
-
-    Weather overcast;
-    overcast.mCloudTexture = "tx_sky_overcast.dds";
-    setFallbackWeather(overcast,"overcast");
-
-    Weather ashstorm;
-    ashstorm.mCloudTexture = "tx_sky_ashstorm.dds";
-    ashstorm.mAmbientLoopSoundID = "ashstorm";
-    setFallbackWeather(ashstorm,"ashstorm");
-
-    Weather blight;
-    blight.mCloudTexture = "tx_sky_blight.dds";
-    blight.mAmbientLoopSoundID = "blight";
-    setFallbackWeather(blight,"blight");
-
-    Weather snow;
-    snow.mCloudTexture = "tx_bm_sky_snow.dds";
-    setFallbackWeather(snow, "snow");
-
-    Weather blizzard;
-    blizzard.mCloudTexture = "tx_bm_sky_blizzard.dds";
-    blizzard.mAmbientLoopSoundID = "BM Blizzard";
-    setFallbackWeather(blizzard,"blizzard");
 }
 
 WeatherManager::~WeatherManager()
@@ -172,9 +29,9 @@ WeatherManager::~WeatherManager()
     stopSounds(true);
 }
 
-void WeatherManager::setWeather(const String& weather, bool instant)
+void WeatherManager::setWeather(int weather, bool instant)
 {
-    if (weather == mCurrentWeather && mNextWeather == "")
+    if (weather == mCurrentWeather && mNextWeather == -1)
     {
         mFirstUpdate = false;
         return;
@@ -182,141 +39,29 @@ void WeatherManager::setWeather(const String& weather, bool instant)
 
     if (instant || mFirstUpdate)
     {
-        mNextWeather = "";
+        mNextWeather = -1;
         mCurrentWeather = weather;
     }
     else
     {
-        if (mNextWeather != "")
+        float transitionTime = mTable.getWeather(mCurrentWeather).mTransitionDelta * 24.f * 3600.f;
+
+        if (mNextWeather != -1)
         {
             // transition more than 50% finished?
-            if (mRemainingTransitionTime/(mWeatherSettings[mCurrentWeather].mTransitionDelta * 24.f * 3600) <= 0.5)
+            if (mRemainingTransitionTime/transitionTime <= 0.5)
+            {
                 mCurrentWeather = mNextWeather;
+                transitionTime = mTable.getWeather(mCurrentWeather).mTransitionDelta * 24.f * 3600.f;
+            }
         }
 
         mNextWeather = weather;
-        mRemainingTransitionTime = mWeatherSettings[mCurrentWeather].mTransitionDelta * 24.f * 3600.f;
+        mRemainingTransitionTime = transitionTime;
     }
     mFirstUpdate = false;
 }
 
-void WeatherManager::setResult(const String& weatherType)
-{
-    const Weather& current = mWeatherSettings[weatherType];
-
-    mResult.mCloudTexture = current.mCloudTexture;
-    mResult.mCloudBlendFactor = 0;
-    mResult.mCloudOpacity = current.mCloudsMaximumPercent;
-    mResult.mWindSpeed = current.mWindSpeed;
-    mResult.mCloudSpeed = current.mCloudSpeed;
-    mResult.mGlareView = current.mGlareView;
-    mResult.mAmbientLoopSoundID = current.mAmbientLoopSoundID;
-    mResult.mSunColor = current.mSunDiscSunsetColor;
-
-    mResult.mNight = (mHour < mSunriseTime || mHour > mNightStart - 1);
-
-    mResult.mFogDepth = mResult.mNight ? current.mLandFogNightDepth : current.mLandFogDayDepth;
-
-    // night
-    if (mHour <= mNightEnd || mHour >= mNightStart + 1)
-    {
-        mResult.mFogColor = current.mFogNightColor;
-        mResult.mAmbientColor = current.mAmbientNightColor;
-        mResult.mSunColor = current.mSunNightColor;
-        mResult.mSkyColor = current.mSkyNightColor;
-        mResult.mNightFade = 1.f;
-    }
-
-    // sunrise
-    else if (mHour >= mNightEnd && mHour <= mDayStart + 1)
-    {
-        if (mHour <= mSunriseTime)
-        {
-            // fade in
-            float advance = mSunriseTime - mHour;
-            float factor = advance / 0.5f;
-            mResult.mFogColor = lerp(current.mFogSunriseColor, current.mFogNightColor, factor);
-            mResult.mAmbientColor = lerp(current.mAmbientSunriseColor, current.mAmbientNightColor, factor);
-            mResult.mSunColor = lerp(current.mSunSunriseColor, current.mSunNightColor, factor);
-            mResult.mSkyColor = lerp(current.mSkySunriseColor, current.mSkyNightColor, factor);
-            mResult.mNightFade = factor;
-        }
-        else //if (mHour >= 6)
-        {
-            // fade out
-            float advance = mHour - mSunriseTime;
-            float factor = advance / 3.f;
-            mResult.mFogColor = lerp(current.mFogSunriseColor, current.mFogDayColor, factor);
-            mResult.mAmbientColor = lerp(current.mAmbientSunriseColor, current.mAmbientDayColor, factor);
-            mResult.mSunColor = lerp(current.mSunSunriseColor, current.mSunDayColor, factor);
-            mResult.mSkyColor = lerp(current.mSkySunriseColor, current.mSkyDayColor, factor);
-        }
-    }
-
-    // day
-    else if (mHour >= mDayStart + 1 && mHour <= mDayEnd - 1)
-    {
-        mResult.mFogColor = current.mFogDayColor;
-        mResult.mAmbientColor = current.mAmbientDayColor;
-        mResult.mSunColor = current.mSunDayColor;
-        mResult.mSkyColor = current.mSkyDayColor;
-    }
-
-    // sunset
-    else if (mHour >= mDayEnd - 1 && mHour <= mNightStart + 1)
-    {
-        if (mHour <= mDayEnd + 1)
-        {
-            // fade in
-            float advance = (mDayEnd + 1) - mHour;
-            float factor = (advance / 2);
-            mResult.mFogColor = lerp(current.mFogSunsetColor, current.mFogDayColor, factor);
-            mResult.mAmbientColor = lerp(current.mAmbientSunsetColor, current.mAmbientDayColor, factor);
-            mResult.mSunColor = lerp(current.mSunSunsetColor, current.mSunDayColor, factor);
-            mResult.mSkyColor = lerp(current.mSkySunsetColor, current.mSkyDayColor, factor);
-        }
-        else //if (mHour >= 19)
-        {
-            // fade out
-            float advance = mHour - (mDayEnd + 1);
-            float factor = advance / 2.f;
-            mResult.mFogColor = lerp(current.mFogSunsetColor, current.mFogNightColor, factor);
-            mResult.mAmbientColor = lerp(current.mAmbientSunsetColor, current.mAmbientNightColor, factor);
-            mResult.mSunColor = lerp(current.mSunSunsetColor, current.mSunNightColor, factor);
-            mResult.mSkyColor = lerp(current.mSkySunsetColor, current.mSkyNightColor, factor);
-            mResult.mNightFade = factor;
-        }
-    }
-}
-
-void WeatherManager::transition(float factor)
-{
-    setResult(mCurrentWeather);
-    const WeatherResult current = mResult;
-    setResult(mNextWeather);
-    const WeatherResult other = mResult;
-
-    mResult.mCloudTexture = current.mCloudTexture;
-    mResult.mNextCloudTexture = other.mCloudTexture;
-    mResult.mCloudBlendFactor = factor;
-
-    mResult.mCloudOpacity = lerp(current.mCloudOpacity, other.mCloudOpacity, factor);
-    mResult.mFogColor = lerp(current.mFogColor, other.mFogColor, factor);
-    mResult.mSunColor = lerp(current.mSunColor, other.mSunColor, factor);
-    mResult.mSkyColor = lerp(current.mSkyColor, other.mSkyColor, factor);
-
-    mResult.mAmbientColor = lerp(current.mAmbientColor, other.mAmbientColor, factor);
-    mResult.mSunDiscColor = lerp(current.mSunDiscColor, other.mSunDiscColor, factor);
-    mResult.mFogDepth = lerp(current.mFogDepth, other.mFogDepth, factor);
-    mResult.mWindSpeed = lerp(current.mWindSpeed, other.mWindSpeed, factor);
-    mResult.mCloudSpeed = lerp(current.mCloudSpeed, other.mCloudSpeed, factor);
-    mResult.mCloudOpacity = lerp(current.mCloudOpacity, other.mCloudOpacity, factor);
-    mResult.mGlareView = lerp(current.mGlareView, other.mGlareView, factor);
-    mResult.mNightFade = lerp(current.mNightFade, other.mNightFade, factor);
-
-    mResult.mNight = current.mNight;
-}
-
 void WeatherManager::update(float duration)
 {
     float timePassed = mTimePassed;
@@ -337,27 +82,28 @@ void WeatherManager::update(float duration)
 
     switchToNextWeather(false);
 
-    if (mNextWeather != "")
+    if (mNextWeather != -1)
     {
         mRemainingTransitionTime -= timePassed;
         if (mRemainingTransitionTime < 0)
         {
             mCurrentWeather = mNextWeather;
-            mNextWeather = "";
+            mNextWeather = -1;
         }
     }
 
-    if (mNextWeather != "")
-        transition(1 - (mRemainingTransitionTime / (mWeatherSettings[mCurrentWeather].mTransitionDelta * 24.f * 3600)));
+    if (mNextWeather != -1)
+        mTable.getResult(mResult, mCurrentWeather, mNextWeather,
+            1 - (mRemainingTransitionTime / (mTable.getWeather(mCurrentWeather).mTransitionDelta * 24.f * 3600)), mHour);
     else
-        setResult(mCurrentWeather);
+        mTable.getResult(mResult, mCurrentWeather, mHour);
 
     mWindSpeed = mResult.mWindSpeed;
 
     mRendering->configureFog(mResult.mFogDepth, mResult.mFogColor);
 
     // disable sun during night
-    if (mHour >= mNightStart || mHour <= mSunriseTime)
+    if (mHour >= mTable.mNightStart || mHour <= mTable.mSunriseTime)
         mRendering->getSkyManager()->sunDisable();
     else
         mRendering->getSkyManager()->sunEnable();
@@ -366,15 +112,15 @@ void WeatherManager::update(float duration)
     float height;
 
     //Day duration
-    float dayDuration = (mNightStart - 1) - mSunriseTime;
+    float dayDuration = (mTable.mNightStart - 1) - mTable.mSunriseTime;
 
     // rise at 6, set at 20
-    if (mHour >= mSunriseTime && mHour <= mNightStart)
+    if (mHour >= mTable.mSunriseTime && mHour <= mTable.mNightStart)
         height = 1 - std::abs(((mHour - dayDuration) / 7.f));
-    else if (mHour > mNightStart)
-        height = (mHour - mNightStart) / 4.f;
+    else if (mHour > mTable.mNightStart)
+        height = (mHour - mTable.mNightStart) / 4.f;
     else //if (mHour > 0 && mHour < 6)
-        height = 1 - (mHour / mSunriseTime);
+        height = 1 - (mHour / mTable.mSunriseTime);
 
     int facing = (mHour > 13.f) ? 1 : -1;
 
@@ -389,8 +135,8 @@ void WeatherManager::update(float duration)
      * for masser and secunda
      */
 
-    float fadeOutFinish=mFallback->getFallbackFloat("Moons_Masser_Fade_Out_Finish");
-    float fadeInStart=mFallback->getFallbackFloat("Moons_Masser_Fade_In_Start");
+    float fadeOutFinish = mTable.mMasser.mFadeOutFinish;
+    float fadeInStart = mTable.mMasser.mFadeInStart;
 
     //moon calculations
     float moonHeight;
@@ -422,10 +168,10 @@ void WeatherManager::update(float duration)
         mRendering->getSkyManager()->secundaEnable();
 
         float angle = (1-moonHeight) * 90.f * facing;
-        float masserHourFade = calculateHourFade("Masser");
-        float secundaHourFade = calculateHourFade("Secunda");
-        float masserAngleFade = calculateAngleFade("Masser", angle);
-        float secundaAngleFade = calculateAngleFade("Secunda", angle);
+        float masserHourFade = mTable.mMasser.getHourFade(mHour);
+        float secundaHourFade = mTable.mSecunda.getHourFade(mHour);
+        float masserAngleFade = mTable.mMasser.getAngleFade(angle);
+        float secundaAngleFade = mTable.mSecunda.getAngleFade(angle);
 
         masserAngleFade *= masserHourFade;
         secundaAngleFade *= secundaHourFade;
@@ -439,7 +185,7 @@ void WeatherManager::update(float duration)
         mRendering->getSkyManager()->secundaDisable();
     }
 
-    if (mCurrentWeather == "thunderstorm" && mNextWeather == "")
+    if (mCurrentWeather == WeatherTable::Weather_Thunderstorm && mNextWeather == -1)
     {
         if (mThunderFlash > 0)
         {
@@ -448,19 +194,14 @@ void WeatherManager::update(float duration)
             if (mThunderSoundDelay <= 0)
             {
                 // pick a random sound
-                int sound = rand() % 4;
-                std::string* soundName = NULL;
-                if (sound == 0) soundName = &mThunderSoundID0;
-                else if (sound == 1) soundName = &mThunderSoundID1;
-                else if (sound == 2) soundName = &mThunderSoundID2;
-                else if (sound == 3) soundName = &mThunderSoundID3;
-                MWBase::Environment::get().getSoundManager()->playSound(*soundName, 1.0, 1.0);
+                const std::string& soundName = mTable.mThunderSoundID[rand() % 4];
+                MWBase::Environment::get().getSoundManager()->playSound(soundName, 1.0, 1.0);
                 mThunderSoundDelay = 1000;
             }
 
             mThunderFlash -= duration;
             if (mThunderFlash > 0)
-                mRendering->getSkyManager()->setLightningStrength( mThunderFlash / mThunderThreshold );
+                mRendering->getSkyManager()->setLightningStrength( mThunderFlash / mTable.mThunderThreshold );
             else
             {
                 mThunderChanceNeeded = rand() % 100;
@@ -474,9 +215,9 @@ void WeatherManager::update(float duration)
             mThunderChance += duration*4; // chance increases by 4 percent every second
             if (mThunderChance >= mThunderChanceNeeded)
             {
-                mThunderFlash = mThunderThreshold;
+                mThunderFlash = mTable.mThunderThreshold;
 
-                mRendering->getSkyManager()->setLightningStrength( mThunderFlash / mThunderThreshold );
+                mRendering->getSkyManager()->setLightningStrength( mThunderFlash / mTable.mThunderThreshold );
 
                 mThunderSoundDelay = 0.25;
             }
@@ -493,16 +234,18 @@ void WeatherManager::update(float duration)
 
 
     // Play sounds
-    if (mNextWeather == "")
+    if (mNextWeather == -1)
     {
-        std::string ambientSnd = mWeatherSettings[mCurrentWeather].mAmbientLoopSoundID;
+        const Weather& current = mTable.getWeather(mCurrentWeather);
+
+        const std::string& ambientSnd = current.mAmbientLoopSoundID;
         if (!ambientSnd.empty() && std::find(mSoundsPlaying.begin(), mSoundsPlaying.end(), ambientSnd) == mSoundsPlaying.end())
         {
             mSoundsPlaying.push_back(ambientSnd);
             MWBase::Environment::get().getSoundManager()->playSound(ambientSnd, 1.0, 1.0, MWBase::SoundManager::Play_TypeSfx, MWBase::SoundManager::Play_Loop);
         }
 
-        std::string rainSnd = mWeatherSettings[mCurrentWeather].mRainLoopSoundID;
+        const std::string& rainSnd = current.mRainLoopSoundID;
         if (!rainSnd.empty() && std::find(mSoundsPlaying.begin(), mSoundsPlaying.end(), rainSnd) == mSoundsPlaying.end())
         {
             mSoundsPlaying.push_back(rainSnd);
@@ -515,12 +258,14 @@ void WeatherManager::update(float duration)
 
 void WeatherManager::stopSounds(bool stopAll)
 {
+    const Weather& current = mTable.getWeather(mCurrentWeather);
+
     std::vector<std::string>::iterator it = mSoundsPlaying.begin();
     while (it!=mSoundsPlaying.end())
     {
         if (stopAll ||
-                !((*it == mWeatherSettings[mCurrentWeather].mAmbientLoopSoundID) ||
-                (*it == mWeatherSettings[mCurrentWeather].mRainLoopSoundID)))
+                !((*it == current.mAmbientLoopSoundID) ||
+                (*it == current.mRainLoopSoundID)))
         {
             MWBase::Environment::get().getSoundManager()->stopSound(*it);
             it = mSoundsPlaying.erase(it);
@@ -530,7 +275,7 @@ void WeatherManager::stopSounds(bool stopAll)
     }
 }
 
-Ogre::String WeatherManager::nextWeather(const ESM::Region* region) const
+int WeatherManager::nextWeather(const ESM::Region* region) const
 {
     std::vector<char> probability;
 
@@ -569,29 +314,10 @@ Ogre::String WeatherManager::nextWeather(const ESM::Region* region) const
             break;
     }
 
-    switch (i)
-    {
-        case 1:
-            return "cloudy";
-        case 2:
-            return "foggy";
-        case 3:
-            return "overcast";
-        case 4:
-            return "rain";
-        case 5:
-            return "thunderstorm";
-        case 6:
-            return "ashstorm";
-        case 7:
-            return "blight";
-        case 8:
-            return "snow";
-        case 9:
-            return "blizzard";
-        default: // case 0
-            return "clear";
-    }
+    if (i >= static_cast<unsigned int> (WeatherTable::Weather_Count))
+        return WeatherTable::Weather_Clear;
+
+    return i;
 }
 
 void WeatherManager::setHour(const float hour)
@@ -608,30 +334,7 @@ void WeatherManager::setDate(const int day, const int month)
 unsigned int WeatherManager::getWeatherID() const
 {
     // Source: http://www.uesp.net/wiki/Tes3Mod:GetCurrentWeather
-
-    if (mCurrentWeather == "clear")
-        return 0;
-    else if (mCurrentWeather == "cloudy")
-        return 1;
-    else if (mCurrentWeather == "foggy")
-        return 2;
-    else if (mCurrentWeather == "overcast")
-        return 3;
-    else if (mCurrentWeather == "rain")
-        return 4;
-    else if (mCurrentWeather == "thunderstorm")
-        return 5;
-    else if (mCurrentWeather == "ashstorm")
-        return 6;
-    else if (mCurrentWeather == "blight")
-        return 7;
-    else if (mCurrentWeather == "snow")
-        return 8;
-    else if (mCurrentWeather == "blizzard")
-        return 9;
-
-    else
-        return 0;
+    return mCurrentWeather;
 }
 
 void WeatherManager::changeWeather(const std::string& region, const unsigned int id)
@@ -639,29 +342,7 @@ void WeatherManager::changeWeather(const std::string& region, const unsigned int
     // make sure this region exists
     MWBase::Environment::get().getWorld()->getStore().get<ESM::Region>().find(region);
 
-    std::string weather;
-    if (id==0)
-        weather = "clear";
-    else if (id==1)
-        weather = "cloudy";
-    else if (id==2)
-        weather = "foggy";
-    else if (id==3)
-        weather = "overcast";
-    else if (id==4)
-        weather = "rain";
-    else if (id==5)
-        weather = "thunderstorm";
-    else if (id==6)
-        weather = "ashstorm";
-    else if (id==7)
-        weather = "blight";
-    else if (id==8)
-        weather = "snow";
-    else if (id==9)
-        weather = "blizzard";
-    else
-        weather = "clear";
+    int weather = id < static_cast<unsigned int> (WeatherTable::Weather_Count) ? id : WeatherTable::Weather_Clear;
 
     mRegionOverrides[Misc::StringUtils::lowerCase(region)] = weather;
 
@@ -688,7 +369,7 @@ bool WeatherManager::isDark() const
 {
     bool exterior = (MWBase::Environment::get().getWorld()->isCellExterior()
                      || MWBase::Environment::get().getWorld()->isCellQuasiExterior());
-    return exterior && (mHour < mSunriseTime || mHour > mNightStart - 1);
+    return exterior && (mHour < mTable.mSunriseTime || mHour > mTable.mNightStart - 1);
 }
 
 void WeatherManager::switchToNextWeather(bool instantly)
@@ -701,13 +382,14 @@ void WeatherManager::switchToNextWeather(bool instantly)
         if (mWeatherUpdateTime <= 0 || regionstr != mCurrentRegion)
         {
             mCurrentRegion = regionstr;
-            mWeatherUpdateTime = mHoursBetweenWeatherChanges * 3600;
+            mWeatherUpdateTime = mTable.mHoursBetweenWeatherChanges * 3600;
 
-            std::string weatherType = "clear";
+            int weatherType = WeatherTable::Weather_Clear;
 
-            if (mRegionOverrides.find(regionstr) != mRegionOverrides.end())
+            std::map<std::string, int>::const_iterator iter = mRegionOverrides.find(regionstr);
+            if (iter != mRegionOverrides.end())
             {
-                weatherType = mRegionOverrides[regionstr];
+                weatherType = iter->second;
             }
             else
             {
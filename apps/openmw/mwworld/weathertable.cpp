@@ -0,0 +1,248 @@
+
+#include "weathertable.hpp"
+
+#include <stdexcept>
+
+#include "fallback.hpp"
+
+namespace
+{
+    float lerp (float x, float y, float factor)
+    {
+        return x * (1-factor) + y * factor;
+    }
+
+    Ogre::ColourValue lerp (const Ogre::ColourValue& x, const Ogre::ColourValue& y, float factor)
+    {
+        return x * (1-factor) + y * factor;
+    }
+
+    /// Blends the colours of \a weather for time of day \a from into those for \a to.
+    void blend (MWWorld::WeatherResult& result, const MWWorld::Weather& weather, int from, int to,
+        float factor)
+    {
+        result.mFogColor = lerp (weather.mFogColor[from], weather.mFogColor[to], factor);
+        result.mAmbientColor = lerp (weather.mAmbientColor[from], weather.mAmbientColor[to], factor);
+        result.mSunColor = lerp (weather.mSunColor[from], weather.mSunColor[to], factor);
+        result.mSkyColor = lerp (weather.mSkyColor[from], weather.mSkyColor[to], factor);
+    }
+
+    const char *sWeatherNames[MWWorld::WeatherTable::Weather_Count] =
+    {
+        "Clear", "Cloudy", "Foggy", "Overcast", "Rain", "Thunderstorm", "Ashstorm", "Blight",
+        "Snow", "Blizzard"
+    };
+
+    const char *sCloudTextures[MWWorld::WeatherTable::Weather_Count] =
+    {
+        "tx_sky_clear.dds", "tx_sky_cloudy.dds", "tx_sky_foggy.dds", "tx_sky_overcast.dds",
+        "tx_sky_rainy.dds", "tx_sky_thunder.dds", "tx_sky_ashstorm.dds", "tx_sky_blight.dds",
+        "tx_bm_sky_snow.dds", "tx_bm_sky_blizzard.dds"
+    };
+
+    const char *sTimeOfDayNames[MWWorld::Weather::TOD_Count] =
+    {
+        "Sunrise", "Day", "Sunset", "Night"
+    };
+}
+
+float MWWorld::WeatherTable::Moon::getHourFade (float hour) const
+{
+    if (hour >= mFadeOutStart && hour <= mFadeOutFinish)
+        return (1 - ((hour - mFadeOutStart) / (mFadeOutFinish - mFadeOutStart)));
+    if (hour >= mFadeInStart && hour <= mFadeInFinish)
+        return (1 - ((hour - mFadeInStart) / (mFadeInFinish - mFadeInStart)));
+    else
+        return 1;
+}
+
+float MWWorld::WeatherTable::Moon::getAngleFade (float angle) const
+{
+    if (angle <= mFadeStartAngle && angle >= mFadeEndAngle)
+        return (1 - ((angle - mFadeEndAngle)/(mFadeStartAngle-mFadeEndAngle)));
+    else if (angle > mFadeStartAngle)
+        return 0.f;
+    else
+        return 1.f;
+}
+
+void MWWorld::WeatherTable::readWeather (const Fallback& fallback, int id, const std::string& name)
+{
+    Weather& weather = mWeathers[id];
+    std::string prefix = "Weather_" + name + "_";
+
+    weather.mCloudTexture = sCloudTextures[id];
+    weather.mCloudsMaximumPercent = fallback.getFallbackFloat (prefix + "Clouds_Maximum_Percent");
+    weather.mTransitionDelta = fallback.getFallbackFloat (prefix + "Transition_Delta");
+
+    for (int i=0; i<Weather::TOD_Count; ++i)
+    {
+        std::string time = sTimeOfDayNames[i];
+        weather.mSkyColor[i] = fallback.getFallbackColour (prefix + "Sky_" + time + "_Color");
+        weather.mFogColor[i] = fallback.getFallbackColour (prefix + "Fog_" + time + "_Color");
+        weather.mAmbientColor[i] = fallback.getFallbackColour (prefix + "Ambient_" + time + "_Color");
+        weather.mSunColor[i] = fallback.getFallbackColour (prefix + "Sun_" + time + "_Color");
+    }
+
+    weather.mSunDiscSunsetColor = fallback.getFallbackColour (prefix + "Sun_Disc_Sunset_Color");
+    weather.mLandFogDayDepth = fallback.getFallbackFloat (prefix + "Land_Fog_Day_Depth");
+    weather.mLandFogNightDepth = fallback.getFallbackFloat (prefix + "Land_Fog_Night_Depth");
+    weather.mWindSpeed = fallback.getFallbackFloat (prefix + "Wind_Speed");
+    weather.mCloudSpeed = fallback.getFallbackFloat (prefix + "Cloud_Speed");
+    weather.mGlareView = fallback.getFallbackFloat (prefix + "Glare_View");
+}
+
+void MWWorld::WeatherTable::readMoon (const Fallback& fallback, Moon& moon, const std::string& name)
+{
+    std::string prefix = "Moons_" + name + "_";
+
+    moon.mFadeInStart = fallback.getFallbackFloat (prefix + "Fade_In_Start");
+    moon.mFadeInFinish = fallback.getFallbackFloat (prefix + "Fade_In_Finish");
+    moon.mFadeOutStart = fallback.getFallbackFloat (prefix + "Fade_Out_Start");
+    moon.mFadeOutFinish = fallback.getFallbackFloat (prefix + "Fade_Out_Finish");
+    moon.mFadeStartAngle = fallback.getFallbackFloat (prefix + "Fade_Start_Angle");
+    moon.mFadeEndAngle = fallback.getFallbackFloat (prefix + "Fade_End_Angle");
+}
+
+MWWorld::WeatherTable::WeatherTable (const Fallback& fallback)
+{
+    for (int i=0; i<4; ++i)
+    {
+        std::string index (1, static_cast<char> ('0' + i));
+        mThunderSoundID[i] = fallback.getFallbackString ("Weather_Thunderstorm_Thunder_Sound_ID_" + index);
+    }
+
+    mSunriseTime = fallback.getFallbackFloat ("Weather_Sunrise_Time");
+    mSunsetTime = fallback.getFallbackFloat ("Weather_Sunset_Time");
+    mSunriseDuration = fallback.getFallbackFloat ("Weather_Sunrise_Duration");
+    mSunsetDuration = fallback.getFallbackFloat ("Weather_Sunset_Duration");
+    mHoursBetweenWeatherChanges = fallback.getFallbackFloat ("Weather_Hours_Between_Weather_Changes");
+    mThunderFrequency = fallback.getFallbackFloat ("Weather_Thunderstorm_Thunder_Frequency");
+    mThunderThreshold = fallback.getFallbackFloat ("Weather_Thunderstorm_Thunder_Threshold");
+
+    //Some useful values
+    /* TODO: Use pre-sunrise_time, pre-sunset_time,
+     * post-sunrise_time, and post-sunset_time to better
+     * describe sunrise/sunset time.
+     * These values are fallbacks attached to weather.
+     */
+    mNightStart = mSunsetTime + mSunsetDuration;
+    mNightEnd = mSunriseTime - 0.5;
+    mDayStart = mSunriseTime + mSunriseDuration;
+    mDayEnd = mSunsetTime;
+
+    for (int i=0; i<Weather_Count; ++i)
+        readWeather (fallback, i, sWeatherNames[i]);
+
+    mWeathers[Weather_Thunderstorm].mRainLoopSoundID = "rain heavy";
+    mWeathers[Weather_Rain].mRainLoopSoundID = "rain";
+    mWeathers[Weather_Ashstorm].mAmbientLoopSoundID = "ashstorm";
+    mWeathers[Weather_Blight].mAmbientLoopSoundID = "blight";
+    mWeathers[Weather_Blizzard].mAmbientLoopSoundID = "BM Blizzard";
+
+    readMoon (fallback, mMasser, "Masser");
+    readMoon (fallback, mSecunda, "Secunda");
+}
+
+const MWWorld::Weather& MWWorld::WeatherTable::getWeather (int id) const
+{
+    if (id<0 || id>=Weather_Count)
+        throw std::runtime_error ("invalid weather ID");
+
+    return mWeathers[id];
+}
+
+void MWWorld::WeatherTable::getResult (WeatherResult& result, int id, float hour) const
+{
+    const Weather& current = getWeather (id);
+
+    result.mCloudTexture = current.mCloudTexture;
+    result.mCloudBlendFactor = 0;
+    result.mCloudOpacity = current.mCloudsMaximumPercent;
+    result.mWindSpeed = current.mWindSpeed;
+    result.mCloudSpeed = current.mCloudSpeed;
+    result.mGlareView = current.mGlareView;
+    result.mAmbientLoopSoundID = current.mAmbientLoopSoundID;
+    result.mSunColor = current.mSunDiscSunsetColor;
+
+    result.mNight = (hour < mSunriseTime || hour > mNightStart - 1);
+
+    result.mFogDepth = result.mNight ? current.mLandFogNightDepth : current.mLandFogDayDepth;
+
+    // night
+    if (hour <= mNightEnd || hour >= mNightStart + 1)
+    {
+        blend (result, current, Weather::TOD_Night, Weather::TOD_Night, 0);
+        result.mNightFade = 1.f;
+    }
+
+    // sunrise
+    else if (hour >= mNightEnd && hour <= mDayStart + 1)
+    {
+        if (hour <= mSunriseTime)
+        {
+            // fade in
+            float factor = (mSunriseTime - hour) / 0.5f;
+            blend (result, current, Weather::TOD_Sunrise, Weather::TOD_Night, factor);
+            result.mNightFade = factor;
+        }
+        else
+        {
+            // fade out
+            float factor = (hour - mSunriseTime) / 3.f;
+            blend (result, current, Weather::TOD_Sunrise, Weather::TOD_Day, factor);
+        }
+    }
+
+    // day
+    else if (hour >= mDayStart + 1 && hour <= mDayEnd - 1)
+    {
+        blend (result, current, Weather::TOD_Day, Weather::TOD_Day, 0);
+    }
+
+    // sunset
+    else if (hour >= mDayEnd - 1 && hour <= mNightStart + 1)
+    {
+        if (hour <= mDayEnd + 1)
+        {
+            // fade in
+            float factor = ((mDayEnd + 1) - hour) / 2;
+            blend (result, current, Weather::TOD_Sunset, Weather::TOD_Day, factor);
+        }
+        else
+        {
+            // fade out
+            float factor = (hour - (mDayEnd + 1)) / 2.f;
+            blend (result, current, Weather::TOD_Sunset, Weather::TOD_Night, factor);
+            result.mNightFade = factor;
+        }
+    }
+}
+
+void MWWorld::WeatherTable::getResult (WeatherResult& result, int id, int nextId, float factor,
+    float hour) const
+{
+    getResult (result, id, hour);
+    const WeatherResult current = result;
+    getResult (result, nextId, hour);
+    const WeatherResult other = result;
+
+    result.mCloudTexture = current.mCloudTexture;
+    result.mNextCloudTexture = other.mCloudTexture;
+    result.mCloudBlendFactor = factor;
+
+    result.mFogColor = lerp (current.mFogColor, other.mFogColor, factor);
+    result.mSunColor = lerp (current.mSunColor, other.mSunColor, factor);
+    result.mSkyColor = lerp (current.mSkyColor, other.mSkyColor, factor);
+
+    result.mAmbientColor = lerp (current.mAmbientColor, other.mAmbientColor, factor);
+    result.mSunDiscColor = lerp (current.mSunDiscColor, other.mSunDiscColor, factor);
+    result.mFogDepth = lerp (current.mFogDepth, other.mFogDepth, factor);
+    result.mWindSpeed = lerp (current.mWindSpeed, other.mWindSpeed, factor);
+    result.mCloudSpeed = lerp (current.mCloudSpeed, other.mCloudSpeed, factor);
+    result.mCloudOpacity = lerp (current.mCloudOpacity, other.mCloudOpacity, factor);
+    result.mGlareView = lerp (current.mGlareView, other.mGlareView, factor);
+    result.mNightFade = lerp (current.mNightFade, other.mNightFade, factor);
+
+    result.mNight = current.mNight;
+}
@@ -0,0 +1,181 @@
+#ifndef GAME_MWWORLD_WEATHERTABLE_H
+#define GAME_MWWORLD_WEATHERTABLE_H
+
+#include <OgreString.h>
+#include <OgreColourValue.h>
+
+namespace MWWorld
+{
+    class Fallback;
+
+    /// Defines the actual weather that results from weather setting (see below), time of day and weather transition
+    struct WeatherResult
+    {
+        Ogre::String mCloudTexture;
+        Ogre::String mNextCloudTexture;
+        float mCloudBlendFactor;
+
+        Ogre::ColourValue mFogColor;
+
+        Ogre::ColourValue mAmbientColor;
+
+        Ogre::ColourValue mSkyColor;
+
+        Ogre::ColourValue mSunColor;
+
+        Ogre::ColourValue mSunDiscColor;
+
+        float mFogDepth;
+
+        float mWindSpeed;
+
+        float mCloudSpeed;
+
+        float mCloudOpacity;
+
+        float mGlareView;
+
+        bool mNight; // use night skybox
+        float mNightFade; // fading factor for night skybox
+
+        Ogre::String mAmbientLoopSoundID;
+    };
+
+
+    /// Defines a single weather setting (according to INI)
+    struct Weather
+    {
+        /// Index into the colour arrays below
+        enum TimeOfDay
+        {
+            TOD_Sunrise,
+            TOD_Day,
+            TOD_Sunset,
+            TOD_Night,
+            TOD_Count
+        };
+
+        Ogre::String mCloudTexture;
+
+        // Sky (atmosphere) colors
+        Ogre::ColourValue mSkyColor[TOD_Count];
+
+        // Fog colors
+        Ogre::ColourValue mFogColor[TOD_Count];
+
+        // Ambient lighting colors
+        Ogre::ColourValue mAmbientColor[TOD_Count];
+
+        // Sun (directional) lighting colors
+        Ogre::ColourValue mSunColor[TOD_Count];
+
+        // Fog depth/density
+        float   mLandFogDayDepth,
+                mLandFogNightDepth;
+
+        // Color modulation for the sun itself during sunset (not completely sure)
+        Ogre::ColourValue mSunDiscSunsetColor;
+
+        // Duration of weather transition (in days)
+        float mTransitionDelta;
+
+        // No idea what this one is used for?
+        float mWindSpeed;
+
+        // Cloud animation speed multiplier
+        float mCloudSpeed;
+
+        // Multiplier for clouds transparency
+        float mCloudsMaximumPercent;
+
+        // Value between 0 and 1, defines the strength of the sun glare effect
+        float mGlareView;
+
+        // Sound effect
+        // This is used for Blight, Ashstorm and Blizzard (Bloodmoon)
+        Ogre::String mAmbientLoopSoundID;
+
+        // Rain sound effect
+        Ogre::String mRainLoopSoundID;
+
+        /// \todo disease chance
+    };
+
+    /// \brief Weather and moon settings, read from the fallback values once
+    ///
+    /// Weathers are addressed by the IDs used by the GetCurrentWeather script function.
+    class WeatherTable
+    {
+        public:
+
+            enum WeatherId
+            {
+                Weather_Clear,
+                Weather_Cloudy,
+                Weather_Foggy,
+                Weather_Overcast,
+                Weather_Rain,
+                Weather_Thunderstorm,
+                Weather_Ashstorm,
+                Weather_Blight,
+                Weather_Snow,
+                Weather_Blizzard,
+                Weather_Count
+            };
+
+            struct Moon
+            {
+                float mFadeInStart;
+                float mFadeInFinish;
+                float mFadeOutStart;
+                float mFadeOutFinish;
+                float mFadeStartAngle;
+                float mFadeEndAngle;
+
+                float getHourFade (float hour) const;
+
+                float getAngleFade (float angle) const;
+            };
+
+            float mSunriseTime;
+            float mSunsetTime;
+            float mSunriseDuration;
+            float mSunsetDuration;
+            float mHoursBetweenWeatherChanges;
+            float mThunderFrequency;
+            float mThunderThreshold;
+            float mNightStart;
+            float mNightEnd;
+            float mDayStart;
+            float mDayEnd;
+            std::string mThunderSoundID[4];
+
+            Moon mMasser;
+            Moon mSecunda;
+
+        private:
+
+            Weather mWeathers[Weather_Count];
+
+            void readWeather (const Fallback& fallback, int id, const std::string& name);
+
+            void readMoon (const Fallback& fallback, Moon& moon, const std::string& name);
+
+        public:
+
+            WeatherTable (const Fallback& fallback);
+
+            const Weather& getWeather (int id) const;
+            ///< \a id must be a valid weather ID.
+
+            void getResult (WeatherResult& result, int id, float hour) const;
+            ///< Weather \a id at \a hour.
+
+            void getResult (WeatherResult& result, int id, int nextId, float factor, float hour) const;
+            ///< Transition from weather \a id to weather \a nextId at \a hour.
+            ///
+            /// \param factor Progress of the transition (0: \a id only, 1: \a nextId only)
+    };
+}
+
+#endif
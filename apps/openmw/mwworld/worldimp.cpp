@@ -524,9 +524,9 @@ namespace MWWorld
 
     void World::addContainerScripts(const Ptr& reference, CellStore * cell)
     {
-        if( reference.getTypeName()==typeid (ESM::Container).name() ||
-            reference.getTypeName()==typeid (ESM::NPC).name() ||
-            reference.getTypeName()==typeid (ESM::Creature).name())
+        if( reference.is<ESM::Container>() ||
+            reference.is<ESM::NPC>() ||
+            reference.is<ESM::Creature>())
         {
             MWWorld::ContainerStore& container = MWWorld::Class::get(reference).getContainerStore(reference);
             for(MWWorld::ContainerStoreIterator it = container.begin(); it != container.end(); ++it)
@@ -559,9 +559,9 @@ namespace MWWorld
 
     void World::removeContainerScripts(const Ptr& reference)
     {
-        if( reference.getTypeName()==typeid (ESM::Container).name() ||
-            reference.getTypeName()==typeid (ESM::NPC).name() ||
-            reference.getTypeName()==typeid (ESM::Creature).name())
+        if( reference.is<ESM::Container>() ||
+            reference.is<ESM::NPC>() ||
+            reference.is<ESM::Creature>())
         {
             MWWorld::ContainerStore& container = MWWorld::Class::get(reference).getContainerStore(reference);
             for(MWWorld::ContainerStoreIterator it = container.begin(); it != container.end(); ++it)
@@ -1145,6 +1145,8 @@ namespace MWWorld
             moveObjectImp(player->first, player->second.x, player->second.y, player->second.z);
 
         mPhysEngine->stepSimulation(duration);
+
+        mPhysics->updateLineOfSightCache(duration);
     }
 
     bool World::castRay (float x1, float y1, float z1, float x2, float y2, float z2)
@@ -1634,7 +1636,7 @@ namespace MWWorld
                 && isLevitationEnabled())
             return true;
 
-        const OEngine::Physic::PhysicActor *actor = mPhysEngine->getCharacter(ptr.getRefData().getHandle());
+        const OEngine::Physic::PhysicActor *actor = mPhysics->getActor(ptr);
         if(!actor || !actor->getCollisionMode())
             return true;
 
@@ -1659,7 +1661,7 @@ namespace MWWorld
         float *fpos = object.getRefData().getPosition().pos;
         Ogre::Vector3 pos(fpos[0], fpos[1], fpos[2]);
 
-        const OEngine::Physic::PhysicActor *actor = mPhysEngine->getCharacter(object.getRefData().getHandle());
+        const OEngine::Physic::PhysicActor *actor = mPhysics->getActor(object);
         if(actor) pos.z += 1.85*actor->getHalfExtents().z;
 
         return isUnderwater(object.getCell(), pos);
@@ -1673,7 +1675,7 @@ namespace MWWorld
         Ogre::Vector3 pos(fpos[0], fpos[1], fpos[2]);
 
         /// \fixme 3/4ths submerged?
-        const OEngine::Physic::PhysicActor *actor = mPhysEngine->getCharacter(object.getRefData().getHandle());
+        const OEngine::Physic::PhysicActor *actor = mPhysics->getActor(object);
         if(actor) pos.z += actor->getHalfExtents().z * 1.5;
 
         return isUnderwater(object.getCell(), pos);
@@ -1690,8 +1692,7 @@ namespace MWWorld
 
     bool World::isOnGround(const MWWorld::Ptr &ptr) const
     {
-        RefData &refdata = ptr.getRefData();
-        const OEngine::Physic::PhysicActor *physactor = mPhysEngine->getCharacter(refdata.getHandle());
+        const OEngine::Physic::PhysicActor *physactor = mPhysics->getActor(ptr);
         return physactor && physactor->getOnGround();
     }
 
@@ -1867,22 +1868,28 @@ namespace MWWorld
     {
         if (!targetNpc.getRefData().isEnabled() || !npc.getRefData().isEnabled())
             return false; // cannot get LOS unless both NPC's are enabled
-        Ogre::Vector3 halfExt1 = mPhysEngine->getCharacter(npc.getRefData().getHandle())->getHalfExtents();
-        float* pos1 = npc.getRefData().getPosition().pos;
-        Ogre::Vector3 halfExt2 = mPhysEngine->getCharacter(targetNpc.getRefData().getHandle())->getHalfExtents();
-        float* pos2 = targetNpc.getRefData().getPosition().pos;
+        return mPhysics->getLineOfSight(npc, targetNpc);
+    }
 
-        btVector3 from(pos1[0],pos1[1],pos1[2]+halfExt1.z);
-        btVector3 to(pos2[0],pos2[1],pos2[2]+halfExt2.z);
+    void World::getLOS(const MWWorld::Ptr& npc, const std::vector<MWWorld::Ptr>& targets,
+        std::vector<bool>& results)
+    {
+        if (!npc.getRefData().isEnabled())
+        {
+            results.assign(targets.size(), false);
+            return;
+        }
 
-        std::pair<std::string, float> result = mPhysEngine->rayTest(from, to,false);
-        if(result.first == "") return true;
-        return false;
+        mPhysics->getLineOfSight(npc, targets, results);
+
+        for (std::size_t i=0; i<targets.size(); ++i)
+            if (!targets[i].getRefData().isEnabled())
+                results[i] = false;
     }
 
     void World::enableActorCollision(const MWWorld::Ptr& actor, bool enable)
     {
-        OEngine::Physic::PhysicActor *physicActor = mPhysEngine->getCharacter(actor.getRefData().getHandle());
+        OEngine::Physic::PhysicActor *physicActor = mPhysics->getActor(actor);
 
         physicActor->enableCollisions(enable);
     }
@@ -2200,7 +2207,7 @@ namespace MWWorld
             return;
 
         // Spawn at 0.75 * ActorHeight
-        float height = mPhysEngine->getCharacter(actor.getRefData().getHandle())->getHalfExtents().z * 2 * 0.75;
+        float height = mPhysics->getActor(actor)->getHalfExtents().z * 2 * 0.75;
 
         MWWorld::ManualRef ref(getStore(), projectileModel);
         ESM::Position pos;
@@ -2542,7 +2549,7 @@ namespace MWWorld
                 return true;
 
             // Consider references inside containers as well
-            if (ptr.getClass().isActor() || ptr.getClass().getTypeName() == typeid(ESM::Container).name())
+            if (ptr.getClass().isActor() || ptr.is<ESM::Container>())
             {
                 MWWorld::ContainerStore& store = ptr.getClass().getContainerStore(ptr);
                 {
@@ -2565,7 +2572,7 @@ namespace MWWorld
 
         bool needToAdd (MWWorld::Ptr ptr)
         {
-            if (mType == World::Detect_Creature && ptr.getClass().getTypeName() != typeid(ESM::Creature).name())
+            if (mType == World::Detect_Creature && !ptr.is<ESM::Creature>())
                 return false;
             if (mType == World::Detect_Key && !ptr.getClass().isKey(ptr))
                 return false;
@@ -505,6 +505,10 @@ namespace MWWorld
             virtual bool getLOS(const MWWorld::Ptr& npc,const MWWorld::Ptr& targetNpc);
             ///< get Line of Sight (morrowind stupid implementation)
 
+            virtual void getLOS(const MWWorld::Ptr& npc, const std::vector<MWWorld::Ptr>& targets,
+                std::vector<bool>& results);
+            ///< Batched version of getLOS.
+
             virtual void enableActorCollision(const MWWorld::Ptr& actor, bool enable);
 
             virtual int canRest();
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "components/esm/defs.hpp"
+#include "components/esm/esmreader.hpp"
+#include "components/esm/esmwriter.hpp"
+#include "components/esm/gamesettingtable.hpp"
+
+#include "apps/openmw/mwworld/store.hpp"
+
+namespace
+{
+    /// Load the GMSTs of \a reader's file into \a store, as ESMStore::load does
+    void load (ESM::ESMReader& reader, MWWorld::Store<ESM::GameSetting>& store)
+    {
+        while (reader.hasMoreRecs())
+        {
+            ESM::NAME name = reader.getRecName();
+            reader.getRecHeader();
+
+            if (name.val!=ESM::REC_GMST)
+            {
+                reader.skipRecord();
+                continue;
+            }
+
+            store.load (reader, reader.getHNOString ("NAME"));
+        }
+
+        store.setUp();
+    }
+
+    ESM::GameSetting makeFloat (const std::string& id, float value)
+    {
+        ESM::GameSetting setting;
+        setting.mId = id;
+        setting.mValue.setType (ESM::VT_Float);
+        setting.mValue.setFloat (value);
+        return setting;
+    }
+}
+
+struct GameSettingTableTest : public ::testing::Test
+{
+  protected:
+    std::string mFile;
+    ESM::ESMWriter mWriter;
+
+    virtual void SetUp()
+    {
+        mFile = "gamesettingtable_test.esp";
+    }
+
+    virtual void TearDown()
+    {
+        std::remove (mFile.c_str());
+    }
+
+    void writeFloat (const std::string& id, float value)
+    {
+        write (makeFloat (id, value));
+    }
+
+    void writeInt (const std::string& id, int value)
+    {
+        ESM::GameSetting setting;
+        setting.mId = id;
+        setting.mValue.setType (ESM::VT_Int);
+        setting.mValue.setInteger (value);
+        write (setting);
+    }
+
+    void writeString (const std::string& id, const std::string& value)
+    {
+        ESM::GameSetting setting;
+        setting.mId = id;
+        setting.mValue.setType (ESM::VT_String);
+        setting.mValue.setString (value);
+        write (setting);
+    }
+
+    void write (const ESM::GameSetting& setting)
+    {
+        mWriter.startRecord (ESM::REC_GMST);
+        mWriter.writeHNCString ("NAME", setting.mId);
+        setting.save (mWriter);
+        mWriter.endRecord (ESM::REC_GMST);
+    }
+};
+
+TEST_F(GameSettingTableTest, matches_loaded_store)
+{
+    std::ofstream stream (mFile.c_str(), std::ios_base::out | std::ios_base::binary);
+
+    mWriter.setFormat (0);
+    mWriter.setRecordCount (5);
+    mWriter.save (stream);
+    writeFloat ("fFatigueRunBase", 5.5f);
+    writeFloat ("fCombatKODamageMult", 1.5f);
+    writeInt ("iLevelUpTotal", 10);
+    writeInt ("iBarterSuccessDisposition", 1);
+    writeString ("sNotifyMessage49", "%s is not interested");
+    mWriter.close();
+    stream.close();
+
+    ESM::ESMReader reader;
+    reader.open (mFile);
+
+    MWWorld::Store<ESM::GameSetting> store;
+    load (reader, store);
+
+    ASSERT_EQ(5u, store.getSize());
+
+    ESM::GameSettingTable table;
+    std::ostringstream log; // missing GMSTs are reported
+    std::streambuf *cerr = std::cerr.rdbuf (log.rdbuf());
+    table.fill (store);
+    std::cerr.rdbuf (cerr);
+
+    EXPECT_EQ(store.search ("fFatigueRunBase")->getFloat(), table.fFatigueRunBase);
+    EXPECT_EQ(store.search ("fCombatKODamageMult")->getFloat(), table.fCombatKODamageMult);
+    EXPECT_EQ(store.search ("iLevelUpTotal")->getInt(), table.iLevelUpTotal);
+    EXPECT_EQ(store.search ("iBarterSuccessDisposition")->getInt(), table.iBarterSuccessDisposition);
+    EXPECT_EQ(5.5f, table.fFatigueRunBase);
+    EXPECT_EQ(10, table.iLevelUpTotal);
+
+    // not in the file
+    EXPECT_EQ(0, store.search ("fFatigueRunMult"));
+    EXPECT_EQ(0.0f, table.fFatigueRunMult);
+    EXPECT_EQ(0, table.iLevelUpMajorMult);
+}
+
+TEST_F(GameSettingTableTest, refill_replaces_previous_values)
+{
+    MWWorld::Store<ESM::GameSetting> store;
+    store.insertStatic (makeFloat ("flevelmod", 5));
+
+    std::ostringstream log;
+    std::streambuf *cerr = std::cerr.rdbuf (log.rdbuf());
+
+    ESM::GameSettingTable table;
+    table.fill (store);
+    EXPECT_EQ(5.0f, table.fLevelMod);
+
+    store.insertStatic (makeFloat ("flevelmod", 7));
+    table.fill (store);
+    EXPECT_EQ(7.0f, table.fLevelMod);
+
+    log.str ("");
+    store.eraseStatic ("flevelmod");
+    table.fill (store);
+
+    std::cerr.rdbuf (cerr);
+
+    EXPECT_EQ(0.0f, table.fLevelMod);
+    EXPECT_NE(std::string::npos, log.str().find ("GMST fLevelMod not found"));
+}
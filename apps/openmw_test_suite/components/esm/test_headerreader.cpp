@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "components/esm/headerreader.hpp"
+
+namespace
+{
+    void writeSub (std::string& record, const char *name, const std::string& data)
+    {
+        uint32_t size = data.size();
+        record.append (name, 4);
+        record.append (reinterpret_cast<const char *> (&size), sizeof (size));
+        record.append (data);
+    }
+
+    void writeRecord (std::ofstream& stream, const char *name, const std::string& data)
+    {
+        uint32_t size = data.size();
+        uint32_t flags[2] = { 0, 0 };
+        stream.write (name, 4);
+        stream.write (reinterpret_cast<const char *> (&size), sizeof (size));
+        stream.write (reinterpret_cast<const char *> (flags), sizeof (flags));
+        stream.write (data.c_str(), data.size());
+    }
+}
+
+struct HeaderReaderTest : public ::testing::Test
+{
+  protected:
+    std::string mFile;
+
+    virtual void SetUp()
+    {
+        mFile = "headerreader_test.esp";
+    }
+
+    virtual void TearDown()
+    {
+        std::remove (mFile.c_str());
+    }
+
+    void writeFile (const std::string& header, bool moreRecords = true)
+    {
+        std::ofstream stream (mFile.c_str(), std::ios_base::out | std::ios_base::binary);
+        writeRecord (stream, "TES3", header);
+
+        if (moreRecords)
+            writeRecord (stream, "GLOB", std::string (16, 'x'));
+    }
+
+    std::string hedr (const std::string& author, const std::string& desc)
+    {
+        ESM::Header::Data data;
+        data.version = ESM::VER_13;
+        data.type = 0;
+        std::memset (data.author.name, 0, sizeof (data.author.name));
+        std::memset (data.desc.name, 0, sizeof (data.desc.name));
+        data.author.assign (author);
+        data.desc.assign (desc);
+        data.records = 1;
+        return std::string (reinterpret_cast<const char *> (&data), sizeof (data));
+    }
+
+    std::string data (uint64_t size)
+    {
+        return std::string (reinterpret_cast<const char *> (&size), sizeof (size));
+    }
+};
+
+TEST_F(HeaderReaderTest, reads_header_and_masters)
+{
+    std::string header;
+    writeSub (header, "HEDR", hedr ("Author", "Some description"));
+    writeSub (header, "MAST", std::string ("Morrowind.esm", 14));
+    writeSub (header, "DATA", data (79837557));
+    writeSub (header, "MAST", std::string ("Tribunal.esm", 13));
+    writeSub (header, "DATA", data (4565686));
+    writeFile (header);
+
+    ESM::Header result;
+    ESM::HeaderReader().read (mFile, result);
+
+    ASSERT_EQ(0, result.mFormat);
+    ASSERT_EQ(static_cast<unsigned int> (ESM::VER_13), result.mData.version);
+    ASSERT_EQ("Author", result.mData.author.toString());
+    ASSERT_EQ("Some description", result.mData.desc.toString());
+    ASSERT_EQ(2u, result.mMaster.size());
+    ASSERT_EQ("Morrowind.esm", result.mMaster[0].name);
+    ASSERT_EQ(79837557u, result.mMaster[0].size);
+    ASSERT_EQ("Tribunal.esm", result.mMaster[1].name);
+    ASSERT_EQ(4565686u, result.mMaster[1].size);
+}
+
+TEST_F(HeaderReaderTest, reads_format)
+{
+    std::string header;
+    int format = 1;
+    writeSub (header, "FORM", std::string (reinterpret_cast<const char *> (&format), sizeof (format)));
+    writeSub (header, "HEDR", hedr ("", ""));
+    writeFile (header, false);
+
+    ESM::Header result;
+    ESM::HeaderReader().read (mFile, result);
+
+    ASSERT_EQ(1, result.mFormat);
+    ASSERT_TRUE(result.mMaster.empty());
+}
+
+TEST_F(HeaderReaderTest, rejects_other_files)
+{
+    std::ofstream stream (mFile.c_str(), std::ios_base::out | std::ios_base::binary);
+    writeRecord (stream, "GLOB", std::string (16, 'x'));
+    stream.close();
+
+    ESM::Header result;
+    ASSERT_THROW(ESM::HeaderReader().read (mFile, result), std::runtime_error);
+}
+
+TEST_F(HeaderReaderTest, rejects_truncated_header)
+{
+    std::string header;
+    writeSub (header, "HEDR", hedr ("Author", "Description"));
+    writeSub (header, "MAST", std::string ("Morrowind.esm", 14));
+
+    // claim a longer subrecord than the record contains
+    header[header.size()-14-4] = 100;
+    writeFile (header);
+
+    ESM::Header result;
+    ASSERT_THROW(ESM::HeaderReader().read (mFile, result), std::runtime_error);
+}
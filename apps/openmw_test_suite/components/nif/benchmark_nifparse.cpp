@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <new>
+
+#include <boost/detail/atomic_count.hpp>
+
+#include "niftest.hpp"
+
+namespace
+{
+    boost::detail::atomic_count sAllocations (0);
+}
+
+// Count the heap allocations of the whole program. This replaces the global operator new, so the
+// benchmark has an executable of its own instead of being part of openmw_test_suite.
+void *operator new (std::size_t size) throw (std::bad_alloc)
+{
+    ++sAllocations;
+
+    if (void *data = std::malloc (size ? size : 1))
+        return data;
+
+    throw std::bad_alloc();
+}
+
+void operator delete (void *data) throw()
+{
+    std::free (data);
+}
+
+// Not a correctness test; reports the time and the number of heap allocations of parsing a file
+// with many small records and destroying the result again.
+TEST_F(NifParseTest, parse_and_destroy_benchmark)
+{
+    const int cycles = 50;
+
+    long allocations = sAllocations;
+    std::clock_t start = std::clock();
+
+    for (int i=0; i<cycles; ++i)
+        Nif::NIFFile::create (mFile);
+
+    std::clock_t time = std::clock() - start;
+    allocations = sAllocations - allocations;
+
+    std::cout
+        << "  " << cycles << " x 2000 records\n"
+        << "  parse and destroy: " << 1000.0 * time / CLOCKS_PER_SEC << " ms, "
+        << allocations / cycles << " allocations per file"
+        << std::endl;
+
+    EXPECT_GT(allocations, 0);
+}
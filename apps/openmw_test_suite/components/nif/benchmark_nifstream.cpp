@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+
+#include <ctime>
+#include <iostream>
+#include <string>
+
+#include "components/nif/niffile.hpp"
+
+#include "niftest.hpp"
+
+// Not a correctness test; reports how fast NIFStream decodes the arrays and key lists that make
+// up most of the data in mesh and animation files.
+TEST(NifStreamBenchmark, parse_throughput)
+{
+    const int files = 20;
+    const int shapesPerFile = 50;
+
+    std::string data = NifTest::makeFile (shapesPerFile);
+
+    std::clock_t start = std::clock();
+    size_t vertices = 0;
+
+    for (int i=0; i<files; ++i)
+    {
+        Nif::NIFStream nif (0, NifTest::openMemory (data));
+
+        for (int j=0; j<shapesPerFile; ++j)
+        {
+            NifTest::Shape shape;
+            shape.read (nif);
+            vertices += shape.mVertices.size();
+        }
+    }
+
+    double seconds = static_cast<double> (std::clock() - start) / CLOCKS_PER_SEC;
+    double megabytes = static_cast<double> (data.size()) * files / (1024 * 1024);
+
+    std::cout
+        << "  " << files << " files of " << data.size() / 1024 << " KiB\n"
+        << "  parse time: " << 1000.0 * seconds << " ms";
+
+    if (seconds>0)
+        std::cout << " (" << megabytes / seconds << " MiB/s)";
+
+    std::cout << std::endl;
+
+    EXPECT_EQ(static_cast<size_t> (files * shapesPerFile * NifTest::sVertices), vertices);
+}
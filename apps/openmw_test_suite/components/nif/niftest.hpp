@@ -0,0 +1,253 @@
+#ifndef OPENMW_TEST_SUITE_COMPONENTS_NIF_NIFTEST_H
+#define OPENMW_TEST_SUITE_COMPONENTS_NIF_NIFTEST_H
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <OgreDataStream.h>
+#include <OgreLogManager.h>
+#include <OgreArchiveManager.h>
+#include <OgreFileSystem.h>
+#include <OgreResourceGroupManager.h>
+
+#include "components/nif/niffile.hpp"
+
+namespace NifTest
+{
+    /// Writes NIF data in the file's byte order (little-endian), independently of NIFStream
+    class NifWriter
+    {
+            std::string mData;
+
+        public:
+
+            void writeInt (uint32_t value)
+            {
+                for (int i=0; i<4; ++i)
+                    mData += static_cast<char> ((value>>(8*i)) & 0xff);
+            }
+
+            void writeShort (uint16_t value)
+            {
+                mData += static_cast<char> (value & 0xff);
+                mData += static_cast<char> (value>>8);
+            }
+
+            void writeFloat (float value)
+            {
+                union {
+                    float f;
+                    uint32_t i;
+                } u;
+                u.f = value;
+                writeInt (u.i);
+            }
+
+            void writeString (const std::string& text)
+            {
+                writeInt (text.size());
+                mData += text;
+            }
+
+            /// Write \a text without a length (e.g. the header line of a file)
+            void writeText (const std::string& text)
+            {
+                mData += text;
+            }
+
+            const std::string& getData() const { return mData; }
+
+            void save (const std::string& name) const
+            {
+                std::ofstream stream (name.c_str(), std::ios_base::out | std::ios_base::binary);
+                stream << mData;
+            }
+    };
+
+    /// Write a NIF file with \a count records: a chain of string extra data records alternating
+    /// with float data records (small records with and without a key list each)
+    inline void writeNif (const std::string& name, int count)
+    {
+        NifWriter writer;
+
+        writer.writeText ("NetImmerse File Format, Version 4.0.0.2\n");
+        writer.writeInt (0x04000002); // version
+        writer.writeInt (count);
+
+        for (int i=0; i<count; ++i)
+        {
+            if (i%2==0)
+            {
+                writer.writeString ("NiStringExtraData");
+                writer.writeInt (i+2<count ? i+2 : -1); // next extra data
+                writer.writeInt (7);
+                writer.writeString ("MRK");
+            }
+            else
+            {
+                writer.writeString ("NiFloatData");
+                writer.writeInt (4); // keys
+                writer.writeInt (1); // linear interpolation
+                for (int j=0; j<4; ++j)
+                {
+                    writer.writeFloat (j);
+                    writer.writeFloat (i);
+                }
+            }
+        }
+
+        writer.writeInt (1); // number of roots
+        writer.writeInt (0);
+
+        writer.save (name);
+    }
+
+    /// Value of the \a index-th float written to a test file (exactly representable)
+    inline float makeFloat (int index)
+    {
+        return (index % 4093) * 0.125f - 200.0f;
+    }
+
+    /// Arrays and key lists as found in a typical shape and its controllers
+    struct Shape
+    {
+        std::vector<Ogre::Vector3> mVertices;
+        std::vector<Ogre::Vector3> mNormals;
+        std::vector<Ogre::Vector2> mUVs;
+        std::vector<short> mTriangles;
+        Nif::QuaternionKeyList mRotations;
+        Nif::Vector3KeyList mTranslations;
+        Nif::FloatKeyList mScales;
+
+        void read (Nif::NIFStream& nif)
+        {
+            int verts = nif.getInt();
+            nif.getVector3s (mVertices, verts);
+            nif.getVector3s (mNormals, verts);
+            nif.getVector2s (mUVs, verts);
+            nif.getShorts (mTriangles, nif.getInt());
+            mRotations.read (&nif);
+            mTranslations.read (&nif);
+            mScales.read (&nif);
+        }
+    };
+
+    const int sVertices = 500;
+    const int sKeys = 100;
+
+    inline void writeShape (NifWriter& writer)
+    {
+        writer.writeInt (sVertices);
+
+        int index = 0;
+        for (int i=0; i<sVertices*(3+3+2); ++i)
+            writer.writeFloat (makeFloat (index++));
+
+        writer.writeInt (sVertices*3);
+        for (int i=0; i<sVertices*3; ++i)
+            writer.writeShort (static_cast<uint16_t> (i*7 - 1000));
+
+        // rotations: linear (time, w, x, y, z)
+        writer.writeInt (sKeys);
+        writer.writeInt (1);
+        for (int i=0; i<sKeys*5; ++i)
+            writer.writeFloat (makeFloat (index++));
+
+        // translations: TBC (time, x, y, z, tension, bias, continuity)
+        writer.writeInt (sKeys);
+        writer.writeInt (3);
+        for (int i=0; i<sKeys*7; ++i)
+            writer.writeFloat (makeFloat (index++));
+
+        // scales: quadratic (time, value, forward, backward)
+        writer.writeInt (sKeys);
+        writer.writeInt (2);
+        for (int i=0; i<sKeys*4; ++i)
+            writer.writeFloat (makeFloat (index++));
+    }
+
+    inline std::string makeFile (int shapes)
+    {
+        NifWriter writer;
+
+        for (int i=0; i<shapes; ++i)
+            writeShape (writer);
+
+        return writer.getData();
+    }
+
+    inline Ogre::DataStreamPtr openMemory (std::string& data)
+    {
+        return Ogre::DataStreamPtr (new Ogre::MemoryDataStream (&data[0], data.size()));
+    }
+}
+
+/// Makes NIF files written by the test available through the Ogre resource system
+struct NifFileTest : public ::testing::Test
+{
+    Ogre::LogManager *mLogManager;
+    Ogre::ArchiveManager *mArchiveManager;
+    Ogre::FileSystemArchiveFactory *mFileSystemFactory;
+    Ogre::ResourceGroupManager *mResourceGroupManager;
+    std::vector<std::string> mFiles;
+
+  protected:
+    /// Write a file with NifTest::writeNif; it is removed again after the test.
+    void writeNif (const std::string& name, int count)
+    {
+        NifTest::writeNif (name, count);
+        mFiles.push_back (name);
+    }
+
+    virtual void SetUp()
+    {
+        mLogManager = new Ogre::LogManager;
+        mLogManager->createLog ("", true, false, true);
+        mArchiveManager = new Ogre::ArchiveManager;
+        mFileSystemFactory = new Ogre::FileSystemArchiveFactory;
+        mArchiveManager->addArchiveFactory (mFileSystemFactory);
+        mResourceGroupManager = new Ogre::ResourceGroupManager;
+        mResourceGroupManager->addResourceLocation (".", "FileSystem");
+    }
+
+    virtual void TearDown()
+    {
+        delete mResourceGroupManager;
+        delete mArchiveManager;
+        delete mFileSystemFactory;
+        delete mLogManager;
+
+        for (std::vector<std::string>::const_iterator iter (mFiles.begin()); iter!=mFiles.end(); ++iter)
+            std::remove (iter->c_str());
+    }
+};
+
+/// Writes a NIF file with 2000 records and parses it every time it is requested
+struct NifParseTest : public NifFileTest
+{
+    std::string mFile;
+
+  protected:
+    virtual void SetUp()
+    {
+        NifFileTest::SetUp();
+
+        mFile = "parsetest.nif";
+        writeNif (mFile, 2000);
+
+        Nif::NIFFile::setCacheBudget (0);
+    }
+
+    virtual void TearDown()
+    {
+        Nif::NIFFile::setCacheBudget (32 * 1024 * 1024);
+
+        NifFileTest::TearDown();
+    }
+};
+
+#endif
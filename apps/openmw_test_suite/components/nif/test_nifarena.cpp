@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "components/nif/niffile.hpp"
+#include "components/nif/extra.hpp"
+
+#include "niftest.hpp"
+
+TEST(NifArenaTest, allocations_are_aligned_and_distinct)
+{
+    Nif::Arena arena (1024);
+
+    char *first = static_cast<char *> (arena.allocate (3));
+    char *second = static_cast<char *> (arena.allocate (40));
+    char *large = static_cast<char *> (arena.allocate (4096));
+    char *third = static_cast<char *> (arena.allocate (8));
+
+    EXPECT_EQ(0u, reinterpret_cast<size_t> (first) % Nif::Arena::sAlignment);
+    EXPECT_EQ(0u, reinterpret_cast<size_t> (second) % Nif::Arena::sAlignment);
+    EXPECT_EQ(0u, reinterpret_cast<size_t> (third) % Nif::Arena::sAlignment);
+    EXPECT_EQ(first + Nif::Arena::sAlignment, second);
+    EXPECT_EQ(second + 48, third); // the large allocation does not use up the current block
+    EXPECT_NE(large, third);
+    EXPECT_EQ(2u, arena.getBlockCount());
+}
+
+TEST_F(NifParseTest, records_are_linked)
+{
+    Nif::NIFFile::ptr nif = Nif::NIFFile::create (mFile);
+
+    ASSERT_EQ(2000u, nif->numRecords());
+    EXPECT_EQ(std::string ("NiStringExtraData"), nif->getRecord (0)->recName);
+    EXPECT_EQ(std::string ("NiFloatData"), nif->getRecord (1)->recName);
+
+    const Nif::NiStringExtraData *extra =
+        dynamic_cast<const Nif::NiStringExtraData *> (nif->getRoot());
+    ASSERT_TRUE(extra!=0);
+    EXPECT_EQ("MRK", extra->string);
+    EXPECT_EQ(nif->getRecord (2), extra->extra.getPtr());
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "components/nif/niffile.hpp"
+
+#include "niftest.hpp"
+
+namespace
+{
+    /// Keeps the meshes of a cell in use while the cell is loaded
+    class Cell
+    {
+            std::vector<std::string> mMeshes;
+            std::vector<Nif::NIFFile::ptr> mLoaded;
+
+        public:
+
+            Cell (const std::string& mesh1, const std::string& mesh2, const std::string& mesh3)
+            {
+                mMeshes.push_back (mesh1);
+                mMeshes.push_back (mesh2);
+                mMeshes.push_back (mesh3);
+            }
+
+            void load()
+            {
+                for (std::vector<std::string>::const_iterator iter (mMeshes.begin());
+                    iter!=mMeshes.end(); ++iter)
+                    mLoaded.push_back (Nif::NIFFile::create (*iter));
+            }
+
+            void unload()
+            {
+                mLoaded.clear();
+            }
+    };
+}
+
+struct NifFileCacheTest : public NifFileTest
+{
+  protected:
+    virtual void SetUp()
+    {
+        NifFileTest::SetUp();
+
+        writeNif ("cachetest_a.nif", 1);
+        writeNif ("cachetest_b.nif", 1);
+        writeNif ("cachetest_shared1.nif", 1);
+        writeNif ("cachetest_shared2.nif", 1);
+
+        Nif::NIFFile::setCacheBudget (32 * 1024 * 1024);
+        Nif::NIFFile::clearCache();
+    }
+
+    virtual void TearDown()
+    {
+        Nif::NIFFile::clearCache();
+        Nif::NIFFile::setCacheBudget (32 * 1024 * 1024);
+
+        NifFileTest::TearDown();
+    }
+};
+
+TEST_F(NifFileCacheTest, walking_between_cells_does_not_reparse_meshes)
+{
+    Cell cellA ("cachetest_shared1.nif", "cachetest_shared2.nif", "cachetest_a.nif");
+    Cell cellB ("cachetest_shared1.nif", "CacheTest_Shared2.nif", "cachetest_b.nif");
+
+    Nif::NIFFile::CacheStats before = Nif::NIFFile::getCacheStats();
+
+    for (int i=0; i<3; ++i)
+    {
+        cellA.load();
+        cellB.unload();
+        cellB.load();
+        cellA.unload();
+    }
+
+    Nif::NIFFile::CacheStats after = Nif::NIFFile::getCacheStats();
+
+    EXPECT_EQ(4u, after.mMisses - before.mMisses);
+    EXPECT_EQ(3u * 6u - 4u, after.mHits - before.mHits);
+    EXPECT_EQ(0u, after.mEvictions - before.mEvictions);
+}
+
+TEST_F(NifFileCacheTest, files_beyond_budget_are_evicted)
+{
+    Nif::NIFFile::ptr file = Nif::NIFFile::create ("cachetest_a.nif");
+    size_t size = Nif::NIFFile::getCacheStats().mSize;
+    ASSERT_GT(size, 0u);
+    file.reset();
+
+    // room for two files
+    Nif::NIFFile::setCacheBudget (2*size);
+
+    Nif::NIFFile::CacheStats before = Nif::NIFFile::getCacheStats();
+
+    Nif::NIFFile::create ("cachetest_a.nif");
+    Nif::NIFFile::create ("cachetest_b.nif");
+    Nif::NIFFile::create ("cachetest_shared1.nif"); // evicts cachetest_a.nif
+    Nif::NIFFile::create ("cachetest_b.nif");
+    Nif::NIFFile::create ("cachetest_a.nif"); // parsed again, evicts cachetest_shared1.nif
+
+    Nif::NIFFile::CacheStats after = Nif::NIFFile::getCacheStats();
+
+    EXPECT_EQ(3u, after.mMisses - before.mMisses);
+    EXPECT_EQ(2u, after.mHits - before.mHits);
+    EXPECT_EQ(2u, after.mEvictions - before.mEvictions);
+    EXPECT_EQ(2*size, after.mSize);
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "components/nif/niffile.hpp"
+
+#include "niftest.hpp"
+
+TEST(NifStreamTest, arrays_and_key_lists_match_written_values)
+{
+    std::string data = NifTest::makeFile (1);
+    Nif::NIFStream nif (0, NifTest::openMemory (data));
+
+    NifTest::Shape shape;
+    shape.read (nif);
+
+    ASSERT_EQ(static_cast<size_t> (NifTest::sVertices), shape.mVertices.size());
+    ASSERT_EQ(static_cast<size_t> (NifTest::sVertices*3), shape.mTriangles.size());
+    ASSERT_EQ(static_cast<size_t> (NifTest::sKeys), shape.mRotations.mKeys.size());
+
+    int index = 0;
+    for (int i=0; i<NifTest::sVertices; ++i)
+        for (int j=0; j<3; ++j)
+            EXPECT_EQ(NifTest::makeFloat (index++), shape.mVertices[i][j]);
+    for (int i=0; i<NifTest::sVertices; ++i)
+        for (int j=0; j<3; ++j)
+            EXPECT_EQ(NifTest::makeFloat (index++), shape.mNormals[i][j]);
+    for (int i=0; i<NifTest::sVertices; ++i)
+        for (int j=0; j<2; ++j)
+            EXPECT_EQ(NifTest::makeFloat (index++), shape.mUVs[i][j]);
+
+    for (int i=0; i<NifTest::sVertices*3; ++i)
+        EXPECT_EQ(static_cast<short> (i*7 - 1000), shape.mTriangles[i]);
+
+    for (int i=0; i<NifTest::sKeys; ++i)
+    {
+        const Nif::QuaternionKey& key = shape.mRotations.mKeys[i];
+        EXPECT_EQ(NifTest::makeFloat (index++), key.mTime);
+        EXPECT_EQ(NifTest::makeFloat (index++), key.mValue.w);
+        EXPECT_EQ(NifTest::makeFloat (index++), key.mValue.x);
+        EXPECT_EQ(NifTest::makeFloat (index++), key.mValue.y);
+        EXPECT_EQ(NifTest::makeFloat (index++), key.mValue.z);
+    }
+
+    for (int i=0; i<NifTest::sKeys; ++i)
+    {
+        const Nif::Vector3Key& key = shape.mTranslations.mKeys[i];
+        EXPECT_EQ(NifTest::makeFloat (index++), key.mTime);
+        EXPECT_EQ(NifTest::makeFloat (index++), key.mValue.x);
+        EXPECT_EQ(NifTest::makeFloat (index++), key.mValue.y);
+        EXPECT_EQ(NifTest::makeFloat (index++), key.mValue.z);
+        EXPECT_EQ(NifTest::makeFloat (index++), key.mTension);
+        EXPECT_EQ(NifTest::makeFloat (index++), key.mBias);
+        EXPECT_EQ(NifTest::makeFloat (index++), key.mContinuity);
+    }
+
+    for (int i=0; i<NifTest::sKeys; ++i)
+    {
+        const Nif::FloatKey& key = shape.mScales.mKeys[i];
+        EXPECT_EQ(NifTest::makeFloat (index++), key.mTime);
+        EXPECT_EQ(NifTest::makeFloat (index++), key.mValue);
+        EXPECT_EQ(NifTest::makeFloat (index++), key.mForwardValue);
+        EXPECT_EQ(NifTest::makeFloat (index++), key.mBackwardValue);
+    }
+
+    // reading past the end yields 0, as before
+    EXPECT_EQ(0, nif.getInt());
+    EXPECT_EQ(0.0f, nif.getFloat());
+}
+
+TEST(NifStreamTest, truncated_arrays_keep_values_read_completely)
+{
+    NifTest::NifWriter writer;
+    for (int i=0; i<5; ++i)
+        writer.writeFloat (NifTest::makeFloat (i));
+    writer.writeShort (7); // half of the sixth float
+
+    std::string data = writer.getData();
+    Nif::NIFStream nif (0, NifTest::openMemory (data));
+
+    std::vector<Ogre::Vector3> vertices;
+    nif.getVector3s (vertices, 3);
+
+    ASSERT_EQ(static_cast<size_t> (3), vertices.size());
+    for (int i=0; i<5; ++i)
+        EXPECT_EQ(NifTest::makeFloat (i), vertices[i/3][i%3]);
+    EXPECT_EQ(0.0f, vertices[1][2]);
+    EXPECT_EQ(Ogre::Vector3::ZERO, vertices[2]);
+
+    // the rest of the input is skipped
+    EXPECT_EQ(0, nif.getInt());
+
+    NifTest::NifWriter shortWriter;
+    shortWriter.writeShort (3);
+    shortWriter.writeShort (static_cast<uint16_t> (-4));
+    data = shortWriter.getData() + '\x01';
+    Nif::NIFStream shortNif (0, NifTest::openMemory (data));
+
+    std::vector<short> triangles;
+    shortNif.getShorts (triangles, 4);
+
+    ASSERT_EQ(static_cast<size_t> (4), triangles.size());
+    EXPECT_EQ(3, triangles[0]);
+    EXPECT_EQ(-4, triangles[1]);
+    EXPECT_EQ(0, triangles[2]);
+    EXPECT_EQ(0, triangles[3]);
+}
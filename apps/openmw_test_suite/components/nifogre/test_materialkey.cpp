@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <boost/tr1/tr1/unordered_map>
+#elif defined HAVE_UNORDERED_MAP
+#include <unordered_map>
+#else
+#include <tr1/unordered_map>
+#endif
+
+#include "components/nifogre/materialkey.hpp"
+
+namespace
+{
+    NifOgre::MaterialKey makeKey()
+    {
+        NifOgre::MaterialKey key;
+
+        for (int i=0; i<3; ++i)
+        {
+            key.mAmbient[i] = 1.0f;
+            key.mDiffuse[i] = 1.0f;
+            key.mSpecular[i] = 0.0f;
+            key.mEmissive[i] = 0.0f;
+        }
+
+        key.mGlossiness = 0.0f;
+        key.mAlpha = 1.0f;
+        key.mAlphaFlags = 0;
+        key.mAlphaTest = 0;
+        key.mVertMode = 2;
+        key.mDepthFlags = 3;
+        key.mSpecFlags = 0;
+        key.mWireFlags = 0;
+        key.mVertexColour = false;
+
+        key.mTextures[0] = NifOgre::internTextureName ("textures\\tx_wood.dds");
+        for (int i=1; i<7; ++i)
+            key.mTextures[i] = 0;
+
+        return key;
+    }
+
+    /// Hash that maps every key to the same bucket.
+    struct CollidingHash
+    {
+        std::size_t operator() (const NifOgre::MaterialKey& key) const
+        {
+            return 0;
+        }
+    };
+}
+
+TEST(MaterialKeyTest, intern_returns_same_pointer_for_equal_names)
+{
+    std::string name ("textures\\tx_stone.dds");
+
+    const std::string *first = NifOgre::internTextureName (name);
+    const std::string *second = NifOgre::internTextureName (std::string (name));
+
+    ASSERT_TRUE (first!=0);
+    EXPECT_EQ (first, second);
+    EXPECT_EQ (name, *first);
+    EXPECT_NE (first, NifOgre::internTextureName ("textures\\tx_stone2.dds"));
+    EXPECT_EQ (0, NifOgre::internTextureName (""));
+}
+
+TEST(MaterialKeyTest, equal_keys_have_equal_hashes)
+{
+    NifOgre::MaterialKey left = makeKey();
+    NifOgre::MaterialKey right = makeKey();
+
+    EXPECT_TRUE (left==right);
+    EXPECT_EQ (left.hash(), right.hash());
+
+    left.mAlpha = right.mAlpha = 0.5f;
+    left.mTextures[3] = NifOgre::internTextureName ("textures\\tx_glow.dds");
+    right.mTextures[3] = NifOgre::internTextureName ("textures\\tx_glow.dds");
+
+    EXPECT_TRUE (left==right);
+    EXPECT_EQ (left.hash(), right.hash());
+}
+
+TEST(MaterialKeyTest, every_member_takes_part_in_comparison)
+{
+    const NifOgre::MaterialKey base = makeKey();
+    std::vector<NifOgre::MaterialKey> keys;
+
+    for (int i=0; i<3; ++i)
+    {
+        NifOgre::MaterialKey key = base;
+        key.mAmbient[i] = 0.5f;
+        keys.push_back (key);
+        key = base;
+        key.mDiffuse[i] = 0.5f;
+        keys.push_back (key);
+        key = base;
+        key.mSpecular[i] = 0.5f;
+        keys.push_back (key);
+        key = base;
+        key.mEmissive[i] = 0.5f;
+        keys.push_back (key);
+    }
+
+    NifOgre::MaterialKey key = base;
+    key.mGlossiness = 10; keys.push_back (key); key = base;
+    key.mAlpha = 0.5f; keys.push_back (key); key = base;
+    key.mAlphaFlags = 237; keys.push_back (key); key = base;
+    key.mAlphaTest = 128; keys.push_back (key); key = base;
+    key.mVertMode = 0; keys.push_back (key); key = base;
+    key.mDepthFlags = 1; keys.push_back (key); key = base;
+    key.mSpecFlags = 1; keys.push_back (key); key = base;
+    key.mWireFlags = 1; keys.push_back (key); key = base;
+    key.mVertexColour = true; keys.push_back (key); key = base;
+    key.mTextures[0] = 0; keys.push_back (key); key = base;
+    key.mTextures[6] = NifOgre::internTextureName ("textures\\tx_decal.dds"); keys.push_back (key);
+
+    for (std::size_t i=0; i<keys.size(); ++i)
+    {
+        EXPECT_FALSE (keys[i]==base) << "key " << i;
+
+        for (std::size_t j=i+1; j<keys.size(); ++j)
+            EXPECT_FALSE (keys[i]==keys[j]) << "keys " << i << " and " << j;
+    }
+}
+
+TEST(MaterialKeyTest, float_comparison_is_exact)
+{
+    NifOgre::MaterialKey left = makeKey();
+    NifOgre::MaterialKey right = makeKey();
+
+    right.mDiffuse[1] = 1.0f + 1.0f/(1<<23); // next float after 1
+    EXPECT_FALSE (left==right);
+
+    // NaNs are equal to themselves, so keys containing them can still be found again
+    left.mGlossiness = right.mGlossiness = std::numeric_limits<float>::quiet_NaN();
+    right.mDiffuse[1] = left.mDiffuse[1];
+    EXPECT_TRUE (left==right);
+    EXPECT_EQ (left.hash(), right.hash());
+}
+
+// The map used by NIFMaterialLoader used to be keyed on the hash alone, so two different materials
+// with the same hash were merged. With full keys, a colliding hash only costs a comparison.
+TEST(MaterialKeyTest, colliding_hashes_do_not_merge_materials)
+{
+#if defined HAVE_UNORDERED_MAP
+    std::unordered_map<NifOgre::MaterialKey, std::string, CollidingHash> materials;
+#else
+    std::tr1::unordered_map<NifOgre::MaterialKey, std::string, CollidingHash> materials;
+#endif
+
+    std::map<std::string, NifOgre::MaterialKey> keys;
+
+    for (int i=0; i<100; ++i)
+    {
+        NifOgre::MaterialKey key = makeKey();
+        key.mAlphaTest = i;
+        std::ostringstream name;
+        name << "material" << i;
+        keys[name.str()] = key;
+        EXPECT_TRUE (materials.insert (std::make_pair (key, name.str())).second);
+    }
+
+    ASSERT_EQ (100u, materials.size());
+
+    for (std::map<std::string, NifOgre::MaterialKey>::const_iterator iter (keys.begin());
+        iter!=keys.end(); ++iter)
+    {
+        EXPECT_EQ (iter->first, materials.find (iter->second)->second);
+    }
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "components/settings/settings.hpp"
+
+struct SettingsTest : public ::testing::Test
+{
+  protected:
+    virtual void SetUp()
+    {
+        Settings::Manager::apply();
+    }
+
+    virtual void TearDown()
+    {
+        Settings::Manager::mNewSettings.erase (std::make_pair ("Test", "int value"));
+        Settings::Manager::mNewSettings.erase (std::make_pair ("Test", "float value"));
+        Settings::Manager::mNewSettings.erase (std::make_pair ("Test", "bool value"));
+        Settings::Manager::apply();
+    }
+};
+
+TEST_F(SettingsTest, handles_observe_changes_after_apply)
+{
+    Settings::Manager::setInt ("int value", "Test", 1);
+    Settings::Manager::setFloat ("float value", "Test", 0.5f);
+    Settings::Manager::setBool ("bool value", "Test", false);
+    Settings::Manager::apply();
+
+    const Settings::IntSetting intSetting ("int value", "Test");
+    const Settings::FloatSetting floatSetting ("float value", "Test");
+    const Settings::BoolSetting boolSetting ("bool value", "Test");
+
+    EXPECT_EQ(1, intSetting.get());
+    EXPECT_EQ(0.5f, floatSetting.get());
+    EXPECT_FALSE(boolSetting.get());
+
+    Settings::Manager::setInt ("int value", "Test", 2);
+    Settings::Manager::setFloat ("float value", "Test", 1.5f);
+    Settings::Manager::setBool ("bool value", "Test", true);
+
+    // the cached values are kept until the changes are applied
+    EXPECT_EQ(1, intSetting.get());
+
+    Settings::CategorySettingVector changed = Settings::Manager::apply();
+
+    EXPECT_EQ(3u, changed.size());
+    EXPECT_EQ(2, intSetting.get());
+    EXPECT_EQ(1.5f, floatSetting.get());
+    EXPECT_TRUE(boolSetting.get());
+    EXPECT_EQ(Settings::Manager::getInt ("int value", "Test"), intSetting.get());
+}
+
+TEST_F(SettingsTest, apply_without_changes_keeps_cached_values)
+{
+    Settings::Manager::setInt ("int value", "Test", 3);
+    Settings::Manager::apply();
+
+    const Settings::IntSetting intSetting ("int value", "Test");
+    EXPECT_EQ(3, intSetting.get());
+
+    int generation = Settings::Manager::mGeneration;
+    Settings::Manager::setInt ("int value", "Test", 3);
+    EXPECT_TRUE(Settings::Manager::apply().empty());
+    EXPECT_EQ(generation, Settings::Manager::mGeneration);
+    EXPECT_EQ(3, intSetting.get());
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+#include "apps/openmw/mwdialogue/topic.hpp"
+
+namespace
+{
+    /// Entry for the topic of a default constructed Topic; does not need the content files.
+    MWDialogue::JournalEntry makeEntry (const std::string& infoId)
+    {
+        MWDialogue::JournalEntry entry;
+        entry.mInfoId = infoId;
+        entry.mText = "text of " + infoId;
+        return entry;
+    }
+
+    std::string makeInfoId (int index)
+    {
+        char buffer[32];
+        std::sprintf (buffer, "%d%d", 1000000+index, index % 97);
+        return buffer;
+    }
+}
+
+// Not a correctness test; reports how long it takes to add entries to a large topic, including
+// the redundancy check that is done for every entry.
+TEST(TopicTest, large_topic_benchmark)
+{
+    const int entries = 20000;
+
+    MWDialogue::Topic topic;
+
+    std::clock_t start = std::clock();
+    for (int i=0; i<entries; ++i)
+        topic.addEntry (makeEntry (makeInfoId (i)));
+    std::clock_t add = std::clock() - start;
+
+    start = std::clock();
+    for (int i=0; i<entries; ++i)
+        topic.addEntry (makeEntry (makeInfoId (i)));
+    std::clock_t redundant = std::clock() - start;
+
+    std::cout
+        << "  adding " << entries << " entries: " << 1000.0 * add / CLOCKS_PER_SEC << " ms\n"
+        << "  adding them again: " << 1000.0 * redundant / CLOCKS_PER_SEC << " ms"
+        << std::endl;
+
+    EXPECT_EQ (entries, std::distance (topic.begin(), topic.end()));
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <string>
+
+#include <components/esm/journalentry.hpp>
+
+#include "apps/openmw/mwdialogue/topic.hpp"
+#include "apps/openmw/mwdialogue/mainjournal.hpp"
+
+namespace
+{
+    /// Entry for the topic of a default constructed Topic; does not need the content files.
+    MWDialogue::JournalEntry makeEntry (const std::string& infoId)
+    {
+        MWDialogue::JournalEntry entry;
+        entry.mInfoId = infoId;
+        entry.mText = "text of " + infoId;
+        return entry;
+    }
+
+    /// Main journal entry for \a quest; does not need the content files.
+    MWDialogue::StampedJournalEntry makeQuestEntry (const std::string& quest,
+        const std::string& infoId)
+    {
+        MWDialogue::StampedJournalEntry entry;
+        entry.mTopic = quest;
+        entry.mInfoId = infoId;
+        entry.mText = "text of " + infoId;
+        return entry;
+    }
+
+    ESM::JournalEntry makeQuestRecord (const std::string& quest, const std::string& infoId)
+    {
+        ESM::JournalEntry record;
+        record.mType = ESM::JournalEntry::Type_Journal;
+        record.mTopic = quest;
+        record.mInfo = infoId;
+        record.mText = "loaded " + infoId;
+        record.mDay = record.mMonth = record.mDayOfMonth = 0;
+        return record;
+    }
+}
+
+TEST(TopicTest, redundant_entries_are_ignored)
+{
+    MWDialogue::Topic topic;
+
+    topic.addEntry (makeEntry ("1234"));
+    topic.addEntry (makeEntry ("5678"));
+    topic.addEntry (makeEntry ("1234"));
+
+    ASSERT_EQ (2, std::distance (topic.begin(), topic.end()));
+    EXPECT_EQ ("1234", topic.begin()->mInfoId);
+    EXPECT_EQ ("5678", (topic.begin()+1)->mInfoId);
+    EXPECT_TRUE (topic.hasEntry ("1234"));
+    EXPECT_TRUE (topic.hasEntry ("5678"));
+    EXPECT_FALSE (topic.hasEntry ("9012"));
+}
+
+TEST(TopicTest, entries_from_saved_game_are_known)
+{
+    MWDialogue::Topic topic;
+
+    ESM::JournalEntry record;
+    record.mType = ESM::JournalEntry::Type_Topic;
+    record.mInfo = "1234";
+    record.mText = "loaded";
+    topic.insertEntry (record);
+
+    EXPECT_TRUE (topic.hasEntry ("1234"));
+
+    topic.addEntry (makeEntry ("1234"));
+
+    ASSERT_EQ (1, std::distance (topic.begin(), topic.end()));
+    EXPECT_EQ ("loaded", topic.begin()->mText);
+}
+
+TEST(MainJournalTest, redundant_quest_entries_are_ignored)
+{
+    MWDialogue::MainJournal journal;
+
+    EXPECT_TRUE (journal.addEntry (makeQuestEntry ("a_quest", "1234")));
+    EXPECT_TRUE (journal.addEntry (makeQuestEntry ("b_quest", "1234")));
+    EXPECT_FALSE (journal.addEntry (makeQuestEntry ("a_quest", "1234")));
+    EXPECT_TRUE (journal.addEntry (makeQuestEntry ("a_quest", "5678")));
+
+    ASSERT_EQ (3, std::distance (journal.begin(), journal.end()));
+    EXPECT_EQ (2u, journal.getQuestEntries ("a_quest").size());
+    EXPECT_EQ (1u, journal.getQuestEntries ("b_quest").size());
+}
+
+TEST(MainJournalTest, quest_entries_are_in_journal_order)
+{
+    MWDialogue::MainJournal journal;
+
+    journal.addEntry (makeQuestEntry ("a_quest", "1"));
+    journal.addEntry (makeQuestEntry ("b_quest", "2"));
+    journal.addEntry (makeQuestEntry ("a_quest", "3"));
+    journal.addEntry (makeQuestEntry ("b_quest", "4"));
+    journal.addEntry (makeQuestEntry ("a_quest", "5"));
+
+    // as used by the journal window: positions relative to begin()
+    const MWDialogue::MainJournal::TEntryIndexContainer& entries =
+        journal.getQuestEntries ("a_quest");
+
+    ASSERT_EQ (3u, entries.size());
+    EXPECT_EQ ("1", (journal.begin()+entries[0])->mInfoId);
+    EXPECT_EQ ("3", (journal.begin()+entries[1])->mInfoId);
+    EXPECT_EQ ("5", (journal.begin()+entries[2])->mInfoId);
+
+    EXPECT_TRUE (journal.getQuestEntries ("c_quest").empty());
+}
+
+TEST(MainJournalTest, index_is_rebuilt_from_saved_game)
+{
+    MWDialogue::MainJournal journal;
+
+    journal.insertEntry (makeQuestRecord ("a_quest", "1"));
+    journal.insertEntry (makeQuestRecord ("b_quest", "2"));
+    journal.insertEntry (makeQuestRecord ("a_quest", "3"));
+
+    const MWDialogue::MainJournal::TEntryIndexContainer& entries =
+        journal.getQuestEntries ("a_quest");
+
+    ASSERT_EQ (2u, entries.size());
+    EXPECT_EQ ("loaded 1", (journal.begin()+entries[0])->mText);
+    EXPECT_EQ ("loaded 3", (journal.begin()+entries[1])->mText);
+
+    // loaded entries are known to the redundancy check
+    EXPECT_FALSE (journal.addEntry (makeQuestEntry ("a_quest", "3")));
+    EXPECT_TRUE (journal.addEntry (makeQuestEntry ("b_quest", "3")));
+    EXPECT_EQ (4, std::distance (journal.begin(), journal.end()));
+}
+
+TEST(MainJournalTest, clear_resets_index)
+{
+    MWDialogue::MainJournal journal;
+
+    journal.addEntry (makeQuestEntry ("a_quest", "1"));
+    journal.addEntry (makeQuestEntry ("a_quest", "2"));
+
+    journal.clear();
+
+    EXPECT_EQ (journal.begin(), journal.end());
+    EXPECT_TRUE (journal.getQuestEntries ("a_quest").empty());
+
+    EXPECT_TRUE (journal.addEntry (makeQuestEntry ("a_quest", "2")));
+    ASSERT_EQ (1u, journal.getQuestEntries ("a_quest").size());
+    EXPECT_EQ (0u, journal.getQuestEntries ("a_quest")[0]);
+}
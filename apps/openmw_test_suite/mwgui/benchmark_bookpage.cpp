@@ -0,0 +1,34 @@
+#include <gtest/gtest.h>
+
+#include <ctime>
+#include <iostream>
+
+#include "bookpagetest.hpp"
+
+// Not a correctness test; reports how long it takes to lay out a large journal from scratch
+// compared to appending a few entries to an existing layout (as the journal window does).
+TEST_F(BookTypesetterTest, large_journal_benchmark)
+{
+    const int entries = 5000;
+    const int newEntries = 10;
+
+    BookPageTest::JournalWriter writer;
+
+    std::clock_t start = std::clock();
+    writer.write (0, entries);
+    MWGui::TypesetBook::Ptr book = writer.mTypesetter->complete();
+    std::clock_t full = std::clock() - start;
+
+    start = std::clock();
+    writer.write (entries, entries+newEntries);
+    writer.mTypesetter->complete();
+    std::clock_t append = std::clock() - start;
+
+    std::cout
+        << "  " << entries << " entries, " << book->pageCount() << " pages\n"
+        << "  full layout: " << 1000.0 * full / CLOCKS_PER_SEC << " ms\n"
+        << "  appending " << newEntries << " entries: " << 1000.0 * append / CLOCKS_PER_SEC << " ms"
+        << std::endl;
+
+    EXPECT_GT (book->pageCount(), static_cast<size_t> (entries / 10));
+}
@@ -0,0 +1,127 @@
+#ifndef OPENMW_TEST_SUITE_MWGUI_BOOKPAGETEST_H
+#define OPENMW_TEST_SUITE_MWGUI_BOOKPAGETEST_H
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+
+#include <MyGUI_LogManager.h>
+#include <MyGUI_FactoryManager.h>
+#include <MyGUI_ResourceManager.h>
+#include <MyGUI_FontManager.h>
+#include <MyGUI_IFont.h>
+
+#include "apps/openmw/mwgui/bookpage.hpp"
+
+namespace BookPageTest
+{
+    /// Monospaced font without a texture; sufficient for laying out text.
+    class FakeFont : public MyGUI::IFont
+    {
+            MyGUI::GlyphInfo mGlyph;
+
+        public:
+
+            FakeFont (const std::string& name)
+            {
+                mResourceName = name;
+                mGlyph.width = 7;
+                mGlyph.height = 16;
+                mGlyph.advance = 7;
+                mGlyph.bearingX = 1;
+            }
+
+            virtual MyGUI::GlyphInfo* getGlyphInfo (MyGUI::Char id) { return &mGlyph; }
+
+            virtual MyGUI::ITexture* getTextureFont() { return 0; }
+
+            virtual int getDefaultHeight() { return 16; }
+    };
+
+    inline MWGui::BookTypesetter::Utf8Span toUtf8Span (const std::string& text)
+    {
+        MWGui::BookTypesetter::Utf8Point begin =
+            reinterpret_cast<MWGui::BookTypesetter::Utf8Point> (text.c_str());
+
+        return MWGui::BookTypesetter::Utf8Span (begin, begin + text.size());
+    }
+
+    /// Synthetic journal entry of a few sentences, similar in length to the ones in the game.
+    inline std::string makeEntry (int index)
+    {
+        char buffer[32];
+        std::sprintf (buffer, "%d", index);
+
+        std::string text = "Entry ";
+        text += buffer;
+        text += ". I have been asked to deliver a letter to the Caldera Mining Company. ";
+        text += "Odral Helvi wants me to keep this quiet, and he says the Imperial Legion ";
+        text += "must not hear about it before the matter has been settled.";
+
+        return text;
+    }
+
+    struct JournalWriter
+    {
+        MWGui::BookTypesetter::Ptr mTypesetter;
+        MWGui::BookTypesetter::Style *mHeader;
+        MWGui::BookTypesetter::Style *mBody;
+
+        JournalWriter()
+        : mTypesetter (MWGui::BookTypesetter::create (240, 300))
+        {
+            mHeader = mTypesetter->createStyle ("", MyGUI::Colour (0.60f, 0.00f, 0.00f));
+            mBody = mTypesetter->createStyle ("", MyGUI::Colour::Black);
+        }
+
+        void write (int begin, int end)
+        {
+            for (int i=begin; i<end; ++i)
+            {
+                mTypesetter->write (mHeader, toUtf8Span ("16 Last Seed (Day 3)"));
+                mTypesetter->lineBreak();
+                mTypesetter->write (mBody, toUtf8Span (makeEntry (i)));
+                mTypesetter->sectionBreak (10);
+            }
+        }
+    };
+}
+
+/// Sets up the MyGUI managers needed for typesetting, with FakeFont as the default font
+struct BookTypesetterTest : public ::testing::Test
+{
+    MyGUI::LogManager *mLogManager;
+    MyGUI::FactoryManager *mFactoryManager;
+    MyGUI::ResourceManager *mResourceManager;
+    MyGUI::FontManager *mFontManager;
+
+  protected:
+    virtual void SetUp()
+    {
+        mLogManager = new MyGUI::LogManager;
+        mFactoryManager = new MyGUI::FactoryManager;
+        mFactoryManager->initialise();
+        mResourceManager = new MyGUI::ResourceManager;
+        mResourceManager->initialise();
+        mFontManager = new MyGUI::FontManager;
+        mFontManager->initialise();
+
+        // owned by the resource manager
+        mResourceManager->addResource (new BookPageTest::FakeFont ("FakeFont"));
+        mFontManager->setDefaultFont ("FakeFont");
+    }
+
+    virtual void TearDown()
+    {
+        mFontManager->shutdown();
+        delete mFontManager;
+        mResourceManager->shutdown();
+        delete mResourceManager;
+        mFactoryManager->shutdown();
+        delete mFactoryManager;
+        delete mLogManager;
+    }
+};
+
+#endif
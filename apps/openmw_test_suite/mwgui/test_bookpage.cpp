@@ -0,0 +1,21 @@
+#include <gtest/gtest.h>
+
+#include "bookpagetest.hpp"
+
+TEST_F(BookTypesetterTest, appending_after_complete_matches_single_pass)
+{
+    BookPageTest::JournalWriter whole;
+    whole.write (0, 200);
+    MWGui::TypesetBook::Ptr wholeBook = whole.mTypesetter->complete();
+
+    BookPageTest::JournalWriter appended;
+    appended.write (0, 150);
+    MWGui::TypesetBook::Ptr appendedBook = appended.mTypesetter->complete();
+    size_t pages = appendedBook->pageCount();
+    appended.write (150, 200);
+
+    ASSERT_EQ (appendedBook, appended.mTypesetter->complete());
+    EXPECT_LT (pages, appendedBook->pageCount());
+    EXPECT_EQ (wholeBook->pageCount(), appendedBook->pageCount());
+    EXPECT_EQ (wholeBook->getSize(), appendedBook->getSize());
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <ctime>
+#include <iostream>
+#include <vector>
+
+#include <components/esm/records.hpp>
+
+#include "apps/openmw/mwworld/ptr.hpp"
+
+namespace
+{
+    /// References in the mix of a busy town cell, repeated \a copies times
+    class Cell
+    {
+            std::vector<MWWorld::LiveCellRefBase *> mRefs;
+
+            template<typename T>
+            void add (int count)
+            {
+                for (int i=0; i<count; ++i)
+                {
+                    mRefs.push_back (new MWWorld::LiveCellRef<T>);
+                    mPtrs.push_back (MWWorld::Ptr (mRefs.back()));
+                }
+            }
+
+            Cell (const Cell&);
+            Cell& operator= (const Cell&);
+
+        public:
+
+            std::vector<MWWorld::Ptr> mPtrs;
+
+            Cell (int copies)
+            {
+                for (int i=0; i<copies; ++i)
+                {
+                    add<ESM::Static> (300);
+                    add<ESM::Door> (20);
+                    add<ESM::Container> (30);
+                    add<ESM::Light> (25);
+                    add<ESM::NPC> (15);
+                    add<ESM::Creature> (5);
+                    add<ESM::Activator> (10);
+                    add<ESM::Miscellaneous> (40);
+                    add<ESM::Weapon> (10);
+                    add<ESM::Armor> (10);
+                    add<ESM::Clothing> (10);
+                    add<ESM::Potion> (10);
+                    add<ESM::Book> (10);
+                }
+            }
+
+            ~Cell()
+            {
+                for (std::vector<MWWorld::LiveCellRefBase *>::iterator iter (mRefs.begin());
+                    iter!=mRefs.end(); ++iter)
+                    delete *iter;
+            }
+    };
+
+    template<typename T>
+    int count (const std::vector<MWWorld::Ptr>& ptrs)
+    {
+        int count = 0;
+
+        for (std::vector<MWWorld::Ptr>::const_iterator iter (ptrs.begin()); iter!=ptrs.end(); ++iter)
+            if (iter->is<T>())
+                ++count;
+
+        return count;
+    }
+
+    template<typename T>
+    int countCast (const std::vector<MWWorld::Ptr>& ptrs)
+    {
+        int count = 0;
+
+        for (std::vector<MWWorld::Ptr>::const_iterator iter (ptrs.begin()); iter!=ptrs.end(); ++iter)
+            if (iter->is<T>() && iter->get<T>()->mBase==0)
+                ++count;
+
+        return count;
+    }
+}
+
+// Not a correctness test; times the type checks done per actor and per item in the engine's update
+// loops (Ptr::is and Ptr::get) over the references of a populated cell.
+TEST(PtrTypeBenchmark, is_and_get)
+{
+    const int copies = 100;
+    const int rounds = 20;
+
+    Cell cell (copies);
+
+    int checked = 0;
+    std::clock_t start = std::clock();
+    for (int i=0; i<rounds; ++i)
+        checked += count<ESM::NPC> (cell.mPtrs) + count<ESM::Weapon> (cell.mPtrs);
+    std::clock_t isTime = std::clock() - start;
+
+    int cast = 0;
+    start = std::clock();
+    for (int i=0; i<rounds; ++i)
+        cast += countCast<ESM::NPC> (cell.mPtrs) + countCast<ESM::Weapon> (cell.mPtrs);
+    std::clock_t getTime = std::clock() - start;
+
+    std::cout
+        << "  " << rounds << " x 2 checks over " << cell.mPtrs.size() << " references\n"
+        << "  is: " << 1000.0 * isTime / CLOCKS_PER_SEC << " ms\n"
+        << "  is and get: " << 1000.0 * getTime / CLOCKS_PER_SEC << " ms"
+        << std::endl;
+
+    EXPECT_EQ (rounds * copies * 25, checked);
+    EXPECT_EQ (checked, cast);
+}
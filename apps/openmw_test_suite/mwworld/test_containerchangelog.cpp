@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <components/esm/loadmisc.hpp>
+
+#include "apps/openmw/mwworld/containerchangelog.hpp"
+
+namespace
+{
+    /// Stacks of a container; the log only compares their Ptrs.
+    struct Stacks
+    {
+        MWWorld::LiveCellRef<ESM::Miscellaneous> mRefs[3];
+
+        MWWorld::Ptr get (int index)
+        {
+            return MWWorld::Ptr (&mRefs[index]);
+        }
+    };
+
+    /// Bring a new consumer up to date with \a log, like an item view does on its first update.
+    MWWorld::ContainerChangeLog::Serial catchUp (const MWWorld::ContainerChangeLog& log)
+    {
+        MWWorld::ContainerChangeLog::Serial since = 0;
+        std::vector<MWWorld::Ptr> changed;
+        log.getChanges (since, changed);
+        return since;
+    }
+}
+
+TEST(ContainerChangeLogTest, new_consumer_rebuilds)
+{
+    MWWorld::ContainerChangeLog log;
+    Stacks stacks;
+    log.add (stacks.get (0));
+
+    MWWorld::ContainerChangeLog::Serial since = 0;
+    std::vector<MWWorld::Ptr> changed;
+
+    EXPECT_FALSE (log.getChanges (since, changed));
+    EXPECT_TRUE (changed.empty());
+
+    // up to date now
+    EXPECT_TRUE (log.getChanges (since, changed));
+    EXPECT_TRUE (changed.empty());
+}
+
+TEST(ContainerChangeLogTest, consumer_gets_changes_since_last_call)
+{
+    MWWorld::ContainerChangeLog log;
+    Stacks stacks;
+    MWWorld::ContainerChangeLog::Serial since = catchUp (log);
+
+    log.add (stacks.get (0));
+    log.add (stacks.get (1));
+
+    std::vector<MWWorld::Ptr> changed;
+    ASSERT_TRUE (log.getChanges (since, changed));
+    ASSERT_EQ (2u, changed.size());
+    EXPECT_EQ (stacks.get (0), changed[0]);
+    EXPECT_EQ (stacks.get (1), changed[1]);
+
+    log.add (stacks.get (2));
+    log.add (stacks.get (0));
+
+    changed.clear();
+    ASSERT_TRUE (log.getChanges (since, changed));
+    ASSERT_EQ (2u, changed.size());
+    EXPECT_EQ (stacks.get (2), changed[0]);
+    EXPECT_EQ (stacks.get (0), changed[1]);
+}
+
+TEST(ContainerChangeLogTest, changes_of_other_logs_are_not_reported)
+{
+    MWWorld::ContainerChangeLog log;
+    MWWorld::ContainerChangeLog other;
+    Stacks stacks;
+    MWWorld::ContainerChangeLog::Serial since = catchUp (log);
+
+    other.add (stacks.get (0));
+    log.add (stacks.get (1));
+    other.add (stacks.get (2));
+
+    std::vector<MWWorld::Ptr> changed;
+    ASSERT_TRUE (log.getChanges (since, changed));
+    ASSERT_EQ (1u, changed.size());
+    EXPECT_EQ (stacks.get (1), changed[0]);
+}
+
+TEST(ContainerChangeLogTest, consumer_that_fell_behind_rebuilds)
+{
+    MWWorld::ContainerChangeLog log;
+    Stacks stacks;
+    MWWorld::ContainerChangeLog::Serial behind = catchUp (log);
+
+    for (int i=0; i<100; ++i)
+        log.add (stacks.get (i%3));
+
+    MWWorld::ContainerChangeLog::Serial recent = catchUp (log);
+    log.add (stacks.get (0));
+
+    std::vector<MWWorld::Ptr> changed;
+    EXPECT_FALSE (log.getChanges (behind, changed));
+    EXPECT_TRUE (changed.empty());
+
+    EXPECT_TRUE (log.getChanges (recent, changed));
+    ASSERT_EQ (1u, changed.size());
+}
+
+TEST(ContainerChangeLogTest, reset_makes_consumers_rebuild)
+{
+    MWWorld::ContainerChangeLog log;
+    Stacks stacks;
+    MWWorld::ContainerChangeLog::Serial since = catchUp (log);
+
+    log.add (stacks.get (0));
+    log.reset();
+
+    std::vector<MWWorld::Ptr> changed;
+    EXPECT_FALSE (log.getChanges (since, changed));
+    EXPECT_TRUE (changed.empty());
+
+    log.add (stacks.get (1));
+
+    ASSERT_TRUE (log.getChanges (since, changed));
+    ASSERT_EQ (1u, changed.size());
+    EXPECT_EQ (stacks.get (1), changed[0]);
+}
+
+TEST(ContainerChangeLogTest, copy_is_a_new_empty_log)
+{
+    MWWorld::ContainerChangeLog log;
+    Stacks stacks;
+    MWWorld::ContainerChangeLog::Serial since = catchUp (log);
+
+    log.add (stacks.get (0));
+
+    MWWorld::ContainerChangeLog copy (log);
+    MWWorld::ContainerChangeLog assigned;
+    MWWorld::ContainerChangeLog::Serial assignedSince = catchUp (assigned);
+    assigned = log;
+
+    // consumers of the original or of the previous content must rebuild
+    std::vector<MWWorld::Ptr> changed;
+    MWWorld::ContainerChangeLog::Serial copySince = since;
+    EXPECT_FALSE (copy.getChanges (copySince, changed));
+    EXPECT_FALSE (assigned.getChanges (assignedSince, changed));
+    EXPECT_TRUE (changed.empty());
+
+    // the original is not affected
+    ASSERT_TRUE (log.getChanges (since, changed));
+    ASSERT_EQ (1u, changed.size());
+    EXPECT_EQ (stacks.get (0), changed[0]);
+}
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include <components/esm/records.hpp>
+
+#include "apps/openmw/mwworld/ptr.hpp"
+
+// The class of a reference is not involved in type checks; the test suite creates references
+// without one (see livecellrefstub.cpp).
+TEST(PtrTypeTest, get_type_returns_record_id)
+{
+    MWWorld::LiveCellRef<ESM::NPC> npc;
+    MWWorld::LiveCellRef<ESM::Weapon> weapon;
+
+    EXPECT_EQ (static_cast<unsigned int> (ESM::REC_NPC_), MWWorld::Ptr (&npc).getType());
+    EXPECT_EQ (static_cast<unsigned int> (ESM::REC_WEAP), MWWorld::Ptr (&weapon).getType());
+}
+
+TEST(PtrTypeTest, is_matches_only_own_type)
+{
+    MWWorld::LiveCellRef<ESM::NPC> npc;
+    MWWorld::Ptr ptr (&npc);
+
+    EXPECT_TRUE (ptr.is<ESM::NPC>());
+    EXPECT_FALSE (ptr.is<ESM::Weapon>());
+    EXPECT_FALSE (ptr.is<ESM::Creature>());
+}
+
+TEST(PtrTypeTest, get_returns_ref_for_matching_type)
+{
+    ESM::NPC base;
+    MWWorld::LiveCellRef<ESM::NPC> npc (&base);
+    MWWorld::Ptr ptr (&npc);
+
+    MWWorld::LiveCellRef<ESM::NPC> *ref = ptr.get<ESM::NPC>();
+
+    EXPECT_EQ (&npc, ref);
+    EXPECT_EQ (&base, ref->mBase);
+}
+
+TEST(PtrTypeTest, get_throws_for_mismatched_type)
+{
+    MWWorld::LiveCellRef<ESM::NPC> npc;
+    MWWorld::Ptr ptr (&npc);
+
+    EXPECT_THROW (ptr.get<ESM::Weapon>(), std::runtime_error);
+    EXPECT_THROW (ptr.get<ESM::Creature>(), std::runtime_error);
+}
+
+TEST(PtrTypeTest, empty_ptr_throws)
+{
+    MWWorld::Ptr ptr;
+
+    EXPECT_THROW (ptr.getType(), std::runtime_error);
+    EXPECT_THROW (ptr.is<ESM::NPC>(), std::runtime_error);
+    EXPECT_THROW (ptr.get<ESM::NPC>(), std::runtime_error);
+}
@@ -0,0 +1,337 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "apps/openmw/mwworld/weathertable.hpp"
+#include "apps/openmw/mwworld/fallback.hpp"
+
+namespace
+{
+    const char *sNames[] =
+    {
+        "Clear", "Cloudy", "Foggy", "Overcast", "Rain", "Thunderstorm", "Ashstorm", "Blight",
+        "Snow", "Blizzard"
+    };
+
+    const char *sTimes[] = { "Sunrise", "Day", "Sunset", "Night" };
+
+    const char *sColours[] = { "Sky", "Fog", "Ambient", "Sun" };
+
+    /// Morrowind.ini-like fallback values, with distinct colours for every weather and time of day
+    std::map<std::string, std::string> makeFallbackMap()
+    {
+        std::map<std::string, std::string> values;
+
+        values["Weather_Sunrise_Time"] = "6";
+        values["Weather_Sunset_Time"] = "18";
+        values["Weather_Sunrise_Duration"] = "2";
+        values["Weather_Sunset_Duration"] = "2";
+        values["Weather_Hours_Between_Weather_Changes"] = "20";
+        values["Weather_Thunderstorm_Thunder_Frequency"] = ".4";
+        values["Weather_Thunderstorm_Thunder_Threshold"] = "0.6";
+        values["Weather_Thunderstorm_Thunder_Sound_ID_0"] = "Thunder0";
+        values["Weather_Thunderstorm_Thunder_Sound_ID_1"] = "Thunder1";
+        values["Weather_Thunderstorm_Thunder_Sound_ID_2"] = "Thunder2";
+        values["Weather_Thunderstorm_Thunder_Sound_ID_3"] = "Thunder3";
+
+        for (int i=0; i<10; ++i)
+        {
+            std::string prefix = std::string ("Weather_") + sNames[i] + "_";
+
+            for (int j=0; j<4; ++j)
+                for (int k=0; k<4; ++k)
+                {
+                    std::ostringstream colour;
+                    colour << (i*20+j*3+k) % 256 << "," << (i*7+j*40+k*11) % 256 << ","
+                        << (255-i*13-j*5-k*30) % 256;
+                    values[prefix + sColours[k] + "_" + sTimes[j] + "_Color"] = colour.str();
+                }
+
+            std::ostringstream number;
+            number << 100 + i*10;
+            values[prefix + "Land_Fog_Day_Depth"] = "1." + number.str().substr (1);
+            values[prefix + "Land_Fog_Night_Depth"] = "0." + number.str().substr (1);
+            values[prefix + "Sun_Disc_Sunset_Color"] = "128," + number.str() + ",64";
+            values[prefix + "Transition_Delta"] = "0.0" + number.str().substr (1);
+            values[prefix + "Wind_Speed"] = "0." + number.str().substr (1);
+            values[prefix + "Cloud_Speed"] = number.str().substr (1, 1);
+            values[prefix + "Clouds_Maximum_Percent"] = "0.9";
+            values[prefix + "Glare_View"] = i%2 ? "1" : "0";
+        }
+
+        values["Moons_Masser_Fade_In_Start"] = "14";
+        values["Moons_Masser_Fade_In_Finish"] = "15";
+        values["Moons_Masser_Fade_Out_Start"] = "7";
+        values["Moons_Masser_Fade_Out_Finish"] = "10";
+        values["Moons_Masser_Fade_Start_Angle"] = "50";
+        values["Moons_Masser_Fade_End_Angle"] = "40";
+        values["Moons_Secunda_Fade_In_Start"] = "14";
+        values["Moons_Secunda_Fade_In_Finish"] = "15";
+        values["Moons_Secunda_Fade_Out_Start"] = "7";
+        values["Moons_Secunda_Fade_Out_Finish"] = "10";
+        values["Moons_Secunda_Fade_Start_Angle"] = "50";
+        values["Moons_Secunda_Fade_End_Angle"] = "30";
+
+        return values;
+    }
+
+    Ogre::ColourValue lerp (const Ogre::ColourValue& x, const Ogre::ColourValue& y, float factor)
+    {
+        return x * (1-factor) + y * factor;
+    }
+
+    float lerp (float x, float y, float factor)
+    {
+        return x * (1-factor) + y * factor;
+    }
+
+    /// The blending WeatherManager did before the weather table, looking up every value in the
+    /// fallback map on demand.
+    class ReferenceWeather
+    {
+            const MWWorld::Fallback& mFallback;
+
+            Ogre::ColourValue colour (const std::string& prefix, const std::string& name) const
+            {
+                return mFallback.getFallbackColour (prefix + name);
+            }
+
+        public:
+
+            ReferenceWeather (const MWWorld::Fallback& fallback) : mFallback (fallback) {}
+
+            void setResult (MWWorld::WeatherResult& result, int id, float hour) const
+            {
+                std::string prefix = std::string ("Weather_") + sNames[id] + "_";
+
+                float sunriseTime = mFallback.getFallbackFloat ("Weather_Sunrise_Time");
+                float sunsetTime = mFallback.getFallbackFloat ("Weather_Sunset_Time");
+                float sunriseDuration = mFallback.getFallbackFloat ("Weather_Sunrise_Duration");
+                float sunsetDuration = mFallback.getFallbackFloat ("Weather_Sunset_Duration");
+                float nightStart = sunsetTime + sunsetDuration;
+                float nightEnd = sunriseTime - 0.5;
+                float dayStart = sunriseTime + sunriseDuration;
+                float dayEnd = sunsetTime;
+
+                result.mCloudOpacity = mFallback.getFallbackFloat (prefix + "Clouds_Maximum_Percent");
+                result.mWindSpeed = mFallback.getFallbackFloat (prefix + "Wind_Speed");
+                result.mCloudSpeed = mFallback.getFallbackFloat (prefix + "Cloud_Speed");
+                result.mGlareView = mFallback.getFallbackFloat (prefix + "Glare_View");
+                result.mSunColor = colour (prefix, "Sun_Disc_Sunset_Color");
+
+                result.mNight = (hour < sunriseTime || hour > nightStart - 1);
+
+                result.mFogDepth = mFallback.getFallbackFloat (prefix +
+                    (result.mNight ? "Land_Fog_Night_Depth" : "Land_Fog_Day_Depth"));
+
+                if (hour <= nightEnd || hour >= nightStart + 1)
+                {
+                    result.mFogColor = colour (prefix, "Fog_Night_Color");
+                    result.mAmbientColor = colour (prefix, "Ambient_Night_Color");
+                    result.mSunColor = colour (prefix, "Sun_Night_Color");
+                    result.mSkyColor = colour (prefix, "Sky_Night_Color");
+                    result.mNightFade = 1.f;
+                }
+                else if (hour >= nightEnd && hour <= dayStart + 1)
+                {
+                    if (hour <= sunriseTime)
+                    {
+                        float factor = (sunriseTime - hour) / 0.5f;
+                        result.mFogColor = lerp (colour (prefix, "Fog_Sunrise_Color"), colour (prefix, "Fog_Night_Color"), factor);
+                        result.mAmbientColor = lerp (colour (prefix, "Ambient_Sunrise_Color"), colour (prefix, "Ambient_Night_Color"), factor);
+                        result.mSunColor = lerp (colour (prefix, "Sun_Sunrise_Color"), colour (prefix, "Sun_Night_Color"), factor);
+                        result.mSkyColor = lerp (colour (prefix, "Sky_Sunrise_Color"), colour (prefix, "Sky_Night_Color"), factor);
+                        result.mNightFade = factor;
+                    }
+                    else
+                    {
+                        float factor = (hour - sunriseTime) / 3.f;
+                        result.mFogColor = lerp (colour (prefix, "Fog_Sunrise_Color"), colour (prefix, "Fog_Day_Color"), factor);
+                        result.mAmbientColor = lerp (colour (prefix, "Ambient_Sunrise_Color"), colour (prefix, "Ambient_Day_Color"), factor);
+                        result.mSunColor = lerp (colour (prefix, "Sun_Sunrise_Color"), colour (prefix, "Sun_Day_Color"), factor);
+                        result.mSkyColor = lerp (colour (prefix, "Sky_Sunrise_Color"), colour (prefix, "Sky_Day_Color"), factor);
+                    }
+                }
+                else if (hour >= dayStart + 1 && hour <= dayEnd - 1)
+                {
+                    result.mFogColor = colour (prefix, "Fog_Day_Color");
+                    result.mAmbientColor = colour (prefix, "Ambient_Day_Color");
+                    result.mSunColor = colour (prefix, "Sun_Day_Color");
+                    result.mSkyColor = colour (prefix, "Sky_Day_Color");
+                }
+                else if (hour >= dayEnd - 1 && hour <= nightStart + 1)
+                {
+                    if (hour <= dayEnd + 1)
+                    {
+                        float factor = ((dayEnd + 1) - hour) / 2;
+                        result.mFogColor = lerp (colour (prefix, "Fog_Sunset_Color"), colour (prefix, "Fog_Day_Color"), factor);
+                        result.mAmbientColor = lerp (colour (prefix, "Ambient_Sunset_Color"), colour (prefix, "Ambient_Day_Color"), factor);
+                        result.mSunColor = lerp (colour (prefix, "Sun_Sunset_Color"), colour (prefix, "Sun_Day_Color"), factor);
+                        result.mSkyColor = lerp (colour (prefix, "Sky_Sunset_Color"), colour (prefix, "Sky_Day_Color"), factor);
+                    }
+                    else
+                    {
+                        float factor = (hour - (dayEnd + 1)) / 2.f;
+                        result.mFogColor = lerp (colour (prefix, "Fog_Sunset_Color"), colour (prefix, "Fog_Night_Color"), factor);
+                        result.mAmbientColor = lerp (colour (prefix, "Ambient_Sunset_Color"), colour (prefix, "Ambient_Night_Color"), factor);
+                        result.mSunColor = lerp (colour (prefix, "Sun_Sunset_Color"), colour (prefix, "Sun_Night_Color"), factor);
+                        result.mSkyColor = lerp (colour (prefix, "Sky_Sunset_Color"), colour (prefix, "Sky_Night_Color"), factor);
+                        result.mNightFade = factor;
+                    }
+                }
+            }
+
+            void transition (MWWorld::WeatherResult& result, int id, int nextId, float factor,
+                float hour) const
+            {
+                setResult (result, id, hour);
+                const MWWorld::WeatherResult current = result;
+                setResult (result, nextId, hour);
+                const MWWorld::WeatherResult other = result;
+
+                result.mFogColor = lerp (current.mFogColor, other.mFogColor, factor);
+                result.mSunColor = lerp (current.mSunColor, other.mSunColor, factor);
+                result.mSkyColor = lerp (current.mSkyColor, other.mSkyColor, factor);
+                result.mAmbientColor = lerp (current.mAmbientColor, other.mAmbientColor, factor);
+                result.mFogDepth = lerp (current.mFogDepth, other.mFogDepth, factor);
+                result.mWindSpeed = lerp (current.mWindSpeed, other.mWindSpeed, factor);
+                result.mCloudSpeed = lerp (current.mCloudSpeed, other.mCloudSpeed, factor);
+                result.mCloudOpacity = lerp (current.mCloudOpacity, other.mCloudOpacity, factor);
+                result.mGlareView = lerp (current.mGlareView, other.mGlareView, factor);
+                result.mNightFade = lerp (current.mNightFade, other.mNightFade, factor);
+                result.mNight = current.mNight;
+            }
+    };
+
+    void expectEqual (const Ogre::ColourValue& expected, const Ogre::ColourValue& actual,
+        const std::string& what)
+    {
+        EXPECT_FLOAT_EQ (expected.r, actual.r) << what;
+        EXPECT_FLOAT_EQ (expected.g, actual.g) << what;
+        EXPECT_FLOAT_EQ (expected.b, actual.b) << what;
+    }
+
+    void expectEqual (const MWWorld::WeatherResult& expected, const MWWorld::WeatherResult& actual,
+        const std::string& what)
+    {
+        expectEqual (expected.mFogColor, actual.mFogColor, what + " fog colour");
+        expectEqual (expected.mAmbientColor, actual.mAmbientColor, what + " ambient colour");
+        expectEqual (expected.mSkyColor, actual.mSkyColor, what + " sky colour");
+        expectEqual (expected.mSunColor, actual.mSunColor, what + " sun colour");
+        EXPECT_FLOAT_EQ (expected.mFogDepth, actual.mFogDepth) << what;
+        EXPECT_FLOAT_EQ (expected.mWindSpeed, actual.mWindSpeed) << what;
+        EXPECT_FLOAT_EQ (expected.mCloudSpeed, actual.mCloudSpeed) << what;
+        EXPECT_FLOAT_EQ (expected.mCloudOpacity, actual.mCloudOpacity) << what;
+        EXPECT_FLOAT_EQ (expected.mGlareView, actual.mGlareView) << what;
+        EXPECT_EQ (expected.mNight, actual.mNight) << what;
+        EXPECT_FLOAT_EQ (expected.mNightFade, actual.mNightFade) << what;
+    }
+
+    std::string describe (int id, int nextId, float hour)
+    {
+        std::ostringstream stream;
+        stream << sNames[id];
+        if (nextId!=-1)
+            stream << " -> " << sNames[nextId];
+        stream << " at " << hour;
+        return stream.str();
+    }
+
+    class WeatherTableTest : public ::testing::Test
+    {
+        protected:
+
+            WeatherTableTest() : mFallback (makeFallbackMap()), mTable (mFallback), mReference (mFallback) {}
+
+            MWWorld::Fallback mFallback;
+            MWWorld::WeatherTable mTable;
+            ReferenceWeather mReference;
+    };
+}
+
+TEST_F(WeatherTableTest, reads_fallback_values)
+{
+    EXPECT_FLOAT_EQ (6, mTable.mSunriseTime);
+    EXPECT_FLOAT_EQ (20, mTable.mNightStart);
+    EXPECT_FLOAT_EQ (5.5, mTable.mNightEnd);
+    EXPECT_FLOAT_EQ (8, mTable.mDayStart);
+    EXPECT_FLOAT_EQ (18, mTable.mDayEnd);
+    EXPECT_FLOAT_EQ (20, mTable.mHoursBetweenWeatherChanges);
+    EXPECT_EQ ("Thunder2", mTable.mThunderSoundID[2]);
+
+    const MWWorld::Weather& blight = mTable.getWeather (MWWorld::WeatherTable::Weather_Blight);
+    EXPECT_EQ ("tx_sky_blight.dds", blight.mCloudTexture);
+    EXPECT_EQ ("blight", blight.mAmbientLoopSoundID);
+    expectEqual (mFallback.getFallbackColour ("Weather_Blight_Fog_Sunset_Color"),
+        blight.mFogColor[MWWorld::Weather::TOD_Sunset], "blight sunset fog");
+
+    EXPECT_EQ ("rain heavy",
+        mTable.getWeather (MWWorld::WeatherTable::Weather_Thunderstorm).mRainLoopSoundID);
+
+    EXPECT_THROW (mTable.getWeather (MWWorld::WeatherTable::Weather_Count), std::runtime_error);
+    EXPECT_THROW (mTable.getWeather (-1), std::runtime_error);
+}
+
+// The result is carried over from one hour to the next like WeatherManager::mResult, since
+// some branches leave mNightFade untouched.
+TEST_F(WeatherTableTest, matches_fallback_lookups_over_a_day)
+{
+    for (int id=0; id<MWWorld::WeatherTable::Weather_Count; ++id)
+    {
+        MWWorld::WeatherResult expected;
+        MWWorld::WeatherResult actual;
+        expected.mNightFade = actual.mNightFade = 0;
+
+        for (int step=0; step<=24*16; ++step)
+        {
+            float hour = step / 16.f;
+            mReference.setResult (expected, id, hour);
+            mTable.getResult (actual, id, hour);
+            expectEqual (expected, actual, describe (id, -1, hour));
+        }
+    }
+}
+
+TEST_F(WeatherTableTest, matches_fallback_lookups_during_transitions)
+{
+    for (int id=0; id<MWWorld::WeatherTable::Weather_Count; ++id)
+    {
+        int nextId = (id+3) % MWWorld::WeatherTable::Weather_Count;
+
+        MWWorld::WeatherResult expected;
+        MWWorld::WeatherResult actual;
+        expected.mNightFade = actual.mNightFade = 0;
+
+        for (int step=0; step<=24*16; ++step)
+        {
+            float hour = step / 16.f;
+            float factor = (step % 17) / 16.f;
+            mReference.transition (expected, id, nextId, factor, hour);
+            mTable.getResult (actual, id, nextId, factor, hour);
+            expectEqual (expected, actual, describe (id, nextId, hour));
+
+            EXPECT_FLOAT_EQ (factor, actual.mCloudBlendFactor);
+            EXPECT_EQ (mTable.getWeather (id).mCloudTexture, actual.mCloudTexture);
+            EXPECT_EQ (mTable.getWeather (nextId).mCloudTexture, actual.mNextCloudTexture);
+        }
+    }
+}
+
+TEST_F(WeatherTableTest, moon_fades)
+{
+    const MWWorld::WeatherTable::Moon& masser = mTable.mMasser;
+
+    EXPECT_FLOAT_EQ (1, masser.getHourFade (3));
+    EXPECT_FLOAT_EQ (0.5, masser.getHourFade (8.5));
+    EXPECT_FLOAT_EQ (0.5, masser.getHourFade (14.5));
+    EXPECT_FLOAT_EQ (1, masser.getHourFade (20));
+
+    EXPECT_FLOAT_EQ (1, masser.getAngleFade (20));
+    EXPECT_FLOAT_EQ (0.5, masser.getAngleFade (45));
+    EXPECT_FLOAT_EQ (0, masser.getAngleFade (60));
+
+    EXPECT_FLOAT_EQ (0.75, mTable.mSecunda.getAngleFade (35));
+}
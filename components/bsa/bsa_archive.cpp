@@ -38,6 +38,14 @@ using namespace Ogre;
 
 static bool fsstrict = false;
 
+static std::ostream *accessTrace = 0;
+
+static void traceAccess(const String& filename)
+{
+    if (accessTrace)
+        *accessTrace << filename << '\n';
+}
+
 static char strict_normalize_char(char ch)
 {
     return ch == '\\' ? '/' : ch;
@@ -115,6 +123,8 @@ public:
             throw std::runtime_error (os.str ());
         }
 
+        traceAccess (filename);
+
         return openConstrainedFileDataStream (i->second.c_str ());
     }
 
@@ -224,6 +234,8 @@ public:
     // should not have been declared const in the first place.
     Bsa::BSAFile *narc = const_cast<Bsa::BSAFile*>(&arc);
 
+    traceAccess (filename);
+
     // Open the file
     return narc->getFile(filename.c_str());
   }
@@ -364,7 +376,7 @@ static void insertDirFactory()
 namespace Bsa
 {
 
-// The function below is the only publicly exposed part of this file
+// The functions below are the only publicly exposed part of this file
 
 void addBSA(const std::string& name, const std::string& group)
 {
@@ -382,4 +394,9 @@ void addDir(const std::string& name, const bool& fs, const std::string& group)
     addResourceLocation(name, "Dir", group, true);
 }
 
+void setAccessTrace(std::ostream *stream)
+{
+    accessTrace = stream;
+}
+
 }
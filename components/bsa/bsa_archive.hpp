@@ -23,6 +23,7 @@
 
 #include <string>
 #include <algorithm>
+#include <ostream>
 
 #ifndef BSA_BSA_ARCHIVE_H
 #define BSA_BSA_ARCHIVE_H
@@ -35,6 +36,13 @@ namespace Bsa
 void addBSA(const std::string& file, const std::string& group="General");
 void addDir(const std::string& file, const bool& fs, const std::string& group="General");
 
+/// Write the name of every file opened through the archives added above to \a stream (one
+/// name per line, in the order of access; 0 disables the trace). Used to create access-ordered
+/// archives with bsatool.
+///
+/// \attention The stream must stay valid until the trace is disabled again.
+void setAccessTrace(std::ostream *stream);
+
 }
 
 #endif
@@ -24,6 +24,7 @@
 #include "bsa_file.hpp"
 
 #include <stdexcept>
+#include <cctype>
 
 #include "../files/constrainedfiledatastream.hpp"
 
@@ -61,7 +62,7 @@ void BSAFile::readHeader()
      *
      * ---------- end of directory block -------------
      *
-     * - 8*filenum - hash table block, we currently ignore this
+     * - 8*filenum - hash table block, one pair of uint32 per file (see getHash)
      *
      * ----------- start of data buffer --------------
      *
@@ -121,9 +122,12 @@ void BSAFile::readHeader()
     // Check our position
     assert(input.tellg() == std::streampos(12+dirsize));
 
+    // Read the hash table
+    vector<uint32_t> hashes(2*filenum);
+    input.read(reinterpret_cast<char*>(&hashes[0]), 8*filenum);
+
     // Calculate the offset of the data buffer. All file offsets are
     // relative to this. 12 header bytes + directory + hash table
-    // (skipped)
     size_t fileDataOffset = 12 + dirsize + 8*filenum;
 
     // Set up the the FileStruct table
@@ -134,6 +138,8 @@ void BSAFile::readHeader()
         fs.fileSize = offsets[i*2];
         fs.offset = offsets[i*2+1] + fileDataOffset;
         fs.name = &stringBuf[offsets[2*filenum+i]];
+        fs.hash.low = hashes[i*2];
+        fs.hash.high = hashes[i*2+1];
 
         if(fs.offset + fs.fileSize > fsize)
             fail("Archive contains offsets outside itself");
@@ -174,3 +180,56 @@ Ogre::DataStreamPtr BSAFile::getFile(const char *file)
     const FileStruct &fs = files[i];
 	return openConstrainedFileDataStream (filename.c_str (), fs.offset, fs.fileSize);
 }
+
+BSAFile::Hash BSAFile::getHash(const std::string &name)
+{
+    std::string normalised (name);
+
+    for (std::string::iterator iter (normalised.begin()); iter!=normalised.end(); ++iter)
+    {
+        if (*iter=='/')
+            *iter = '\\';
+        else
+            *iter = tolower (static_cast<unsigned char> (*iter));
+    }
+
+    size_t length = normalised.size();
+    size_t half = length/2;
+
+    Hash hash;
+
+    // first half: characters are xored into the sum at rotating byte positions
+    uint32_t sum = 0;
+    uint32_t shift = 0;
+    size_t i = 0;
+
+    for (; i<half; ++i)
+    {
+        sum ^= static_cast<uint32_t> (static_cast<unsigned char> (normalised[i])) << (shift & 0x1f);
+        shift += 8;
+    }
+
+    hash.low = sum;
+
+    // second half: same, but the sum is rotated right after each character
+    sum = 0;
+    shift = 0;
+
+    for (; i<length; ++i)
+    {
+        uint32_t temp =
+            static_cast<uint32_t> (static_cast<unsigned char> (normalised[i])) << (shift & 0x1f);
+        sum ^= temp;
+
+        uint32_t rotate = temp & 0x1f;
+
+        if (rotate)
+            sum = (sum << (32-rotate)) | (sum >> rotate);
+
+        shift += 8;
+    }
+
+    hash.high = sum;
+
+    return hash;
+}
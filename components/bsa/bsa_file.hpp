@@ -42,6 +42,18 @@ namespace Bsa
 class BSAFile
 {
 public:
+    /// Hash of a file name, as stored in the hash table of the archive
+    struct Hash
+    {
+        uint32_t low, high;
+
+        bool operator< (const Hash& hash) const
+        { return low<hash.low || (low==hash.low && high<hash.high); }
+
+        bool operator== (const Hash& hash) const
+        { return low==hash.low && high==hash.high; }
+    };
+
     /// Represents one file entry in the archive
     struct FileStruct
     {
@@ -52,6 +64,8 @@ public:
 
         // Zero-terminated file name
         const char *name;
+
+        Hash hash;
     };
     typedef std::vector<FileStruct> FileList;
 
@@ -121,6 +135,14 @@ public:
     /// Get a list of all files
     const FileList &getList() const
     { return files; }
+
+    /// Name of the archive file
+    const std::string& getFilename() const
+    { return filename; }
+
+    /// Calculate the hash of a file name (the name is normalised to lower case and
+    /// backslashes first).
+    static Hash getHash(const std::string &name);
 };
 
 }
@@ -0,0 +1,168 @@
+#include "bsa_writer.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <stdexcept>
+
+#include <stdint.h>
+
+#include "bsa_file.hpp"
+
+namespace
+{
+    struct DirectoryEntry
+    {
+        Bsa::BSAFile::Hash mHash;
+        std::size_t mIndex; // index of the entry in add order
+
+        bool operator< (const DirectoryEntry& entry) const
+        {
+            return mHash<entry.mHash;
+        }
+    };
+
+    void writeUInt (std::ostream& stream, uint32_t value)
+    {
+        stream.write (reinterpret_cast<const char *> (&value), sizeof (value));
+    }
+}
+
+std::string Bsa::BSAWriter::normalise (const std::string& name)
+{
+    std::string normalised (name);
+
+    for (std::string::iterator iter (normalised.begin()); iter!=normalised.end(); ++iter)
+    {
+        if (*iter=='/')
+            *iter = '\\';
+        else
+            *iter = std::tolower (static_cast<unsigned char> (*iter));
+    }
+
+    return normalised;
+}
+
+bool Bsa::BSAWriter::add (const std::string& name, const std::string& source)
+{
+    Entry entry;
+    entry.mName = normalise (name);
+    entry.mSource = source;
+
+    if (entry.mName.empty())
+        throw std::runtime_error ("BSA Error: empty file name for " + source);
+
+    if (!mNames.insert (entry.mName).second)
+        return false;
+
+    mEntries.push_back (entry);
+    return true;
+}
+
+void Bsa::BSAWriter::write (const std::string& file) const
+{
+    std::size_t count = mEntries.size();
+
+    // data layout (add order)
+    std::vector<uint32_t> sizes (count);
+    std::vector<uint32_t> offsets (count);
+    uint64_t dataSize = 0;
+
+    for (std::size_t i=0; i<count; ++i)
+    {
+        std::ifstream source (mEntries[i].mSource.c_str(), std::ios_base::binary);
+
+        if (!source.seekg (0, std::ios_base::end))
+            throw std::runtime_error ("BSA Error: can not read " + mEntries[i].mSource);
+
+        uint64_t size = static_cast<uint64_t> (source.tellg());
+
+        sizes[i] = static_cast<uint32_t> (size);
+        offsets[i] = static_cast<uint32_t> (dataSize);
+        dataSize += size;
+    }
+
+    // directory (hash order)
+    std::vector<DirectoryEntry> directory (count);
+
+    for (std::size_t i=0; i<count; ++i)
+    {
+        directory[i].mHash = BSAFile::getHash (mEntries[i].mName);
+        directory[i].mIndex = i;
+    }
+
+    std::stable_sort (directory.begin(), directory.end());
+
+    uint64_t namesSize = 0;
+
+    for (std::size_t i=0; i<count; ++i)
+        namesSize += mEntries[i].mName.size()+1;
+
+    uint64_t dirSize = 12*static_cast<uint64_t> (count) + namesSize;
+
+    if (12 + dirSize + 8*static_cast<uint64_t> (count) + dataSize > 0xffffffffu)
+        throw std::runtime_error ("BSA Error: archive would exceed 4 GB: " + file);
+
+    std::ofstream stream (file.c_str(), std::ios_base::binary | std::ios_base::trunc);
+
+    if (!stream)
+        throw std::runtime_error ("BSA Error: can not open " + file + " for writing");
+
+    writeUInt (stream, 0x100);
+    writeUInt (stream, static_cast<uint32_t> (dirSize));
+    writeUInt (stream, static_cast<uint32_t> (count));
+
+    for (std::size_t i=0; i<count; ++i)
+    {
+        writeUInt (stream, sizes[directory[i].mIndex]);
+        writeUInt (stream, offsets[directory[i].mIndex]);
+    }
+
+    uint32_t nameOffset = 0;
+
+    for (std::size_t i=0; i<count; ++i)
+    {
+        writeUInt (stream, nameOffset);
+        nameOffset += mEntries[directory[i].mIndex].mName.size()+1;
+    }
+
+    for (std::size_t i=0; i<count; ++i)
+    {
+        const std::string& name = mEntries[directory[i].mIndex].mName;
+        stream.write (name.c_str(), name.size()+1);
+    }
+
+    for (std::size_t i=0; i<count; ++i)
+    {
+        writeUInt (stream, directory[i].mHash.low);
+        writeUInt (stream, directory[i].mHash.high);
+    }
+
+    std::vector<char> buffer (1<<16);
+
+    for (std::size_t i=0; i<count; ++i)
+    {
+        std::ifstream source (mEntries[i].mSource.c_str(), std::ios_base::binary);
+
+        uint32_t left = sizes[i];
+
+        while (left>0)
+        {
+            std::size_t chunk = std::min<std::size_t> (left, buffer.size());
+
+            if (!source.read (&buffer[0], chunk))
+                throw std::runtime_error ("BSA Error: can not read " + mEntries[i].mSource);
+
+            stream.write (&buffer[0], chunk);
+            left -= chunk;
+        }
+    }
+
+    if (!stream)
+        throw std::runtime_error ("BSA Error: failed to write " + file);
+}
+
+std::size_t Bsa::BSAWriter::size() const
+{
+    return mEntries.size();
+}
@@ -0,0 +1,47 @@
+#ifndef BSA_BSA_WRITER_H
+#define BSA_BSA_WRITER_H
+
+#include <string>
+#include <vector>
+#include <set>
+
+namespace Bsa
+{
+    /// \brief Writes TES3 ("Morrowind") BSA archives
+    ///
+    /// The directory of the archive is sorted by file name hash (as required by Morrowind). The
+    /// file data is stored in the order the files have been added, which allows placing files
+    /// that are used together next to each other.
+    class BSAWriter
+    {
+            struct Entry
+            {
+                std::string mName; // normalised
+                std::string mSource;
+            };
+
+            std::vector<Entry> mEntries;
+            std::set<std::string> mNames;
+
+            static std::string normalise (const std::string& name);
+
+        public:
+
+            /// Add a file to the archive.
+            ///
+            /// \param name Name of the file in the archive (slashes and upper case characters
+            /// are allowed)
+            /// \param source Path of the file on disk that provides the data
+            /// \return Has the file been added (false if an entry with the same name exists)?
+            bool add (const std::string& name, const std::string& source);
+
+            /// Write the archive.
+            ///
+            /// \note The source files are read only at this point.
+            void write (const std::string& file) const;
+
+            std::size_t size() const;
+    };
+}
+
+#endif
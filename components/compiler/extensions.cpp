@@ -13,12 +13,12 @@ namespace Compiler
 
     int Extensions::searchKeyword (const std::string& keyword) const
     {
-        std::map<std::string, int>::const_iterator iter = mKeywords.find (keyword);
+        int code = 0;
 
-        if (iter==mKeywords.end())
+        if (!mKeywordTable.search (keyword, code))
             return 0;
 
-        return iter->second;
+        return code;
     }
 
     bool Extensions::isFunction (int keyword, char& returnType, std::string& argumentType,
@@ -72,7 +72,8 @@ namespace Compiler
 
         int keywordIndex = mNextKeywordIndex--;
 
-        mKeywords.insert (std::make_pair (keyword, keywordIndex));
+        if (mKeywords.insert (std::make_pair (keyword, keywordIndex)).second)
+            mKeywordTable.insert (keyword, keywordIndex);
 
         function.mReturn = returnType;
         function.mArguments = argumentType;
@@ -102,7 +103,8 @@ namespace Compiler
 
         int keywordIndex = mNextKeywordIndex--;
 
-        mKeywords.insert (std::make_pair (keyword, keywordIndex));
+        if (mKeywords.insert (std::make_pair (keyword, keywordIndex)).second)
+            mKeywordTable.insert (keyword, keywordIndex);
 
         instruction.mArguments = argumentType;
         instruction.mCode = code;
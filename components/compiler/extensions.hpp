@@ -7,6 +7,8 @@
 
 #include <components/interpreter/types.hpp>
 
+#include "keywordtable.hpp"
+
 namespace Compiler
 {
     class Literals;
@@ -33,7 +35,8 @@ namespace Compiler
             };
 
             int mNextKeywordIndex;
-            std::map<std::string, int> mKeywords;
+            std::map<std::string, int> mKeywords; // only used for listing keywords
+            KeywordTable mKeywordTable;
             std::map<int, Function> mFunctions;
             std::map<int, Instruction> mInstructions;
 
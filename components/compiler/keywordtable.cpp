@@ -0,0 +1,86 @@
+#include "keywordtable.hpp"
+
+#include <cstring>
+
+namespace Compiler
+{
+    std::size_t KeywordTable::hash (const char *keyword, std::size_t length)
+    {
+        // FNV-1a
+        unsigned int value = 2166136261u;
+
+        for (std::size_t i=0; i<length; ++i)
+        {
+            value ^= static_cast<unsigned char> (keyword[i]);
+            value *= 16777619u;
+        }
+
+        return value;
+    }
+
+    void KeywordTable::rehash (std::size_t buckets)
+    {
+        std::vector<Entry> entries (buckets);
+        entries.swap (mEntries);
+        mSize = 0;
+
+        for (std::vector<Entry>::const_iterator iter (entries.begin()); iter!=entries.end(); ++iter)
+            if (!iter->mKeyword.empty())
+                insert (iter->mKeyword, iter->mCode);
+    }
+
+    KeywordTable::KeywordTable() : mEntries (16), mSize (0) {}
+
+    KeywordTable::KeywordTable (const char * const *keywords) : mEntries (16), mSize (0)
+    {
+        for (int i=0; keywords[i]; ++i)
+            insert (keywords[i], i);
+    }
+
+    void KeywordTable::insert (const std::string& keyword, int code)
+    {
+        if (keyword.empty())
+            return;
+
+        // keep the load factor at or below 1/2, so probe sequences stay short
+        if (2*(mSize+1)>mEntries.size())
+            rehash (2*mEntries.size());
+
+        std::size_t mask = mEntries.size()-1;
+        std::size_t index = hash (keyword.c_str(), keyword.size()) & mask;
+
+        while (!mEntries[index].mKeyword.empty() && mEntries[index].mKeyword!=keyword)
+            index = (index+1) & mask;
+
+        if (mEntries[index].mKeyword.empty())
+        {
+            mEntries[index].mKeyword = keyword;
+            ++mSize;
+        }
+
+        mEntries[index].mCode = code;
+    }
+
+    bool KeywordTable::search (const std::string& keyword, int& code) const
+    {
+        std::size_t mask = mEntries.size()-1;
+        std::size_t index = hash (keyword.c_str(), keyword.size()) & mask;
+
+        for (;;)
+        {
+            const Entry& entry = mEntries[index];
+
+            if (entry.mKeyword.empty())
+                return false;
+
+            if (entry.mKeyword.size()==keyword.size() &&
+                std::memcmp (entry.mKeyword.c_str(), keyword.c_str(), keyword.size())==0)
+            {
+                code = entry.mCode;
+                return true;
+            }
+
+            index = (index+1) & mask;
+        }
+    }
+}
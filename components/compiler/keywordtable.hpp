@@ -0,0 +1,46 @@
+#ifndef COMPILER_KEYWORDTABLE_H_INCLUDED
+#define COMPILER_KEYWORDTABLE_H_INCLUDED
+
+#include <string>
+#include <vector>
+
+namespace Compiler
+{
+    /// \brief Hash table mapping keywords to codes
+    ///
+    /// Open addressing over a flat array. Lookups do not allocate and usually touch a single
+    /// slot.
+    class KeywordTable
+    {
+            struct Entry
+            {
+                std::string mKeyword; // empty: unused slot
+                int mCode;
+
+                Entry() : mCode (0) {}
+            };
+
+            std::vector<Entry> mEntries;
+            std::size_t mSize;
+
+            static std::size_t hash (const char *keyword, std::size_t length);
+
+            void rehash (std::size_t buckets);
+
+        public:
+
+            KeywordTable();
+
+            KeywordTable (const char * const *keywords);
+            ///< Insert a 0-terminated array of keywords, each coded by its index.
+
+            void insert (const std::string& keyword, int code);
+            ///< Add or replace \a keyword.
+
+            bool search (const std::string& keyword, int& code) const;
+            ///< Look up \a keyword and store its code in \a code.
+            /// \return Has \a keyword been found?
+    };
+}
+
+#endif
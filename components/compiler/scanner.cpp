@@ -3,14 +3,19 @@
 
 #include <cassert>
 #include <cctype>
-#include <sstream>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <istream>
 #include <algorithm>
 #include <iterator>
+#include <locale>
 
 #include "exception.hpp"
 #include "errorhandler.hpp"
 #include "parser.hpp"
 #include "extensions.hpp"
+#include "keywordtable.hpp"
 
 #include <components/misc/stringops.hpp>
 
@@ -18,10 +23,15 @@ namespace Compiler
 {
     bool Scanner::get (char& c)
     {
-        mStream.get (c);
-
-        if (!mStream.good())
+        if (mPos>=mSize)
+        {
+            // behave like a stream that failed: a following putback does not move us back into
+            // the source
+            mPos = mSize+1;
             return false;
+        }
+
+        c = mSource[mPos++];
 
         mPrevLoc =mLoc;
 
@@ -42,10 +52,18 @@ namespace Compiler
 
     void Scanner::putback (char c)
     {
-        mStream.putback (c);
+        --mPos;
         mLoc = mPrevLoc;
     }
 
+    int Scanner::peek() const
+    {
+        if (mPos>=mSize)
+            return -1;
+
+        return static_cast<unsigned char> (mSource[mPos]);
+    }
+
     bool Scanner::scanToken (Parser& parser)
     {
         switch (mPutback)
@@ -165,8 +183,8 @@ namespace Compiler
     bool Scanner::scanInt (char c, Parser& parser, bool& cont)
     {
         assert(c != '\0');
-        std::string value;
-        value += c;
+        std::string& value = mNumber;
+        value.assign (1, c);
 
         bool error = false;
 
@@ -180,7 +198,7 @@ namespace Compiler
                 error = true;
             else if (c=='.' && !error)
             {
-                return scanFloat (value, parser, cont);
+                return scanFloat (parser, cont);
             }
             else
             {
@@ -195,24 +213,26 @@ namespace Compiler
         TokenLoc loc (mLoc);
         mLoc.mLiteral.clear();
 
-        std::istringstream stream (value);
+        errno = 0;
+        long longValue = std::strtol (value.c_str(), 0, 10);
 
-        int intValue = 0;
-        stream >> intValue;
+        int intValue = (errno==ERANGE || longValue>INT_MAX) ? INT_MAX : static_cast<int> (longValue);
 
         cont = parser.parseInt (intValue, loc, *this);
         return true;
     }
 
-    bool Scanner::scanFloat (const std::string& intValue, Parser& parser, bool& cont)
+    bool Scanner::scanFloat (Parser& parser, bool& cont)
     {
-        std::string value = intValue + ".";
+        std::string& value = mNumber;
 
-        char c;
-
-        bool empty = intValue.empty() || intValue=="-";
+        bool empty = value.empty() || value=="-";
         bool error = false;
 
+        value += '.';
+
+        char c;
+
         while (get (c))
         {
             if (std::isdigit (c))
@@ -235,10 +255,12 @@ namespace Compiler
         TokenLoc loc (mLoc);
         mLoc.mLiteral.clear();
 
-        std::istringstream stream (value);
+        // strtod would depend on the global locale, which the editor changes
+        mFloatStream.clear();
+        mFloatStream.str (value);
 
         float floatValue = 0;
-        stream >> floatValue;
+        mFloatStream >> floatValue;
 
         cont = parser.parseFloat (floatValue, loc, *this);
         return true;
@@ -263,9 +285,31 @@ namespace Compiler
         0
     };
 
+    static const KeywordTable keywordTable (keywords);
+
+    namespace
+    {
+        // Parsers may scan recursively from within a callback, so each recursion level gets its
+        // own name buffer. Buffers are kept for reuse.
+        class NameBufferGuard
+        {
+                std::size_t& mDepth;
+
+            public:
+
+                NameBufferGuard (std::size_t& depth) : mDepth (depth) { ++mDepth; }
+
+                ~NameBufferGuard() { --mDepth; }
+        };
+    }
+
     bool Scanner::scanName (char c, Parser& parser, bool& cont)
     {
-        std::string name;
+        if (mNameDepth==mNames.size())
+            mNames.push_back (std::string());
+
+        std::string& name = mNames[mNameDepth];
+        NameBufferGuard guard (mNameDepth);
 
         if (!scanName (c, name))
             return false;
@@ -275,28 +319,26 @@ namespace Compiler
 
         if (name.size()>=2 && name[0]=='"' && name[name.size()-1]=='"')
         {
-            name = name.substr (1, name.size()-2);
+            name.erase (name.size()-1);
+            name.erase (0, 1);
             cont = parser.parseName (name, loc, *this);
             return true;
         }
 
-        int i = 0;
+        mLowerCase.assign (name.begin(), name.end());
+        Misc::StringUtils::toLower (mLowerCase);
 
-        std::string lowerCase = Misc::StringUtils::lowerCase(name);
-
-        for (; keywords[i]; ++i)
-            if (lowerCase==keywords[i])
-                break;
+        int keyword = 0;
 
-        if (keywords[i])
+        if (keywordTable.search (mLowerCase, keyword))
         {
-            cont = parser.parseKeyword (i, loc, *this);
+            cont = parser.parseKeyword (keyword, loc, *this);
             return true;
         }
 
         if (mExtensions)
         {
-            if (int keyword = mExtensions->searchKeyword (lowerCase))
+            if (int keyword = mExtensions->searchKeyword (mLowerCase))
             {
                 cont = parser.parseKeyword (keyword, loc, *this);
                 return true;
@@ -347,7 +389,7 @@ namespace Compiler
                     /// \todo add an option to disable the following hack. Also, find out who is
                     /// responsible for allowing it in the first place and meet up with that person in
                     /// a dark alley.
-                    (c=='-' && !name.empty() && std::isalpha (mStream.peek()))))
+                    (c=='-' && !name.empty() && peek()!=-1 && std::isalpha (peek()))))
                 {
                     putback (c);
                     break;
@@ -382,7 +424,10 @@ namespace Compiler
                 putback (c);
 
                 if (std::isdigit (c))
-                    return scanFloat ("", parser, cont);
+                {
+                    mNumber.clear();
+                    return scanFloat (parser, cont);
+                }
             }
 
             special = S_member;
@@ -508,9 +553,21 @@ namespace Compiler
 
     Scanner::Scanner (ErrorHandler& errorHandler, std::istream& inputStream,
         const Extensions *extensions)
-    : mErrorHandler (errorHandler), mStream (inputStream), mExtensions (extensions),
+    : mErrorHandler (errorHandler), mBuffer (std::istreambuf_iterator<char> (inputStream),
+      std::istreambuf_iterator<char>()), mSource (mBuffer.c_str()), mSize (mBuffer.size()), mPos (0),
+      mNameDepth (0), mExtensions (extensions),
+      mPutback (Putback_None), mPutbackCode(0), mPutbackInteger(0), mPutbackFloat(0)
+    {
+        mFloatStream.imbue (std::locale::classic());
+    }
+
+    Scanner::Scanner (ErrorHandler& errorHandler, const char *begin, const char *end,
+        const Extensions *extensions)
+    : mErrorHandler (errorHandler), mSource (begin), mSize (end-begin), mPos (0),
+      mNameDepth (0), mExtensions (extensions),
       mPutback (Putback_None), mPutbackCode(0), mPutbackInteger(0), mPutbackFloat(0)
     {
+        mFloatStream.imbue (std::locale::classic());
     }
 
     void Scanner::scan (Parser& parser)
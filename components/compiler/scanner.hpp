@@ -3,7 +3,9 @@
 
 #include <string>
 #include <iosfwd>
+#include <sstream>
 #include <vector>
+#include <deque>
 
 #include "tokenloc.hpp"
 
@@ -16,7 +18,8 @@ namespace Compiler
     /// \brief Scanner
     ///
     /// This class translate a char-stream to a token stream (delivered via
-    /// parser-callbacks).
+    /// parser-callbacks). The source is scanned from a contiguous buffer; when constructed from a
+    /// stream, the stream is read into an internal buffer first.
 
     class Scanner
     {
@@ -29,7 +32,15 @@ namespace Compiler
             ErrorHandler& mErrorHandler;
             TokenLoc mLoc;
             TokenLoc mPrevLoc;
-            std::istream& mStream;
+            std::string mBuffer; // only used when constructed from a stream
+            const char *mSource;
+            std::size_t mSize;
+            std::size_t mPos; // mSize+1 after a read past the end
+            std::string mNumber;
+            std::istringstream mFloatStream; // uses the classic locale, reused for every float
+            std::string mLowerCase;
+            std::deque<std::string> mNames; // one per recursion level of scanName
+            std::size_t mNameDepth;
             const Extensions *mExtensions;
             putback_type mPutback;
             int mPutbackCode;
@@ -80,11 +91,15 @@ namespace Compiler
 
             void putback (char c);
 
+            int peek() const;
+            ///< Return next character without extracting it (-1 at the end of the source).
+
             bool scanToken (Parser& parser);
 
             bool scanInt (char c, Parser& parser, bool& cont);
 
-            bool scanFloat (const std::string& intValue, Parser& parser, bool& cont);
+            bool scanFloat (Parser& parser, bool& cont);
+            ///< Scan the fractional part of a float, whose integer part is stored in mNumber.
 
             bool scanName (char c, Parser& parser, bool& cont);
 
@@ -100,6 +115,11 @@ namespace Compiler
                 const Extensions *extensions = 0);
             ///< constructor
 
+            Scanner (ErrorHandler& errorHandler, const char *begin, const char *end,
+                const Extensions *extensions = 0);
+            ///< Scan the source in [\a begin, \a end) without copying it. The source must stay valid
+            /// for the lifetime of the scanner.
+
             void scan (Parser& parser);
             ///< Scan a token and deliver it to the parser.
 
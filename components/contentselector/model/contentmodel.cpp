@@ -2,12 +2,14 @@
 #include "esmfile.hpp"
 
 #include <stdexcept>
+#include <set>
+#include <vector>
 
 #include <QDir>
 #include <QTextCodec>
 #include <QDebug>
 
-#include "components/esm/esmreader.hpp"
+#include "components/esm/headerreader.hpp"
 
 ContentSelectorModel::ContentModel::ContentModel(QObject *parent) :
     QAbstractTableModel(parent),
@@ -15,7 +17,8 @@ ContentSelectorModel::ContentModel::ContentModel(QObject *parent) :
     mMimeTypes (QStringList() << mMimeType),
     mColumnCount (1),
     mDragDropFlags (Qt::ItemIsDragEnabled | Qt::ItemIsDropEnabled),
-    mDropActions (Qt::CopyAction | Qt::MoveAction)
+    mDropActions (Qt::CopyAction | Qt::MoveAction),
+    mIndexDirty (true)
 {
     setEncoding ("win1252");
     uncheckAll();
@@ -23,6 +26,9 @@ ContentSelectorModel::ContentModel::ContentModel(QObject *parent) :
 
 void ContentSelectorModel::ContentModel::setEncoding(const QString &encoding)
 {
+    // cached headers have been decoded with the old codec
+    mHeaderCache.clear();
+
     if (encoding == QLatin1String("win1252"))
         mCodec = QTextCodec::codecForName("windows-1252");
 
@@ -69,17 +75,52 @@ ContentSelectorModel::EsmFile *ContentSelectorModel::ContentModel::item(int row)
 }
 const ContentSelectorModel::EsmFile *ContentSelectorModel::ContentModel::item(const QString &name) const
 {
-    EsmFile::FileProperty fp = EsmFile::FileProperty_FileName;
-
     if (name.contains ('/'))
-        fp = EsmFile::FileProperty_FilePath;
+    {
+        updateIndex();
+        return mPathIndex.value (name, 0);
+    }
+
+    const QList<EsmFile *> *files = itemsByName (name);
+
+    return files ? files->first() : 0;
+}
+
+const QList<ContentSelectorModel::EsmFile *> *ContentSelectorModel::ContentModel::itemsByName(const QString &fileName) const
+{
+    updateIndex();
+
+    QHash<QString, QList<EsmFile *> >::const_iterator iter = mNameIndex.find (fileName);
+
+    if (iter==mNameIndex.end())
+        return 0;
+
+    return &iter.value();
+}
+
+void ContentSelectorModel::ContentModel::invalidateIndex()
+{
+    mIndexDirty = true;
+}
 
-    foreach (const EsmFile *file, mFiles)
+void ContentSelectorModel::ContentModel::updateIndex() const
+{
+    if (!mIndexDirty)
+        return;
+
+    mPathIndex.clear();
+    mNameIndex.clear();
+
+    // files earlier in the list take precedence (same as a linear search)
+    foreach (EsmFile *file, mFiles)
     {
-        if (name == file->fileProperty (fp).toString())
-            return file;
+        if (!mPathIndex.contains (file->filePath()))
+            mPathIndex.insert (file->filePath(), file);
+
+        mNameIndex[file->fileName()].append (file);
     }
-    return 0;
+
+    mIndexDirty = false;
 }
 
 QModelIndex ContentSelectorModel::ContentModel::indexFromItem(const EsmFile *item) const
@@ -114,16 +155,18 @@ Qt::ItemFlags ContentSelectorModel::ContentModel::flags(const QModelIndex &index
     //addon can be checked if its gamefile is and all other dependencies exist
     foreach (const QString &fileName, file->gameFiles())
     {
-        bool depFound = false;
-        foreach (EsmFile *dependency, mFiles)
-        {
-            //compare filenames only.  Multiple instances
-            //of the filename (with different paths) is not relevant here.
-            depFound = (dependency->fileName() == fileName);
+        //compare filenames only.  Multiple instances
+        //of the filename (with different paths) is not relevant here.
+        const QList<EsmFile *> *dependencies = itemsByName (fileName);
 
-            if (!depFound)
-                continue;
+        if (!dependencies)
+        {
+            allDependenciesFound = false;
+            continue;
+        }
 
+        foreach (EsmFile *dependency, *dependencies)
+        {
             if (!gamefileChecked)
             {
                 if (isChecked (dependency->filePath()))
@@ -137,8 +180,6 @@ Qt::ItemFlags ContentSelectorModel::ContentModel::flags(const QModelIndex &index
             if (gamefileChecked || !(dependency->isGameFile()))
                 break;
         }
-
-        allDependenciesFound = allDependenciesFound && depFound;
     }
 
     if (gamefileChecked)
@@ -254,6 +295,8 @@ bool ContentSelectorModel::ContentModel::setData(const QModelIndex &index, const
             for (int i = EsmFile::FileProperty_GameFile; i < list.size(); i++)
                 file->setFileProperty (EsmFile::FileProperty_GameFile, list.at(i));
 
+            invalidateIndex();
+
             emit dataChanged(index, index);
 
             success = true;
@@ -324,6 +367,8 @@ bool ContentSelectorModel::ContentModel::insertRows(int position, int rows, cons
         for (int row = 0; row < rows; ++row)
             mFiles.insert(position, new EsmFile);
 
+        invalidateIndex();
+
     } endInsertRows();
 
     return true;
@@ -339,6 +384,8 @@ bool ContentSelectorModel::ContentModel::removeRows(int position, int rows, cons
         for (int row = 0; row < rows; ++row)
             delete mFiles.takeAt(position);
 
+        invalidateIndex();
+
     } endRemoveRows();
 
     return true;
@@ -418,17 +465,6 @@ bool ContentSelectorModel::ContentModel::dropMimeData(const QMimeData *data, Qt:
     return true;
 }
 
-void ContentSelectorModel::ContentModel::addFile(EsmFile *file)
-{
-    beginInsertRows(QModelIndex(), mFiles.count(), mFiles.count());
-        mFiles.append(file);
-    endInsertRows();
-
-    QModelIndex idx = index (mFiles.size() - 2, 0, QModelIndex());
-
-    emit dataChanged (idx, idx);
-}
-
 void ContentSelectorModel::ContentModel::addFiles(const QString &path)
 {
     QDir dir(path);
@@ -436,46 +472,68 @@ void ContentSelectorModel::ContentModel::addFiles(const QString &path)
     filters << "*.esp" << "*.esm" << "*.omwgame" << "*.omwaddon";
     dir.setNameFilters(filters);
 
-    QTextCodec *codec = QTextCodec::codecForName("UTF8");
-
-    // Create a decoder for non-latin characters in esx metadata
-    QTextDecoder *decoder = codec->makeDecoder();
+    ESM::HeaderReader reader;
+    ContentFileList newFiles;
 
     foreach (const QString &path, dir.entryList())
     {
         QFileInfo info(dir.absoluteFilePath(path));
-        EsmFile *file = new EsmFile(path);
 
-        try {
-            ESM::ESMReader fileReader;
-            ToUTF8::Utf8Encoder encoder =
-            ToUTF8::calculateEncoding(QString(mCodec->name()).toStdString());
-            fileReader.setEncoder(&encoder);
-            fileReader.open(dir.absoluteFilePath(path).toStdString());
+        if (item(info.absoluteFilePath()))
+            continue;
+
+        QHash<QString, FileHeader>::iterator cached = mHeaderCache.find (info.absoluteFilePath());
 
-            foreach (const ESM::Header::MasterData &item, fileReader.getGameFiles())
-                file->addGameFile(QString::fromStdString(item.name));
+        if (cached==mHeaderCache.end() || cached->mSize!=info.size() ||
+            cached->mModified!=info.lastModified())
+        {
+            FileHeader header;
 
-            file->setAuthor     (decoder->toUnicode(fileReader.getAuthor().c_str()));
-            file->setDate       (info.lastModified());
-            file->setFormat     (fileReader.getFormat());
-            file->setFilePath       (info.absoluteFilePath());
-            file->setDescription(decoder->toUnicode(fileReader.getDesc().c_str()));
+            try
+            {
+                ESM::Header esmHeader;
+                reader.read (info.absoluteFilePath().toStdString(), esmHeader);
 
+                header.mSize = info.size();
+                header.mModified = info.lastModified();
+                header.mAuthor = mCodec->toUnicode (esmHeader.mData.author.toString().c_str());
+                header.mDescription = mCodec->toUnicode (esmHeader.mData.desc.toString().c_str());
+                header.mFormat = esmHeader.mFormat;
 
-            // Put the file in the table
-            if (item(file->filePath()) == 0)
-                addFile(file);
+                foreach (const ESM::Header::MasterData &master, esmHeader.mMaster)
+                    header.mGameFiles.append (mCodec->toUnicode (master.name.c_str()));
+            }
+            catch(std::runtime_error &e)
+            {
+                // An error occurred while reading the .esp
+                qWarning() << "Error reading addon file: " << e.what();
+                mHeaderCache.remove (info.absoluteFilePath());
+                continue;
+            }
 
-        } catch(std::runtime_error &e) {
-            // An error occurred while reading the .esp
-            qWarning() << "Error reading addon file: " << e.what();
-            continue;
+            cached = mHeaderCache.insert (info.absoluteFilePath(), header);
         }
 
+        EsmFile *file = new EsmFile(path);
+
+        file->setGameFiles  (cached->mGameFiles);
+        file->setAuthor     (cached->mAuthor);
+        file->setDate       (info.lastModified());
+        file->setFormat     (cached->mFormat);
+        file->setFilePath   (info.absoluteFilePath());
+        file->setDescription(cached->mDescription);
+
+        newFiles.append (file);
     }
 
-    delete decoder;
+    if (!newFiles.isEmpty())
+    {
+        // Put the files in the table
+        beginInsertRows(QModelIndex(), mFiles.count(), mFiles.count()+newFiles.count()-1);
+            mFiles.append(newFiles);
+            invalidateIndex();
+        endInsertRows();
+    }
 
     sortFiles();
 }
@@ -483,38 +541,94 @@ void ContentSelectorModel::ContentModel::addFiles(const QString &path)
 void ContentSelectorModel::ContentModel::sortFiles()
 {
     //first, sort the model such that all dependencies are ordered upstream (gamefile) first.
-    bool movedFiles = true;
-    int fileCount = mFiles.size();
+    const int fileCount = mFiles.size();
+
+    // dependents[i]: rows of the files that depend on the file in row i
+    std::vector<std::vector<int> > dependents (fileCount);
+    std::vector<int> unsortedDependencies (fileCount, 0);
+
+    QHash<const EsmFile *, int> rows;
 
-    //Dependency sort
-    //iterate until no sorting of files occurs
-    while (movedFiles)
+    for (int i = 0; i < fileCount; ++i)
+        rows.insert (mFiles.at(i), i);
+
+    for (int i = 0; i < fileCount; ++i)
     {
-        movedFiles = false;
-        //iterate each file, obtaining a reference to it's gamefiles list
-        for (int i = 0; i < fileCount; i++)
-        {
-            QModelIndex idx1 = index (i, 0, QModelIndex());
-            const QStringList &gamefiles = mFiles.at(i)->gameFiles();
-            //iterate each file after the current file, verifying that none of it's
-            //dependencies appear.
-            for (int j = i + 1; j < fileCount; j++)
-            {
-                if (gamefiles.contains(mFiles.at(j)->fileName()))
+        std::set<int> dependencies;
+
+        foreach (const QString &gameFile, mFiles.at(i)->gameFiles())
+            if (const QList<EsmFile *> *files = itemsByName (gameFile))
+                foreach (const EsmFile *file, *files)
                 {
-                        mFiles.move(j, i);
+                    int row = rows.value (file);
 
-                        QModelIndex idx2 = index (j, 0, QModelIndex());
+                    if (row != i)
+                        dependencies.insert (row);
+                }
 
-                        emit dataChanged (idx1, idx2);
+        for (std::set<int>::const_iterator iter (dependencies.begin());
+            iter != dependencies.end(); ++iter)
+            dependents[*iter].push_back (i);
 
-                        movedFiles = true;
-                }
-            }
-            if (movedFiles)
-                break;
-        }
+        unsortedDependencies[i] = static_cast<int> (dependencies.size());
     }
+
+    // Kahn's algorithm, always taking the topmost file that is ready, so that the existing
+    // order is kept where the dependencies allow it.
+    std::set<int> ready;
+
+    for (int i = 0; i < fileCount; ++i)
+        if (!unsortedDependencies[i])
+            ready.insert (i);
+
+    std::vector<int> order;
+    order.reserve (fileCount);
+
+    while (!ready.empty())
+    {
+        int row = *ready.begin();
+        ready.erase (ready.begin());
+        order.push_back (row);
+
+        for (std::vector<int>::const_iterator iter (dependents[row].begin());
+            iter != dependents[row].end(); ++iter)
+            if (--unsortedDependencies[*iter] == 0)
+                ready.insert (*iter);
+    }
+
+    // circular dependencies can't be resolved; keep the remaining files in their current order
+    if (static_cast<int> (order.size()) < fileCount)
+        for (int i = 0; i < fileCount; ++i)
+            if (unsortedDependencies[i] > 0)
+                order.push_back (i);
+
+    bool moved = false;
+
+    for (int i = 0; i < fileCount && !moved; ++i)
+        moved = order[i] != i;
+
+    if (!moved)
+        return;
+
+    emit layoutAboutToBeChanged();
+
+    ContentFileList sorted;
+    std::vector<int> newRows (fileCount);
+
+    for (int i = 0; i < fileCount; ++i)
+    {
+        sorted.append (mFiles.at (order[i]));
+        newRows[order[i]] = i;
+    }
+
+    mFiles = sorted;
+    invalidateIndex();
+
+    foreach (const QModelIndex &index, persistentIndexList())
+        changePersistentIndex (index,
+            this->index (newRows[index.row()], index.column(), index.parent()));
+
+    emit layoutChanged();
 }
 
 bool ContentSelectorModel::ContentModel::isChecked(const QString& name) const
@@ -3,6 +3,8 @@
 
 #include <QAbstractTableModel>
 #include <QStringList>
+#include <QDateTime>
+#include <QHash>
 
 namespace ContentSelectorModel
 {
@@ -55,16 +57,41 @@ namespace ContentSelectorModel
 
     private:
 
-        void addFile(EsmFile *file);
+        /// Header data of a content file, as far as the model is concerned
+        struct FileHeader
+        {
+            qint64 mSize;
+            QDateTime mModified;
+            QString mAuthor;
+            QString mDescription;
+            int mFormat;
+            QStringList mGameFiles;
+        };
+
         const EsmFile *item(int row) const;
         EsmFile *item(int row);
 
+        const QList<EsmFile *> *itemsByName(const QString &fileName) const;
+        ///< \return all files with the given file name (in row order) or 0.
+
+        void invalidateIndex();
+        ///< Must be called whenever files are added, removed, moved or renamed.
+
+        void updateIndex() const;
+
         void sortFiles();
+        ///< Stable topological sort: dependencies are moved in front of the files depending
+        /// on them, otherwise the order is kept.
 
         ContentFileList mFiles;
         QHash<QString, Qt::CheckState> mCheckStates;
         QTextCodec *mCodec;
 
+        QHash<QString, FileHeader> mHeaderCache; // key: absolute path
+        mutable QHash<QString, EsmFile *> mPathIndex;
+        mutable QHash<QString, QList<EsmFile *> > mNameIndex;
+        mutable bool mIndexDirty;
+
     public:
 
         QString mMimeType;
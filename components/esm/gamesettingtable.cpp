@@ -0,0 +1,43 @@
+#include "gamesettingtable.hpp"
+
+#include <iostream>
+
+ESM::GameSettingTable::GameSettingTable()
+{
+    blank();
+}
+
+void ESM::GameSettingTable::blank()
+{
+#define ESM_GAMESETTING_BLANK(id) id = 0;
+    ESM_GAMESETTING_FLOATS (ESM_GAMESETTING_BLANK)
+    ESM_GAMESETTING_INTS (ESM_GAMESETTING_BLANK)
+#undef ESM_GAMESETTING_BLANK
+}
+
+float ESM::GameSettingTable::getFloat (const GameSetting *setting, const char *id)
+{
+    if (!setting)
+    {
+        reportMissing (id);
+        return 0;
+    }
+
+    return setting->getFloat();
+}
+
+int ESM::GameSettingTable::getInt (const GameSetting *setting, const char *id)
+{
+    if (!setting)
+    {
+        reportMissing (id);
+        return 0;
+    }
+
+    return setting->getInt();
+}
+
+void ESM::GameSettingTable::reportMissing (const char *id)
+{
+    std::cerr << "Warning: GMST " << id << " not found, using 0" << std::endl;
+}
@@ -0,0 +1,181 @@
+#ifndef OPENMW_ESM_GAMESETTINGTABLE_H
+#define OPENMW_ESM_GAMESETTINGTABLE_H
+
+#include "loadgmst.hpp"
+
+/// Float GMSTs available as members of ESM::GameSettingTable
+#define ESM_GAMESETTING_FLOATS(GMST) \
+    GMST (fBargainOfferBase) \
+    GMST (fBargainOfferMulti) \
+    GMST (fBlockStillBonus) \
+    GMST (fBribe1000Mod) \
+    GMST (fBribe100Mod) \
+    GMST (fBribe10Mod) \
+    GMST (fCombatBlockLeftAngle) \
+    GMST (fCombatBlockRightAngle) \
+    GMST (fCombatCriticalStrikeMult) \
+    GMST (fCombatKODamageMult) \
+    GMST (fCrimeStealing) \
+    GMST (fDamageStrengthBase) \
+    GMST (fDamageStrengthMult) \
+    GMST (fDispCrimeMod) \
+    GMST (fDispDiseaseMod) \
+    GMST (fDispFactionMod) \
+    GMST (fDispFactionRankBase) \
+    GMST (fDispFactionRankMult) \
+    GMST (fDispPersonalityBase) \
+    GMST (fDispPersonalityMult) \
+    GMST (fDispRaceMod) \
+    GMST (fDispWeaponDrawn) \
+    GMST (fEnchantmentChanceMult) \
+    GMST (fEnchantmentConstantChanceMult) \
+    GMST (fEnchantmentMult) \
+    GMST (fEnchantmentValueMult) \
+    GMST (fEndFatigueMult) \
+    GMST (fFatigueBase) \
+    GMST (fFatigueBlockBase) \
+    GMST (fFatigueBlockMult) \
+    GMST (fFatigueJumpBase) \
+    GMST (fFatigueJumpMult) \
+    GMST (fFatigueMult) \
+    GMST (fFatigueReturnBase) \
+    GMST (fFatigueReturnMult) \
+    GMST (fFatigueRunBase) \
+    GMST (fFatigueRunMult) \
+    GMST (fFatigueSneakBase) \
+    GMST (fFatigueSneakMult) \
+    GMST (fFatigueSpellBase) \
+    GMST (fFatigueSpellMult) \
+    GMST (fFatigueSwimRunBase) \
+    GMST (fFatigueSwimRunMult) \
+    GMST (fFatigueSwimWalkBase) \
+    GMST (fFatigueSwimWalkMult) \
+    GMST (fFightStealing) \
+    GMST (fGreetDistanceReset) \
+    GMST (fHandToHandReach) \
+    GMST (fHoldBreathTime) \
+    GMST (fIdleChanceMultiplier) \
+    GMST (fJumpMoveBase) \
+    GMST (fJumpMoveMult) \
+    GMST (fLevelMod) \
+    GMST (fLevelUpHealthEndMult) \
+    GMST (fLuckMod) \
+    GMST (fMagesGuildTravel) \
+    GMST (fMajorSkillBonus) \
+    GMST (fMinorSkillBonus) \
+    GMST (fMiscSkillBonus) \
+    GMST (fPerDieRollMult) \
+    GMST (fPerTempMult) \
+    GMST (fPersonalityMod) \
+    GMST (fPickLockMult) \
+    GMST (fPickPocketMod) \
+    GMST (fPotionStrengthMult) \
+    GMST (fPotionT1DurMult) \
+    GMST (fPotionT1MagMult) \
+    GMST (fProjectileThrownStoreChance) \
+    GMST (fRepairAmountMult) \
+    GMST (fRepairMult) \
+    GMST (fReputationMod) \
+    GMST (fRestMagicMult) \
+    GMST (fSneakBootMult) \
+    GMST (fSneakDistanceBase) \
+    GMST (fSneakDistanceMultiplier) \
+    GMST (fSneakNoViewMult) \
+    GMST (fSneakSkillMult) \
+    GMST (fSneakViewMult) \
+    GMST (fSoulgemMult) \
+    GMST (fSpecialSkillBonus) \
+    GMST (fSuffocationDamage) \
+    GMST (fSwingBlockBase) \
+    GMST (fSwingBlockMult) \
+    GMST (fTrapCostMult) \
+    GMST (fTravelMult) \
+    GMST (fTravelTimeMult) \
+    GMST (fVoiceIdleOdds) \
+    GMST (fWeaponFatigueBlockMult) \
+    GMST (fWereWolfSilverWeaponDamageMult)
+
+/// Integer GMSTs available as members of ESM::GameSettingTable
+#define ESM_GAMESETTING_INTS(GMST) \
+    GMST (iAlchemyMod) \
+    GMST (iBarterFailDisposition) \
+    GMST (iBarterSuccessDisposition) \
+    GMST (iBlockMaxChance) \
+    GMST (iBlockMinChance) \
+    GMST (iCrimeAttack) \
+    GMST (iCrimeKilling) \
+    GMST (iCrimePickPocket) \
+    GMST (iCrimeTresspass) \
+    GMST (iFightAttack) \
+    GMST (iFightKilling) \
+    GMST (iFightPickpocket) \
+    GMST (iFightTrespass) \
+    GMST (iGreetDistanceMultiplier) \
+    GMST (iLevelUpMajorMult) \
+    GMST (iLevelUpMajorMultAttribute) \
+    GMST (iLevelUpMinorMult) \
+    GMST (iLevelUpMinorMultAttribute) \
+    GMST (iLevelUpTotal) \
+    GMST (iLevelupMiscMultAttriubte) \
+    GMST (iPerMinChance) \
+    GMST (iPerMinChange) \
+    GMST (iPickMaxChance) \
+    GMST (iPickMinChance) \
+    GMST (iSoulAmountForConstantEffect) \
+    GMST (iVoiceAttackOdds) \
+    GMST (iWereWolfBounty)
+
+namespace ESM
+{
+    /// \brief Typed copy of the numeric game settings that are read on frequently used code paths
+    ///
+    /// Reading a member replaces a lookup by ID, which lower-cases the ID and searches a map. To make
+    /// another GMST available, add it to ESM_GAMESETTING_FLOATS or ESM_GAMESETTING_INTS.
+    ///
+    /// \attention The table is a copy and needs to be filled again whenever the GMSTs it was
+    /// filled from change.
+    struct GameSettingTable
+    {
+#define ESM_GAMESETTING_FLOAT_MEMBER(id) float id;
+        ESM_GAMESETTING_FLOATS (ESM_GAMESETTING_FLOAT_MEMBER)
+#undef ESM_GAMESETTING_FLOAT_MEMBER
+
+#define ESM_GAMESETTING_INT_MEMBER(id) int id;
+        ESM_GAMESETTING_INTS (ESM_GAMESETTING_INT_MEMBER)
+#undef ESM_GAMESETTING_INT_MEMBER
+
+        GameSettingTable();
+
+        void blank();
+        ///< Set all members to 0.
+
+        template<typename Store>
+        void fill (const Store& store);
+        ///< Copy the GMSTs from \a store, which must provide a search function that takes an ID
+        /// and returns a const GameSetting pointer (0 if there is no such GMST).
+        ///
+        /// GMSTs missing from \a store are set to 0 and reported on std::cerr.
+
+        private:
+
+            static float getFloat (const GameSetting *setting, const char *id);
+
+            static int getInt (const GameSetting *setting, const char *id);
+
+            static void reportMissing (const char *id);
+    };
+
+    template<typename Store>
+    void GameSettingTable::fill (const Store& store)
+    {
+#define ESM_GAMESETTING_FILL_FLOAT(id) id = getFloat (store.search (#id), #id);
+        ESM_GAMESETTING_FLOATS (ESM_GAMESETTING_FILL_FLOAT)
+#undef ESM_GAMESETTING_FILL_FLOAT
+
+#define ESM_GAMESETTING_FILL_INT(id) id = getInt (store.search (#id), #id);
+        ESM_GAMESETTING_INTS (ESM_GAMESETTING_FILL_INT)
+#undef ESM_GAMESETTING_FILL_INT
+    }
+}
+
+#endif
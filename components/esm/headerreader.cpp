@@ -0,0 +1,113 @@
+#include "headerreader.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+void ESM::HeaderReader::fail (const std::string& message)
+{
+    throw std::runtime_error ("ESM Error: " + message + "\n  File: " + mFile);
+}
+
+void ESM::HeaderReader::read (void *data, std::size_t size)
+{
+    if (size>mLeft)
+        fail ("header record too short");
+
+    mStream.read (static_cast<char *> (data), size);
+
+    if (!mStream)
+        fail ("unexpected end of file");
+
+    mLeft -= size;
+}
+
+std::string ESM::HeaderReader::readString (std::size_t size)
+{
+    std::vector<char> buffer (size+1, 0);
+
+    if (size)
+        read (&buffer[0], size);
+
+    return std::string (&buffer[0]);
+}
+
+void ESM::HeaderReader::skip (std::size_t size)
+{
+    if (size>mLeft)
+        fail ("header record too short");
+
+    mStream.seekg (size, std::ios_base::cur);
+    mLeft -= size;
+}
+
+void ESM::HeaderReader::read (const std::string& file, Header& header)
+{
+    mFile = file;
+    mStream.close();
+    mStream.clear();
+    mStream.open (file.c_str(), std::ios_base::in | std::ios_base::binary);
+
+    if (!mStream)
+        fail ("can not open file");
+
+    header.blank();
+
+    NAME name;
+    uint32_t size = 0;
+    uint32_t flags[2];
+
+    mLeft = sizeof (name) + sizeof (size) + sizeof (flags);
+
+    readT (name);
+    readT (size);
+    readT (flags);
+
+    if (name!="TES3")
+        fail ("Not a valid Morrowind file");
+
+    mLeft = size;
+
+    while (mLeft>0)
+    {
+        NAME subName;
+        uint32_t subSize = 0;
+
+        readT (subName);
+        readT (subSize);
+
+        if (subSize>mLeft)
+            fail ("subrecord extends beyond header record");
+
+        if (subName=="FORM" && subSize==sizeof (header.mFormat))
+        {
+            readT (header.mFormat);
+
+            if (header.mFormat<0)
+                fail ("invalid format code");
+        }
+        else if (subName=="HEDR" && subSize==300)
+        {
+            readT (header.mData.version);
+            readT (header.mData.type);
+            read (header.mData.author.name, sizeof (header.mData.author.name));
+            read (header.mData.desc.name, sizeof (header.mData.desc.name));
+            readT (header.mData.records);
+        }
+        else if (subName=="MAST")
+        {
+            Header::MasterData master;
+            master.name = readString (subSize);
+            master.size = 0;
+            master.index = 0;
+            header.mMaster.push_back (master);
+        }
+        else if (subName=="DATA" && subSize==sizeof (uint64_t) && !header.mMaster.empty())
+        {
+            readT (header.mMaster.back().size);
+        }
+        else
+            skip (subSize);
+    }
+
+    mStream.close();
+}
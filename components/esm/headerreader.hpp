@@ -0,0 +1,44 @@
+#ifndef OPENMW_ESM_HEADERREADER_H
+#define OPENMW_ESM_HEADERREADER_H
+
+#include <fstream>
+#include <string>
+
+#include "loadtes3.hpp"
+
+namespace ESM
+{
+    /// \brief Reads only the TES3 file header record of a content file
+    ///
+    /// Unlike ESMReader::open this does not set up a data stream for the whole file and
+    /// performs no encoding conversion: author, description and master names are returned as
+    /// stored in the file. Intended for tools that need to scan many files quickly (e.g. the
+    /// content selector).
+    class HeaderReader
+    {
+            std::ifstream mStream;
+            std::string mFile;
+            std::size_t mLeft; // bytes left in the TES3 record
+
+            void fail (const std::string& message);
+
+            void read (void *data, std::size_t size);
+
+            template<typename T>
+            void readT (T& value)
+            {
+                read (&value, sizeof (T));
+            }
+
+            std::string readString (std::size_t size);
+
+            void skip (std::size_t size);
+
+        public:
+
+            void read (const std::string& file, Header& header);
+            ///< \param header Is replaced with the header of \a file.
+    };
+}
+
+#endif
@@ -33,7 +33,10 @@
 #include "effect.hpp"
 #include "controller.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <list>
+#include <new>
 
 //TODO: when threading is needed, enable these
 //#include <boost/mutex.hpp>
@@ -57,63 +60,109 @@ class NIFFile::LoadedCache
     typedef std::map < std::string, boost::weak_ptr <NIFFile> > loaded_map;
     typedef std::vector < boost::shared_ptr <NIFFile> > locked_files;
 
+    // most recently used first
+    typedef std::list < boost::shared_ptr <NIFFile> > recent_list;
+    typedef std::map < std::string, recent_list::iterator > recent_map;
+
     static int sLockLevel;
     static mutex sProtector;
     static loaded_map sLoadedMap;
     static locked_files sLockedFiles;
 
-public:
+    // strong references to the most recently used files, so that they survive
+    // their last user (e.g. when a cell is unloaded and loaded again later)
+    static recent_list sRecentList;
+    static recent_map sRecentMap;
+    static size_t sBudget;
+    static CacheStats sStats;
 
-    static ptr create (const std::string &name)
+    static std::string normalize (const std::string &name)
     {
-        lock_guard _ (sProtector);
-
-        ptr result;
+        std::string key = Misc::StringUtils::lowerCase (name);
+        std::replace (key.begin (), key.end (), '/', '\\');
+        return key;
+    }
 
-        // lookup the resource
-        loaded_map::iterator i = sLoadedMap.find (name);
+    /// Mark \a file as most recently used and return the files that no longer fit into
+    /// the budget via \a evicted (to be destroyed outside of the lock).
+    static void touch (const std::string &key, const ptr &file, recent_list &evicted)
+    {
+        recent_map::iterator i = sRecentMap.find (key);
 
-        if (i == sLoadedMap.end ()) // it doesn't existing currently,
-        {                           // or hasn't in the very near past
+        if (i != sRecentMap.end ())
+            sRecentList.splice (sRecentList.begin (), sRecentList, i->second);
+        else
+        {
+            sRecentList.push_front (file);
+            sRecentMap [key] = sRecentList.begin ();
+            sStats.mSize += file->size;
+        }
 
-            // create it now, for smoother threading if needed, the
-            // loading should be performed outside of the sLoaderMap
-            // lock and an alternate mechanism should be used to
-            // synchronize threads competing to load the same resource
-            result = boost::make_shared <NIFFile> (name, psudo_private_modifier());
+        shrink (evicted);
+    }
 
-            // if we are locking the cache add an extra reference
-            // to keep the file in memory
-            if (sLockLevel > 0)
-                sLockedFiles.push_back (result);
+    static void shrink (recent_list &evicted)
+    {
+        while (sStats.mSize > sBudget && !sRecentList.empty ())
+        {
+            recent_list::iterator last = --sRecentList.end ();
 
-            // stash a reference to the resource so that future
-            // calls can benefit
-            sLoadedMap [name] = boost::weak_ptr <NIFFile> (result);
+            sStats.mSize -= (*last)->size;
+            ++sStats.mEvictions;
+            sRecentMap.erase (normalize ((*last)->filename));
+            evicted.splice (evicted.end (), sRecentList, last);
         }
-        else // it may (probably) still exists
+    }
+
+public:
+
+    static ptr create (const std::string &name)
+    {
+        recent_list evicted;
+        ptr result;
+
         {
-            // attempt to get the reference
-            result = i->second.lock ();
+            lock_guard _ (sProtector);
 
-            if (!result) // resource is in the process of being destroyed
+            std::string key = normalize (name);
+
+            // lookup the resource
+            loaded_map::iterator i = sLoadedMap.find (key);
+
+            // it may (probably) still exists
+            if (i != sLoadedMap.end ())
+                result = i->second.lock ();
+
+            if (!result) // it doesn't existing currently, or is in the process of being destroyed
             {
-                // create a new instance, to replace the one that has
-                // begun the irreversible process of being destroyed
+                // create it now, for smoother threading if needed, the
+                // loading should be performed outside of the sLoaderMap
+                // lock and an alternate mechanism should be used to
+                // synchronize threads competing to load the same resource
                 result = boost::make_shared <NIFFile> (name, psudo_private_modifier());
+                ++sStats.mMisses;
 
-                // respect the cache lock...
+                // if we are locking the cache add an extra reference
+                // to keep the file in memory
                 if (sLockLevel > 0)
                     sLockedFiles.push_back (result);
 
-                // we potentially overwrite an expired pointer here
-                // but the other thread performing the delete on
-                // the previous copy of this resource will detect it
+                // stash a reference to the resource so that future
+                // calls can benefit; we potentially overwrite an expired
+                // pointer here but the other thread performing the delete
+                // on the previous copy of this resource will detect it
                 // and make sure not to erase the new reference
-                sLoadedMap [name] = boost::weak_ptr <NIFFile> (result);
+                sLoadedMap [key] = boost::weak_ptr <NIFFile> (result);
             }
+            else
+                ++sStats.mHits;
+
+            touch (key, result, evicted);
         }
 
+        // destroy evicted files outside of the protection of sProtector
+        evicted.clear ();
+
         // we made it!
         return result;
     }
@@ -122,7 +171,7 @@ public:
     {
         lock_guard _ (sProtector);
 
-        loaded_map::iterator i = sLoadedMap.find (file->filename);
+        loaded_map::iterator i = sLoadedMap.find (normalize (file->filename));
 
         // its got to be in here, it just might not be us...
         assert (i != sLoadedMap.end ());
@@ -158,21 +207,97 @@ public:
         // outside the protection of sProtector
         resetList.clear ();
     }
+
+    static void setBudget (size_t bytes)
+    {
+        recent_list evicted;
+
+        {
+            lock_guard _ (sProtector);
+
+            sBudget = bytes;
+            shrink (evicted);
+        }
+
+        evicted.clear ();
+    }
+
+    static void clear ()
+    {
+        recent_list evicted;
+
+        {
+            lock_guard _ (sProtector);
+
+            evicted.swap (sRecentList);
+            sRecentMap.clear ();
+            sStats.mSize = 0;
+        }
+
+        evicted.clear ();
+    }
+
+    static CacheStats getStats ()
+    {
+        lock_guard _ (sProtector);
+
+        return sStats;
+    }
 };
 
 int NIFFile::LoadedCache::sLockLevel = 0;
 NIFFile::LoadedCache::mutex NIFFile::LoadedCache::sProtector;
 NIFFile::LoadedCache::loaded_map NIFFile::LoadedCache::sLoadedMap;
 NIFFile::LoadedCache::locked_files NIFFile::LoadedCache::sLockedFiles;
+NIFFile::LoadedCache::recent_list NIFFile::LoadedCache::sRecentList;
+NIFFile::LoadedCache::recent_map NIFFile::LoadedCache::sRecentMap;
+size_t NIFFile::LoadedCache::sBudget = 32 * 1024 * 1024;
+NIFFile::CacheStats NIFFile::LoadedCache::sStats = NIFFile::CacheStats ();
 
-// these three calls are forwarded to the cache implementation...
+// these calls are forwarded to the cache implementation...
 void NIFFile::lockCache ()     { LoadedCache::lockCache (); }
 void NIFFile::unlockCache ()   { LoadedCache::unlockCache (); }
 NIFFile::ptr NIFFile::create (const std::string &name) { return LoadedCache::create  (name); }
+void NIFFile::setCacheBudget (size_t bytes) { LoadedCache::setBudget (bytes); }
+void NIFFile::clearCache ()    { LoadedCache::clear (); }
+NIFFile::CacheStats NIFFile::getCacheStats () { return LoadedCache::getStats (); }
+
+Arena::Arena (size_t blockSize)
+    : mBlockSize (blockSize), mUsed (blockSize)
+{
+}
+
+Arena::~Arena()
+{
+    for (std::size_t i=0; i<mBlocks.size(); ++i)
+        delete[] mBlocks[i];
+}
+
+void *Arena::allocate (size_t size)
+{
+    size = (size + sAlignment - 1) & ~(sAlignment - 1);
+
+    if (size > mBlockSize/4)
+    {
+        // give large allocations a block of their own, without abandoning the current block
+        mBlocks.insert (mBlocks.begin(), new char[size]);
+        return mBlocks.front();
+    }
+
+    if (mUsed + size > mBlockSize)
+    {
+        mBlocks.push_back (new char[mBlockSize]);
+        mUsed = 0;
+    }
+
+    void *data = mBlocks.back() + mUsed;
+    mUsed += size;
+    return data;
+}
 
 /// Open a NIF stream. The name is used for error messages.
 NIFFile::NIFFile(const std::string &name, psudo_private_modifier)
-    : filename(name)
+    : filename(name), size(0)
 {
     parse();
 }
@@ -181,15 +306,20 @@ NIFFile::~NIFFile()
 {
     LoadedCache::release (this);
 
+    // the memory is freed by the arena
     for(std::size_t i=0; i<records.size(); i++)
-        delete records[i];
+        if (records[i])
+            records[i]->~Record();
 }
 
-template <typename NodeType> static Record* construct() { return new NodeType; }
+template <typename NodeType> static Record* construct(Arena& arena)
+{
+    return new (arena.allocate (sizeof (NodeType))) NodeType;
+}
 
 struct RecordFactoryEntry {
 
-    typedef Record* (*create_t) ();
+    typedef Record* (*create_t) (Arena&);
 
     char const *    mName;
     create_t        mCreate;
@@ -289,6 +419,7 @@ RecordFactoryEntry const * lookupRecordFactory (char const * name)
 void NIFFile::parse()
 {
     NIFStream nif (this, Ogre::ResourceGroupManager::getSingleton().openResource(filename));
+    size = nif.getSize();
 
   // Check the header string
   std::string head = nif.getString(40);
@@ -323,7 +454,7 @@ void NIFFile::parse()
 
       if (entry != NULL)
       {
-          r = entry->mCreate ();
+          r = entry->mCreate (arena);
           r->recType = entry->mType;
       }
       else
@@ -331,7 +462,7 @@ void NIFFile::parse()
 
       assert(r != NULL);
       assert(r->recType != RC_MISSING);
-      r->recName = rec;
+      r->recName = entry->mName;
       r->recIndex = i;
       records[i] = r;
       r->read(&nif);
@@ -51,6 +51,31 @@
 namespace Nif
 {
 
+/// \brief Allocates memory in large blocks, which are only freed together
+class Arena
+{
+        std::vector<char *> mBlocks;
+        size_t mBlockSize;
+        size_t mUsed; ///< bytes used in the last block
+
+        // not implemented
+        Arena (const Arena&);
+        Arena& operator= (const Arena&);
+
+    public:
+
+        /// Alignment of all allocations
+        static const size_t sAlignment = 16;
+
+        Arena (size_t blockSize = 16*1024);
+
+        ~Arena();
+
+        void *allocate (size_t size);
+
+        size_t getBlockCount() const { return mBlocks.size(); }
+};
+
 class NIFFile
 {
     enum NIFVersion {
@@ -63,6 +88,12 @@ class NIFFile
     /// File name, used for error messages
     std::string filename;
 
+    /// File size in bytes, used to estimate the memory use for the cache budget
+    size_t size;
+
+    /// Memory for the records
+    Arena arena;
+
     /// Record list
     std::vector<Record*> records;
 
@@ -105,6 +136,27 @@ public:
     static void lockCache ();
     static void unlockCache ();
 
+    struct CacheStats
+    {
+        size_t mHits;      ///< create calls served by an already parsed file
+        size_t mMisses;    ///< create calls that had to parse the file
+        size_t mEvictions; ///< files dropped from the persistent cache to stay within the budget
+        size_t mSize;      ///< combined file size of the files in the persistent cache
+
+        CacheStats () : mHits (0), mMisses (0), mEvictions (0), mSize (0) {}
+    };
+
+    /// Besides the files that are currently in use, the cache keeps the most recently used
+    /// files in memory until their combined file size exceeds \a bytes (32 MiB by default;
+    /// 0 disables this).
+    static void setCacheBudget (size_t bytes);
+
+    /// Drop the persistent references to recently used files (files that are still in use
+    /// remain cached).
+    static void clearCache ();
+
+    static CacheStats getCacheStats ();
+
     struct CacheLock
     {
         CacheLock () { lockCache (); }
@@ -1,6 +1,11 @@
 #ifndef OPENMW_COMPONENTS_NIF_NIFSTREAM_HPP
 #define OPENMW_COMPONENTS_NIF_NIFSTREAM_HPP
 
+#include <algorithm>
+#include <cstring>
+
+#include <OgrePlatform.h>
+
 namespace Nif
 {
 
@@ -8,26 +13,59 @@ class NIFFile;
 
 class NIFStream {
 
-    /// Input stream
-    Ogre::DataStreamPtr inp;
+    /// Contents of the whole input stream
+    std::vector<uint8_t> mBuffer;
+
+    /// Read position in mBuffer
+    size_t mPos;
+
+    /// Skip the rest of the input after a short read
+    void skipRest()
+    {
+        mPos = mBuffer.size();
+    }
+
+    /// Pointer to the next \a size bytes, 0 if fewer than \a size bytes are left (in which case
+    /// the rest of the buffer is skipped, like a short read from the input stream would)
+    const uint8_t *advance (size_t size)
+    {
+        if (size > mBuffer.size()-mPos || mBuffer.empty())
+        {
+            skipRest();
+            return 0;
+        }
+
+        const uint8_t *data = &mBuffer[0] + mPos;
+        mPos += size;
+        return data;
+    }
+
+    static uint16_t decode_le16 (const uint8_t *buffer)
+    {
+        return buffer[0] | (buffer[1]<<8);
+    }
+    static uint32_t decode_le32 (const uint8_t *buffer)
+    {
+        return buffer[0] | (buffer[1]<<8) | (buffer[2]<<16) | (buffer[3]<<24);
+    }
 
     uint8_t read_byte()
     {
-        uint8_t byte;
-        if(inp->read(&byte, 1) != 1) return 0;
-        return byte;
+        const uint8_t *buffer = advance (1);
+        if(!buffer) return 0;
+        return buffer[0];
     }
     uint16_t read_le16()
     {
-        uint8_t buffer[2];
-        if(inp->read(buffer, 2) != 2) return 0;
-        return buffer[0] | (buffer[1]<<8);
+        const uint8_t *buffer = advance (2);
+        if(!buffer) return 0;
+        return decode_le16 (buffer);
     }
     uint32_t read_le32()
     {
-        uint8_t buffer[4];
-        if(inp->read(buffer, 4) != 4) return 0;
-        return buffer[0] | (buffer[1]<<8) | (buffer[2]<<16) | (buffer[3]<<24);
+        const uint8_t *buffer = advance (4);
+        if(!buffer) return 0;
+        return decode_le32 (buffer);
     }
     float read_le32f()
     {
@@ -38,11 +76,90 @@ class NIFStream {
         return u.f;
     }
 
+    /// Number of whole values of \a size bytes left in the input, at most \a count
+    size_t available (size_t count, size_t size) const
+    {
+        return std::min (count, (mBuffer.size()-mPos)/size);
+    }
+
+    /// Read \a count floats into \a data
+    ///
+    /// If the input ends prematurely, the floats read completely are kept and the rest are 0, as
+    /// when reading the floats one at a time.
+    void read_le32fs (float *data, size_t count)
+    {
+        size_t read = available (count, 4);
+        if(read)
+        {
+            const uint8_t *buffer = advance (read*4);
+#if OGRE_ENDIAN == OGRE_ENDIAN_LITTLE
+            std::memcpy (data, buffer, read*4);
+#else
+            for(size_t i = 0;i < read;i++)
+            {
+                union {
+                    uint32_t i;
+                    float f;
+                } u = { decode_le32 (buffer+i*4) };
+                data[i] = u.f;
+            }
+#endif
+        }
+        if(read < count)
+        {
+            std::fill (data+read, data+count, 0.0f);
+            skipRest();
+        }
+    }
+
+    /// Read \a size values of type T, each consisting of \a N floats
+    template<typename T, size_t N>
+    void read_packed (std::vector<T> &vec, size_t size, T (NIFStream::*getValue)())
+    {
+        vec.resize(size);
+        if(size == 0)
+            return;
+
+        // the Ogre math types are plain arrays of Ogre::Real, unless built with double precision
+        if(sizeof(T) == N*sizeof(float) && sizeof(Ogre::Real) == sizeof(float))
+            read_le32fs (reinterpret_cast<float *> (&vec[0]), size*N);
+        else
+        {
+            for(size_t i = 0;i < vec.size();i++)
+                vec[i] = (this->*getValue)();
+        }
+    }
+
+    static std::vector<uint8_t> load (Ogre::DataStreamPtr inp)
+    {
+        std::vector<uint8_t> buffer (inp->size());
+
+        if (!buffer.empty())
+            buffer.resize (inp->read (&buffer[0], buffer.size()));
+
+        // size unknown or stream longer than claimed
+        while (!inp->eof())
+        {
+            size_t begin = buffer.size();
+            buffer.resize (begin+65536);
+            buffer.resize (begin+inp->read (&buffer[begin], 65536));
+
+            if (buffer.size()==begin)
+                break;
+        }
+
+        return buffer;
+    }
+
 public:
 
     NIFFile * const file;
 
-    NIFStream (NIFFile * file, Ogre::DataStreamPtr inp): file (file), inp (inp) {}
+    /// \note The whole content of \a inp is read into memory immediately.
+    NIFStream (NIFFile * file, Ogre::DataStreamPtr inp): mBuffer (load (inp)), mPos (0), file (file) {}
+
+    /// Size of the input in bytes
+    size_t getSize() const { return mBuffer.size(); }
 
     /*************************************************
                Parser functions
@@ -67,8 +184,14 @@ public:
         Value = GetHandler <T>::read (nif);
     }
 
-    void skip(size_t size) { inp->skip(size); }
-    void read (void * data, size_t size) { inp->read (data, size); }
+    void skip(size_t size) { mPos += std::min (size, mBuffer.size()-mPos); }
+    void read (void * data, size_t size)
+    {
+        size = std::min (size, mBuffer.size()-mPos);
+        if (size)
+            std::memcpy (data, &mBuffer[mPos], size);
+        mPos += size;
+    }
 
     char getChar() { return read_byte(); }
     short getShort() { return read_le16(); }
@@ -79,39 +202,37 @@ public:
     Ogre::Vector2 getVector2()
     {
         float a[2];
-        for(size_t i = 0;i < 2;i++)
-            a[i] = getFloat();
+        read_le32fs(a, 2);
         return Ogre::Vector2(a);
     }
     Ogre::Vector3 getVector3()
     {
         float a[3];
-        for(size_t i = 0;i < 3;i++)
-            a[i] = getFloat();
+        read_le32fs(a, 3);
         return Ogre::Vector3(a);
     }
     Ogre::Vector4 getVector4()
     {
         float a[4];
-        for(size_t i = 0;i < 4;i++)
-            a[i] = getFloat();
+        read_le32fs(a, 4);
         return Ogre::Vector4(a);
     }
     Ogre::Matrix3 getMatrix3()
     {
+        float f[3][3];
+        read_le32fs(f[0], 9);
         Ogre::Real a[3][3];
         for(size_t i = 0;i < 3;i++)
         {
             for(size_t j = 0;j < 3;j++)
-                a[i][j] = Ogre::Real(getFloat());
+                a[i][j] = Ogre::Real(f[i][j]);
         }
         return Ogre::Matrix3(a);
     }
     Ogre::Quaternion getQuaternion()
     {
         float a[4];
-        for(size_t i = 0;i < 4;i++)
-            a[i] = getFloat();
+        read_le32fs(a, 4);
         return Ogre::Quaternion(a);
     }
     Transformation getTrafo()
@@ -125,12 +246,17 @@ public:
 
     std::string getString(size_t length)
     {
-        std::vector<char> str (length+1, 0);
+        if(length == 0)
+            return std::string();
+
+        const uint8_t *data = advance (length);
 
-        if(inp->read(&str[0], length) != length)
+        if(!data)
             throw std::runtime_error ("string length in NIF file does not match");
 
-        return &str[0];
+        // stop at the first 0, like a C string
+        return std::string (reinterpret_cast<const char *> (data),
+            std::find (data, data+length, 0) - data);
     }
     std::string getString()
     {
@@ -141,38 +267,40 @@ public:
     void getShorts(std::vector<short> &vec, size_t size)
     {
         vec.resize(size);
-        for(size_t i = 0;i < vec.size();i++)
-            vec[i] = getShort();
+        size_t read = available (size, 2);
+        if(read)
+        {
+            const uint8_t *buffer = advance (read*2);
+            for(size_t i = 0;i < read;i++)
+                vec[i] = decode_le16 (buffer+i*2);
+        }
+        if(read < size)
+        {
+            std::fill (vec.begin()+read, vec.end(), 0);
+            skipRest();
+        }
     }
     void getFloats(std::vector<float> &vec, size_t size)
     {
         vec.resize(size);
-        for(size_t i = 0;i < vec.size();i++)
-            vec[i] = getFloat();
+        if(size)
+            read_le32fs(&vec[0], size);
     }
     void getVector2s(std::vector<Ogre::Vector2> &vec, size_t size)
     {
-        vec.resize(size);
-        for(size_t i = 0;i < vec.size();i++)
-            vec[i] = getVector2();
+        read_packed<Ogre::Vector2, 2> (vec, size, &NIFStream::getVector2);
     }
     void getVector3s(std::vector<Ogre::Vector3> &vec, size_t size)
     {
-        vec.resize(size);
-        for(size_t i = 0;i < vec.size();i++)
-            vec[i] = getVector3();
+        read_packed<Ogre::Vector3, 3> (vec, size, &NIFStream::getVector3);
     }
     void getVector4s(std::vector<Ogre::Vector4> &vec, size_t size)
     {
-        vec.resize(size);
-        for(size_t i = 0;i < vec.size();i++)
-            vec[i] = getVector4();
+        read_packed<Ogre::Vector4, 4> (vec, size, &NIFStream::getVector4);
     }
     void getQuaternions(std::vector<Ogre::Quaternion> &quat, size_t size)
     {
-        quat.resize(size);
-        for(size_t i = 0;i < quat.size();i++)
-            quat[i] = getQuaternion();
+        read_packed<Ogre::Quaternion, 4> (quat, size, &NIFStream::getQuaternion);
     }
 };
 
@@ -95,12 +95,12 @@ enum RecordType
 /// Base class for all records
 struct Record
 {
-    // Record type and type name
+    // Record type and type name (points into the static record factory table)
     int recType;
-    std::string recName;
+    const char *recName;
     size_t recIndex;
 
-    Record() : recType(RC_MISSING), recIndex(~(size_t)0) {}
+    Record() : recType(RC_MISSING), recName(""), recIndex(~(size_t)0) {}
 
     /// Parses the record from file
     virtual void read(NIFStream *nif) = 0;
@@ -108,13 +108,9 @@ struct Record
     /// Does post-processing, after the entire tree is loaded
     virtual void post(NIFFile *nif) {}
 
+    /// \note Records are allocated from the arena of the NIFFile they belong to and must
+    /// not be deleted.
     virtual ~Record() {}
-
-    /*
-       Use these later if you want custom allocation of all NIF objects
-    static void* operator new(size_t size);
-    static void operator delete(void *p);
-    */
 };
 
 } // Namespace
@@ -104,7 +104,7 @@ void ManualBulletShapeLoader::loadResource(Ogre::Resource *resource)
     if (node == NULL)
     {
         warn("First root in file was not a node, but a " +
-             r->recName + ". Skipping file.");
+             std::string(r->recName) + ". Skipping file.");
         return;
     }
 
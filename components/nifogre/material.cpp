@@ -10,8 +10,10 @@
 #include <OgreMaterialManager.h>
 #include <OgreMaterial.h>
 
-#include <boost/functional/hash.hpp>
-
+namespace
+{
+    NifOgre::NIFMaterialLoader::Stats sStats = { 0, 0 };
+}
 
 namespace NifOgre
 {
@@ -151,7 +153,7 @@ Ogre::String NIFMaterialLoader::getMaterial(const Nif::ShapeData *shapedata,
         while(!ctrls.empty())
         {
             if (ctrls->recType != Nif::RC_NiFlipController) // Handled in ogrenifloader
-                warn("Unhandled texture controller "+ctrls->recName+" in "+name);
+                warn("Unhandled texture controller "+std::string(ctrls->recName)+" in "+name);
             ctrls = ctrls->next;
         }
     }
@@ -165,7 +167,7 @@ Ogre::String NIFMaterialLoader::getMaterial(const Nif::ShapeData *shapedata,
         Nif::ControllerPtr ctrls = alphaprop->controller;
         while(!ctrls.empty())
         {
-            warn("Unhandled alpha controller "+ctrls->recName+" in "+name);
+            warn("Unhandled alpha controller "+std::string(ctrls->recName)+" in "+name);
             ctrls = ctrls->next;
         }
     }
@@ -180,7 +182,7 @@ Ogre::String NIFMaterialLoader::getMaterial(const Nif::ShapeData *shapedata,
         Nif::ControllerPtr ctrls = vertprop->controller;
         while(!ctrls.empty())
         {
-            warn("Unhandled vertex color controller "+ctrls->recName+" in "+name);
+            warn("Unhandled vertex color controller "+std::string(ctrls->recName)+" in "+name);
             ctrls = ctrls->next;
         }
     }
@@ -193,7 +195,7 @@ Ogre::String NIFMaterialLoader::getMaterial(const Nif::ShapeData *shapedata,
         Nif::ControllerPtr ctrls = zprop->controller;
         while(!ctrls.empty())
         {
-            warn("Unhandled depth controller "+ctrls->recName+" in "+name);
+            warn("Unhandled depth controller "+std::string(ctrls->recName)+" in "+name);
             ctrls = ctrls->next;
         }
     }
@@ -205,7 +207,7 @@ Ogre::String NIFMaterialLoader::getMaterial(const Nif::ShapeData *shapedata,
         Nif::ControllerPtr ctrls = specprop->controller;
         while(!ctrls.empty())
         {
-            warn("Unhandled specular controller "+ctrls->recName+" in "+name);
+            warn("Unhandled specular controller "+std::string(ctrls->recName)+" in "+name);
             ctrls = ctrls->next;
         }
     }
@@ -217,7 +219,7 @@ Ogre::String NIFMaterialLoader::getMaterial(const Nif::ShapeData *shapedata,
         Nif::ControllerPtr ctrls = wireprop->controller;
         while(!ctrls.empty())
         {
-            warn("Unhandled wireframe controller "+ctrls->recName+" in "+name);
+            warn("Unhandled wireframe controller "+std::string(ctrls->recName)+" in "+name);
             ctrls = ctrls->next;
         }
     }
@@ -236,51 +238,45 @@ Ogre::String NIFMaterialLoader::getMaterial(const Nif::ShapeData *shapedata,
         while(!ctrls.empty())
         {
             if (ctrls->recType != Nif::RC_NiAlphaController && ctrls->recType != Nif::RC_NiMaterialColorController)
-                warn("Unhandled material controller "+ctrls->recName+" in "+name);
+                warn("Unhandled material controller "+std::string(ctrls->recName)+" in "+name);
             ctrls = ctrls->next;
         }
     }
 
     {
-        // Generate a hash out of all properties that can affect the material.
-        size_t h = 0;
-        boost::hash_combine(h, ambient.x);
-        boost::hash_combine(h, ambient.y);
-        boost::hash_combine(h, ambient.z);
-        boost::hash_combine(h, diffuse.x);
-        boost::hash_combine(h, diffuse.y);
-        boost::hash_combine(h, diffuse.z);
-        boost::hash_combine(h, alpha);
-        boost::hash_combine(h, specular.x);
-        boost::hash_combine(h, specular.y);
-        boost::hash_combine(h, specular.z);
-        boost::hash_combine(h, glossiness);
-        boost::hash_combine(h, emissive.x);
-        boost::hash_combine(h, emissive.y);
-        boost::hash_combine(h, emissive.z);
-        for(int i = 0;i < 7;i++)
+        // Collect all properties that can affect the material.
+        MaterialKey key;
+        for(int i = 0;i < 3;i++)
         {
-            if(!texName[i].empty())
-                boost::hash_combine(h, texName[i]);
+            key.mAmbient[i] = ambient[i];
+            key.mDiffuse[i] = diffuse[i];
+            key.mSpecular[i] = specular[i];
+            key.mEmissive[i] = emissive[i];
         }
-        boost::hash_combine(h, vertexColour);
-        boost::hash_combine(h, alphaFlags);
-        boost::hash_combine(h, alphaTest);
-        boost::hash_combine(h, vertMode);
-        boost::hash_combine(h, depthFlags);
-        boost::hash_combine(h, specFlags);
-        boost::hash_combine(h, wireFlags);
-
-        std::map<size_t,std::string>::iterator itr = sMaterialMap.find(h);
+        key.mGlossiness = glossiness;
+        key.mAlpha = alpha;
+        key.mAlphaFlags = alphaFlags;
+        key.mAlphaTest = alphaTest;
+        key.mVertMode = vertMode;
+        key.mDepthFlags = depthFlags;
+        key.mSpecFlags = specFlags;
+        key.mWireFlags = wireFlags;
+        key.mVertexColour = vertexColour;
+        for(int i = 0;i < 7;i++)
+            key.mTextures[i] = internTextureName(texName[i]);
+
+        MaterialMap::iterator itr = sMaterialMap.find(key);
         if (itr != sMaterialMap.end())
         {
             // a suitable material exists already - use it
+            ++sStats.mReused;
             sh::MaterialInstance* instance = sh::Factory::getInstance().getMaterialInstance(itr->second);
             needTangents = !sh::retrieveValue<sh::StringValue>(instance->getProperty("normalMap"), instance).get().empty();
             return itr->second;
         }
         // not found, create a new one
-        sMaterialMap.insert(std::make_pair(h, name));
+        sMaterialMap.insert(std::make_pair(key, name));
+        ++sStats.mCreated;
     }
 
     // No existing material like this. Create a new one.
@@ -415,6 +411,11 @@ Ogre::String NIFMaterialLoader::getMaterial(const Nif::ShapeData *shapedata,
     return name;
 }
 
-std::map<size_t,std::string> NIFMaterialLoader::sMaterialMap;
+NIFMaterialLoader::Stats NIFMaterialLoader::getStats()
+{
+    return sStats;
+}
+
+NIFMaterialLoader::MaterialMap NIFMaterialLoader::sMaterialMap;
 
 }
@@ -6,8 +6,18 @@
 #include <map>
 #include <cassert>
 
+#ifdef _WIN32
+#include <boost/tr1/tr1/unordered_map>
+#elif defined HAVE_UNORDERED_MAP
+#include <unordered_map>
+#else
+#include <tr1/unordered_map>
+#endif
+
 #include <OgreString.h>
 
+#include "materialkey.hpp"
+
 namespace Nif
 {
     class ShapeData;
@@ -35,9 +45,24 @@ class NIFMaterialLoader {
         abort();
     }
 
-    static std::map<size_t,std::string> sMaterialMap;
+#if defined HAVE_UNORDERED_MAP
+    typedef std::unordered_map<MaterialKey, std::string, MaterialKeyHash> MaterialMap;
+#else
+    typedef std::tr1::unordered_map<MaterialKey, std::string, MaterialKeyHash> MaterialMap;
+#endif
+
+    static MaterialMap sMaterialMap;
 
 public:
+    struct Stats
+    {
+        size_t mCreated; ///< materials created
+        size_t mReused; ///< requests answered with an existing material
+    };
+
+    /// Totals since the program started; compare two calls for the materials created in between.
+    static Stats getStats();
+
     static std::string findTextureName(const std::string &filename);
 
     static Ogre::String getMaterial(const Nif::ShapeData *shapedata,
@@ -0,0 +1,92 @@
+#include "materialkey.hpp"
+
+#include <cstring>
+#include <set>
+
+#include <boost/cstdint.hpp>
+#include <boost/functional/hash.hpp>
+
+namespace
+{
+    boost::uint32_t toBits (float value)
+    {
+        boost::uint32_t bits;
+        std::memcpy (&bits, &value, sizeof (bits));
+        return bits;
+    }
+
+    bool equalBits (const float *left, const float *right, int count)
+    {
+        for (int i=0; i<count; ++i)
+            if (toBits (left[i])!=toBits (right[i]))
+                return false;
+
+        return true;
+    }
+
+    void hashBits (std::size_t& seed, const float *values, int count)
+    {
+        for (int i=0; i<count; ++i)
+            boost::hash_combine (seed, toBits (values[i]));
+    }
+}
+
+namespace NifOgre
+{
+
+std::size_t MaterialKey::hash() const
+{
+    std::size_t seed = 0;
+
+    hashBits (seed, mAmbient, 3);
+    hashBits (seed, mDiffuse, 3);
+    hashBits (seed, mSpecular, 3);
+    hashBits (seed, mEmissive, 3);
+    hashBits (seed, &mGlossiness, 1);
+    hashBits (seed, &mAlpha, 1);
+    boost::hash_combine (seed, mAlphaFlags);
+    boost::hash_combine (seed, mAlphaTest);
+    boost::hash_combine (seed, mVertMode);
+    boost::hash_combine (seed, mDepthFlags);
+    boost::hash_combine (seed, mSpecFlags);
+    boost::hash_combine (seed, mWireFlags);
+    boost::hash_combine (seed, mVertexColour);
+
+    for (int i=0; i<7; ++i)
+        boost::hash_combine (seed, mTextures[i]);
+
+    return seed;
+}
+
+bool operator== (const MaterialKey& left, const MaterialKey& right)
+{
+    if (left.mAlphaFlags!=right.mAlphaFlags || left.mAlphaTest!=right.mAlphaTest ||
+        left.mVertMode!=right.mVertMode || left.mDepthFlags!=right.mDepthFlags ||
+        left.mSpecFlags!=right.mSpecFlags || left.mWireFlags!=right.mWireFlags ||
+        left.mVertexColour!=right.mVertexColour)
+        return false;
+
+    for (int i=0; i<7; ++i)
+        if (left.mTextures[i]!=right.mTextures[i])
+            return false;
+
+    return
+        equalBits (left.mAmbient, right.mAmbient, 3) &&
+        equalBits (left.mDiffuse, right.mDiffuse, 3) &&
+        equalBits (left.mSpecular, right.mSpecular, 3) &&
+        equalBits (left.mEmissive, right.mEmissive, 3) &&
+        equalBits (&left.mGlossiness, &right.mGlossiness, 1) &&
+        equalBits (&left.mAlpha, &right.mAlpha, 1);
+}
+
+const std::string *internTextureName (const std::string& name)
+{
+    if (name.empty())
+        return 0;
+
+    static std::set<std::string> names;
+
+    return &*names.insert (name).first;
+}
+
+}
@@ -0,0 +1,58 @@
+#ifndef COMPONENTS_NIFOGRE_MATERIALKEY_HPP
+#define COMPONENTS_NIFOGRE_MATERIALKEY_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace NifOgre
+{
+
+/// \brief All NIF properties that affect a material generated by NIFMaterialLoader
+///
+/// Two shapes with equal keys get the same material. Floats are compared by bit pattern, so
+/// comparison is exact and a key is always equal to itself. Texture names are interned (see
+/// internTextureName), so they are compared by pointer instead of by content.
+struct MaterialKey
+{
+    float mAmbient[3];
+    float mDiffuse[3];
+    float mSpecular[3];
+    float mEmissive[3];
+    float mGlossiness;
+    float mAlpha;
+    int mAlphaFlags;
+    int mAlphaTest;
+    int mVertMode;
+    int mDepthFlags;
+    int mSpecFlags;
+    int mWireFlags;
+    bool mVertexColour;
+    const std::string *mTextures[7]; ///< interned names, 0 for unused layers
+
+    std::size_t hash() const;
+};
+
+bool operator== (const MaterialKey& left, const MaterialKey& right);
+
+inline bool operator!= (const MaterialKey& left, const MaterialKey& right)
+{
+    return !(left==right);
+}
+
+struct MaterialKeyHash
+{
+    std::size_t operator() (const MaterialKey& key) const
+    {
+        return key.hash();
+    }
+};
+
+/// Returns a pointer that is the same for all calls with an equal \a name. The pointer stays
+/// valid for the lifetime of the program.
+///
+/// \return 0, if \a name is empty.
+const std::string *internTextureName (const std::string& name);
+
+}
+
+#endif
@@ -586,6 +586,54 @@ public:
 };
 
 
+/** Everything NIFObjectLoader needs to create an instance of a NIF file, without walking
+ * the file's node tree again.
+ */
+struct ObjectTemplate
+{
+    struct Step
+    {
+        enum Type
+        {
+            Type_Billboard,
+            Type_NodeControllers,
+            Type_Entity,
+            Type_Particles
+        };
+
+        Type mType;
+        const Nif::Node *mNode;
+        std::string mMeshName; // Type_Entity only
+        int mBone; // Type_Billboard only
+        int mFlags;
+        int mAnimFlags;
+        int mPartFlags;
+    };
+
+    /// How an entity of a bounded part is attached; see Loader::createObjects.
+    enum Attachment
+    {
+        Attach_None,
+        Attach_Node,
+        Attach_Bone,
+        Attach_Detach
+    };
+
+    // The file whose records mRoot and mSteps refer to. Not kept alive by the template; whoever
+    // instantiates the template has to hold the file.
+    boost::weak_ptr<Nif::NIFFile> mFile;
+    const Nif::Node *mRoot;
+    bool mHasSkelBase;
+    std::vector<Step> mSteps;
+    std::map<int,TextKeyMap> mTextKeys;
+
+    // One entry per entity in ObjectScene::mEntities; filled in by the first instance
+    std::vector<Attachment> mAttachments;
+
+    ObjectTemplate() : mRoot(NULL), mHasSkelBase(false)
+    { }
+};
+
 /** Object creator for NIFs. This is the main class responsible for creating
  * "live" Ogre objects (entities, particle systems, controllers, etc) from
  * their NIF equivalents.
@@ -597,16 +645,20 @@ class NIFObjectLoader
         std::cerr << "NIFObjectLoader: Warn: " << msg << std::endl;
     }
 
-    static void createEntity(const std::string &name, const std::string &group,
-                             Ogre::SceneManager *sceneMgr, ObjectScenePtr scene,
-                             const Nif::Node *node, int flags, int animflags)
+    static std::string getMeshName(const std::string &name, const Nif::Node *shape)
     {
-        const Nif::NiTriShape *shape = static_cast<const Nif::NiTriShape*>(node);
-
         std::string fullname = name+"@index="+Ogre::StringConverter::toString(shape->recIndex);
         if(shape->name.length() > 0)
             fullname += "@shape="+shape->name;
         Misc::StringUtils::toLower(fullname);
+        return fullname;
+    }
+
+    static void createEntity(const std::string &name, const std::string &fullname, const std::string &group,
+                             Ogre::SceneManager *sceneMgr, ObjectScenePtr scene,
+                             const Nif::Node *node, int flags, int animflags)
+    {
+        const Nif::NiTriShape *shape = static_cast<const Nif::NiTriShape*>(node);
 
         Ogre::MeshManager &meshMgr = Ogre::MeshManager::getSingleton();
         if(meshMgr.getByName(fullname).isNull())
@@ -810,7 +862,7 @@ class NIFObjectLoader
                 // TODO: Implement (Ogre::RotationAffector?)
             }
             else
-                warn("Unhandled particle modifier "+e->recName);
+                warn("Unhandled particle modifier "+std::string(e->recName));
             e = e->extra;
         }
     }
@@ -986,9 +1038,8 @@ class NIFObjectLoader
     }
 
 
-    static void createObjects(const std::string &name, const std::string &group,
-                              Ogre::SceneNode *sceneNode, const Nif::Node *node,
-                              ObjectScenePtr scene, int flags, int animflags, int partflags)
+    static void collectSteps(const std::string &name, const Nif::Node *node,
+                             ObjectTemplate &tmpl, int flags, int animflags, int partflags)
     {
         // Do not create objects for the collision shape (includes all children)
         if(node->recType == Nif::RC_RootCollisionNode)
@@ -1006,15 +1057,21 @@ class NIFObjectLoader
         else
             flags |= node->flags;
 
+        ObjectTemplate::Step step;
+        step.mNode = node;
+        step.mFlags = flags;
+        step.mAnimFlags = animflags;
+        step.mPartFlags = partflags;
+        step.mBone = -1;
+
         if (node->recType == Nif::RC_NiBillboardNode)
         {
             // TODO: figure out what the flags mean.
             // NifSkope has names for them, but doesn't implement them.
             // Change mBillboardNodes to map <Bone, billboard type>
-            int trgtid = NIFSkeletonLoader::lookupOgreBoneHandle(name, node->recIndex);
-            Ogre::Bone* bone = scene->mSkelBase->getSkeleton()->getBone(trgtid);
-            bone->setManuallyControlled(true);
-            scene->mBillboardNodes.push_back(bone);
+            step.mType = ObjectTemplate::Step::Type_Billboard;
+            step.mBone = NIFSkeletonLoader::lookupOgreBoneHandle(name, node->recIndex);
+            tmpl.mSteps.push_back(step);
         }
 
         Nif::ExtraPtr e = node->extra;
@@ -1024,10 +1081,10 @@ class NIFObjectLoader
             {
                 const Nif::NiTextKeyExtraData *tk = static_cast<const Nif::NiTextKeyExtraData*>(e.getPtr());
 
-                if (scene->mSkelBase)
+                if (tmpl.mHasSkelBase)
                 {
                     int trgtid = NIFSkeletonLoader::lookupOgreBoneHandle(name, node->recIndex);
-                    extractTextKeys(tk, scene->mTextKeys[trgtid]);
+                    extractTextKeys(tk, tmpl.mTextKeys[trgtid]);
                 }
             }
             else if(e->recType == Nif::RC_NiStringExtraData)
@@ -1040,6 +1097,7 @@ class NIFObjectLoader
                     // Marker objects. These meshes are only visible in the
                     // editor.
                     flags |= 0x80000000;
+                    step.mFlags = flags;
                 }
             }
 
@@ -1047,7 +1105,10 @@ class NIFObjectLoader
         }
 
         if(!node->controller.empty())
-            createNodeControllers(name, node->controller, scene, animflags);
+        {
+            step.mType = ObjectTemplate::Step::Type_NodeControllers;
+            tmpl.mSteps.push_back(step);
+        }
 
         if(node->recType == Nif::RC_NiCamera)
         {
@@ -1056,13 +1117,16 @@ class NIFObjectLoader
 
         if(node->recType == Nif::RC_NiTriShape && !(flags&0x80000000))
         {
-            createEntity(name, group, sceneNode->getCreator(), scene, node, flags, animflags);
+            step.mType = ObjectTemplate::Step::Type_Entity;
+            step.mMeshName = getMeshName(name, node);
+            tmpl.mSteps.push_back(step);
         }
 
         if((node->recType == Nif::RC_NiAutoNormalParticles ||
             node->recType == Nif::RC_NiRotatingParticles) && !(flags&0x40000000))
         {
-            createParticleSystem(name, group, sceneNode, scene, node, flags, partflags, animflags);
+            step.mType = ObjectTemplate::Step::Type_Particles;
+            tmpl.mSteps.push_back(step);
         }
 
         const Nif::NiNode *ninode = dynamic_cast<const Nif::NiNode*>(node);
@@ -1072,7 +1136,7 @@ class NIFObjectLoader
             for(size_t i = 0;i < children.length();i++)
             {
                 if(!children[i].empty())
-                    createObjects(name, group, sceneNode, children[i].getPtr(), scene, flags, animflags, partflags);
+                    collectSteps(name, children[i].getPtr(), tmpl, flags, animflags, partflags);
             }
         }
     }
@@ -1093,9 +1157,12 @@ class NIFObjectLoader
     }
 
 public:
-    static void load(Ogre::SceneNode *sceneNode, ObjectScenePtr scene, const std::string &name, const std::string &group, int flags=0)
+    /// Converts the NIF file \a name into the steps needed to create an instance of it.
+    static void prepare(ObjectTemplate &tmpl, const Nif::NIFFile::ptr &nif, const std::string &name,
+                        const std::string &group, int flags=0)
     {
-        Nif::NIFFile::ptr nif = Nif::NIFFile::create(name);
+        tmpl.mFile = nif;
+
         if(nif->numRoots() < 1)
         {
             nif->warn("Found no root nodes in "+name+".");
@@ -1113,13 +1180,60 @@ public:
             return;
         }
 
-        if(Ogre::SkeletonManager::getSingleton().resourceExists(name) ||
-           !NIFSkeletonLoader::createSkeleton(name, group, node).isNull())
+        tmpl.mRoot = node;
+
+        // Create a base skeleton entity if this NIF needs one
+        tmpl.mHasSkelBase = Ogre::SkeletonManager::getSingleton().resourceExists(name) ||
+                            !NIFSkeletonLoader::createSkeleton(name, group, node).isNull();
+
+        collectSteps(name, node, tmpl, flags, 0, 0);
+    }
+
+    static void instantiate(const ObjectTemplate &tmpl, Ogre::SceneNode *sceneNode, ObjectScenePtr scene,
+                            const std::string &name, const std::string &group)
+    {
+        if(!tmpl.mRoot)
+            return;
+
+        if(tmpl.mHasSkelBase)
         {
-            // Create a base skeleton entity if this NIF needs one
-            createSkelBase(name, group, sceneNode->getCreator(), node, scene);
+            createSkelBase(name, group, sceneNode->getCreator(), tmpl.mRoot, scene);
+            scene->mTextKeys = tmpl.mTextKeys;
         }
-        createObjects(name, group, sceneNode, node, scene, flags, 0, 0);
+
+        for(size_t i = 0;i < tmpl.mSteps.size();i++)
+        {
+            const ObjectTemplate::Step &step = tmpl.mSteps[i];
+            switch(step.mType)
+            {
+            case ObjectTemplate::Step::Type_Billboard:
+            {
+                Ogre::Bone* bone = scene->mSkelBase->getSkeleton()->getBone(step.mBone);
+                bone->setManuallyControlled(true);
+                scene->mBillboardNodes.push_back(bone);
+                break;
+            }
+            case ObjectTemplate::Step::Type_NodeControllers:
+                createNodeControllers(name, step.mNode->controller, scene, step.mAnimFlags);
+                break;
+            case ObjectTemplate::Step::Type_Entity:
+                createEntity(name, step.mMeshName, group, sceneNode->getCreator(), scene, step.mNode,
+                             step.mFlags, step.mAnimFlags);
+                break;
+            case ObjectTemplate::Step::Type_Particles:
+                createParticleSystem(name, group, sceneNode, scene, step.mNode, step.mFlags,
+                                     step.mPartFlags, step.mAnimFlags);
+                break;
+            }
+        }
+    }
+
+    static void load(Ogre::SceneNode *sceneNode, ObjectScenePtr scene, const std::string &name, const std::string &group, int flags=0)
+    {
+        Nif::NIFFile::ptr nif = Nif::NIFFile::create(name);
+        ObjectTemplate tmpl;
+        prepare(tmpl, nif, name, group, flags);
+        instantiate(tmpl, sceneNode, scene, name, group);
     }
 
     static void loadKf(Ogre::Skeleton *skel, const std::string &name,
@@ -1138,7 +1252,7 @@ public:
         if(r->recType != Nif::RC_NiSequenceStreamHelper)
         {
             nif->warn("First root was not a NiSequenceStreamHelper, but a "+
-                      r->recName+".");
+                      std::string(r->recName)+".");
             return;
         }
         const Nif::NiSequenceStreamHelper *seq = static_cast<const Nif::NiSequenceStreamHelper*>(r);
@@ -1159,7 +1273,7 @@ public:
         {
             if(extra->recType != Nif::RC_NiStringExtraData || ctrl->recType != Nif::RC_NiKeyframeController)
             {
-                nif->warn("Unexpected extra data "+extra->recName+" with controller "+ctrl->recName);
+                nif->warn("Unexpected extra data "+std::string(extra->recName)+" with controller "+ctrl->recName);
                 continue;
             }
 
@@ -1185,6 +1299,26 @@ public:
 };
 
 
+namespace
+{
+    typedef std::map<std::string, ObjectTemplate> PartTemplates;
+
+    PartTemplates sPartTemplates;
+    Loader::PartStats sPartStats = { 0, 0 };
+
+    void removeExpiredPartTemplates()
+    {
+        PartTemplates::iterator iter = sPartTemplates.begin();
+        while(iter != sPartTemplates.end())
+        {
+            if(iter->second.mFile.expired())
+                sPartTemplates.erase(iter++);
+            else
+                ++iter;
+        }
+    }
+}
+
 ObjectScenePtr Loader::createObjects(Ogre::SceneNode *parentNode, std::string name, const std::string &group)
 {
     ObjectScenePtr scene = ObjectScenePtr (new ObjectScene(parentNode->getCreator()));;
@@ -1209,66 +1343,128 @@ ObjectScenePtr Loader::createObjects(Ogre::Entity *parent, const std::string &bo
     ObjectScenePtr scene = ObjectScenePtr (new ObjectScene(parentNode->getCreator()));
 
     Misc::StringUtils::toLower(name);
-    NIFObjectLoader::load(parentNode, scene, name, group);
 
-    bool isskinned = false;
-    for(size_t i = 0;i < scene->mEntities.size();i++)
+    // Parts are attached to many skeletons (e.g. the same armor on every guard), so keep the
+    // steps of the converted file and only create the Ogre objects for each new instance. The
+    // templates do not keep their files loaded, so they are only reused while the file is still
+    // loaded (usually held by NIFFile's cache); after that it is loaded and converted again.
+    std::string key = name+"@bone="+bonename+"@group="+group;
+    PartTemplates::iterator iter = sPartTemplates.find(key);
+    Nif::NIFFile::ptr nif;
+    if(iter != sPartTemplates.end())
+        nif = iter->second.mFile.lock();
+
+    if(!nif)
     {
-        Ogre::Entity *ent = scene->mEntities[i];
-        if(scene->mSkelBase != ent && ent->hasSkeleton())
+        if(iter == sPartTemplates.end())
         {
-            isskinned = true;
-            break;
+            removeExpiredPartTemplates();
+            iter = sPartTemplates.insert(std::make_pair(key, ObjectTemplate())).first;
         }
+        else
+            iter->second = ObjectTemplate();
+
+        nif = Nif::NIFFile::create(name);
+        NIFObjectLoader::prepare(iter->second, nif, name, group);
+        ++sPartStats.mConverted;
     }
+    else
+        ++sPartStats.mReused;
 
-    Ogre::Vector3 scale(1.0f);
-    if(bonename.find("Left") != std::string::npos)
-        scale.x *= -1.0f;
+    ObjectTemplate &tmpl = iter->second;
+    NIFObjectLoader::instantiate(tmpl, parentNode, scene, name, group);
 
-    if(isskinned)
+    if(tmpl.mAttachments.size() != scene->mEntities.size())
     {
-        // Apparently both are allowed. Sigh.
-        // This could also mean that filters are supposed to work on the actual node
-        // hierarchy, rather than just trishapes, and the 'tri ' should be omitted?
-        std::string filter = "@shape=tri "+bonename;
-        std::string filter2 = "@shape="+bonename;
-        Misc::StringUtils::toLower(filter);
-        Misc::StringUtils::toLower(filter2);
+        tmpl.mAttachments.assign(scene->mEntities.size(), ObjectTemplate::Attach_None);
+
+        bool isskinned = false;
         for(size_t i = 0;i < scene->mEntities.size();i++)
         {
-            Ogre::Entity *entity = scene->mEntities[i];
-            if(entity->hasSkeleton())
+            Ogre::Entity *ent = scene->mEntities[i];
+            if(scene->mSkelBase != ent && ent->hasSkeleton())
             {
-                if(entity == scene->mSkelBase ||
-                   entity->getMesh()->getName().find(filter) != std::string::npos
-                   || entity->getMesh()->getName().find(filter2) != std::string::npos)
-                    parentNode->attachObject(entity);
+                isskinned = true;
+                break;
             }
-            else
+        }
+
+        if(isskinned)
+        {
+            // Apparently both are allowed. Sigh.
+            // This could also mean that filters are supposed to work on the actual node
+            // hierarchy, rather than just trishapes, and the 'tri ' should be omitted?
+            std::string filter = "@shape=tri "+bonename;
+            std::string filter2 = "@shape="+bonename;
+            Misc::StringUtils::toLower(filter);
+            Misc::StringUtils::toLower(filter2);
+            for(size_t i = 0;i < scene->mEntities.size();i++)
             {
-                if(entity->getMesh()->getName().find(filter) == std::string::npos
-                        || entity->getMesh()->getName().find(filter2) == std::string::npos)
-                    entity->detachFromParent();
+                Ogre::Entity *entity = scene->mEntities[i];
+                if(entity->hasSkeleton())
+                {
+                    if(entity == scene->mSkelBase ||
+                       entity->getMesh()->getName().find(filter) != std::string::npos
+                       || entity->getMesh()->getName().find(filter2) != std::string::npos)
+                        tmpl.mAttachments[i] = ObjectTemplate::Attach_Node;
+                }
+                else
+                {
+                    if(entity->getMesh()->getName().find(filter) == std::string::npos
+                            || entity->getMesh()->getName().find(filter2) == std::string::npos)
+                        tmpl.mAttachments[i] = ObjectTemplate::Attach_Detach;
+                }
             }
         }
-    }
-    else
-    {
-        for(size_t i = 0;i < scene->mEntities.size();i++)
+        else
         {
-            Ogre::Entity *entity = scene->mEntities[i];
-            if(!entity->isAttached())
+            for(size_t i = 0;i < scene->mEntities.size();i++)
             {
-                Ogre::TagPoint *tag = parent->attachObjectToBone(bonename, entity);
-                tag->setScale(scale);
+                if(!scene->mEntities[i]->isAttached())
+                    tmpl.mAttachments[i] = ObjectTemplate::Attach_Bone;
             }
         }
     }
 
+    Ogre::Vector3 scale(1.0f);
+    if(bonename.find("Left") != std::string::npos)
+        scale.x *= -1.0f;
+
+    for(size_t i = 0;i < scene->mEntities.size();i++)
+    {
+        Ogre::Entity *entity = scene->mEntities[i];
+        switch(tmpl.mAttachments[i])
+        {
+        case ObjectTemplate::Attach_None:
+            break;
+        case ObjectTemplate::Attach_Node:
+            parentNode->attachObject(entity);
+            break;
+        case ObjectTemplate::Attach_Bone:
+        {
+            Ogre::TagPoint *tag = parent->attachObjectToBone(bonename, entity);
+            tag->setScale(scale);
+            break;
+        }
+        case ObjectTemplate::Attach_Detach:
+            entity->detachFromParent();
+            break;
+        }
+    }
+
     return scene;
 }
 
+Loader::PartStats Loader::getPartStats()
+{
+    return sPartStats;
+}
+
+void Loader::clearPartTemplates()
+{
+    sPartTemplates.clear();
+}
+
 
 ObjectScenePtr Loader::createObjectBase(Ogre::SceneNode *parentNode, std::string name, const std::string &group)
 {
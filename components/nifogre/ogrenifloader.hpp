@@ -90,6 +90,16 @@ typedef Ogre::SharedPtr<ObjectScene> ObjectScenePtr;
 class Loader
 {
 public:
+    struct PartStats
+    {
+        size_t mConverted; ///< NIF files converted for a bone
+        size_t mReused; ///< parts created from an already converted file
+    };
+
+    /// Creates the objects of \a name and attaches them to the bone \a bonename of \a parent.
+    ///
+    /// The conversion of the NIF file is done only once per file and bone, as long as the file
+    /// stays loaded; later calls only create the Ogre objects.
     static ObjectScenePtr createObjects(Ogre::Entity *parent, const std::string &bonename,
                                     Ogre::SceneNode *parentNode,
                                     std::string name,
@@ -107,6 +117,12 @@ public:
                                     const std::string &name,
                                     TextKeyMap &textKeys,
                                     std::vector<Ogre::Controller<Ogre::Real> > &ctrls);
+
+    /// Totals since the program started.
+    static PartStats getPartStats();
+
+    /// Drops the conversion results kept by createObjects for bounded parts.
+    static void clearPartTemplates();
 };
 
 // FIXME: Should be with other general Ogre extensions.
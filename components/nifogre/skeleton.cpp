@@ -36,7 +36,7 @@ void NIFSkeletonLoader::buildBones(Ogre::Skeleton *skel, const Nif::Node *node,
          node->recType == Nif::RC_NiAutoNormalParticles ||
          node->recType == Nif::RC_NiRotatingParticles
          ))
-        warn("Unhandled "+node->recName+" "+node->name+" in "+skel->getName());
+        warn("Unhandled "+std::string(node->recName)+" "+node->name+" in "+skel->getName());
 
     Nif::ControllerPtr ctrl = node->controller;
     while(!ctrl.empty())
@@ -47,7 +47,7 @@ void NIFSkeletonLoader::buildBones(Ogre::Skeleton *skel, const Nif::Node *node,
              ctrl->recType == Nif::RC_NiKeyframeController ||
              ctrl->recType == Nif::RC_NiGeomMorpherController
              ))
-            warn("Unhandled "+ctrl->recName+" from node "+node->name+" in "+skel->getName());
+            warn("Unhandled "+std::string(ctrl->recName)+" from node "+node->name+" in "+skel->getName());
         ctrl = ctrl->next;
     }
 
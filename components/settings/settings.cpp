@@ -12,15 +12,18 @@ Ogre::ConfigFile Manager::mFile = Ogre::ConfigFile();
 Ogre::ConfigFile Manager::mDefaultFile = Ogre::ConfigFile();
 CategorySettingVector Manager::mChangedSettings = CategorySettingVector();
 CategorySettingValueMap Manager::mNewSettings = CategorySettingValueMap();
+int Manager::mGeneration = 0;
 
 void Manager::loadUser (const std::string& file)
 {
     mFile.load(file);
+    ++mGeneration;
 }
 
 void Manager::loadDefault (const std::string& file)
 {
     mDefaultFile.load(file);
+    ++mGeneration;
 }
 
 void Manager::saveUser(const std::string& file)
@@ -165,5 +168,36 @@ const CategorySettingVector Manager::apply()
 {
     CategorySettingVector vec = mChangedSettings;
     mChangedSettings.clear();
+
+    if (!vec.empty())
+        ++mGeneration;
+
     return vec;
 }
+
+namespace Settings
+{
+    template<>
+    void Setting<int>::read() const
+    {
+        mValue = Manager::getInt (mSetting, mCategory);
+    }
+
+    template<>
+    void Setting<float>::read() const
+    {
+        mValue = Manager::getFloat (mSetting, mCategory);
+    }
+
+    template<>
+    void Setting<bool>::read() const
+    {
+        mValue = Manager::getBool (mSetting, mCategory);
+    }
+
+    template<>
+    void Setting<std::string>::read() const
+    {
+        mValue = Manager::getString (mSetting, mCategory);
+    }
+}
@@ -24,6 +24,9 @@ namespace Settings
         static CategorySettingValueMap mNewSettings;
         ///< tracks all the settings that are in the default file, but not in user file yet
 
+        static int mGeneration;
+        ///< incremented whenever cached setting values (see Setting) may have become outdated
+
         void loadDefault (const std::string& file);
         ///< load file as the default settings (can be overridden by user settings)
 
@@ -47,6 +50,58 @@ namespace Settings
         static void setBool (const std::string& setting, const std::string& category, const bool value);
     };
 
+    ///
+    /// \brief Typed handle to a single setting that parses the value only once
+    ///
+    /// The value is read on first access and again after a settings file has been loaded or
+    /// Manager::apply() has reported changed settings. A change made with one of the Manager::set
+    /// functions therefore becomes visible after the next apply() call.
+    ///
+    /// Supported types: int, float, bool, std::string
+    ///
+    template<typename T>
+    class Setting
+    {
+            std::string mSetting;
+            std::string mCategory;
+            mutable T mValue;
+            mutable int mGeneration;
+
+            void read() const;
+
+        public:
+
+            Setting (const std::string& setting, const std::string& category)
+            : mSetting (setting), mCategory (category), mValue(), mGeneration (-1)
+            {}
+
+            T get() const
+            {
+                if (mGeneration!=Manager::mGeneration)
+                {
+                    read();
+                    mGeneration = Manager::mGeneration;
+                }
+
+                return mValue;
+            }
+
+            operator T() const
+            {
+                return get();
+            }
+    };
+
+    template<> void Setting<int>::read() const;
+    template<> void Setting<float>::read() const;
+    template<> void Setting<bool>::read() const;
+    template<> void Setting<std::string>::read() const;
+
+    typedef Setting<int> IntSetting;
+    typedef Setting<float> FloatSetting;
+    typedef Setting<bool> BoolSetting;
+    typedef Setting<std::string> StringSetting;
+
 }
 
 #endif // _COMPONENTS_SETTINGS_H
@@ -11,6 +11,16 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/format.hpp>
 
+#include <stdexcept>
+
+namespace
+{
+    // Layout of an ObjectHandle: slot index in the lower bits, generation in the upper bits.
+    const int sHandleIndexBits = 20;
+    const int sHandleIndexMask = (1<<sHandleIndexBits)-1;
+    const int sHandleGenerationMask = (1<<(31-sHandleIndexBits))-1;
+}
+
 namespace OEngine {
 namespace Physic
 {
@@ -324,7 +334,7 @@ namespace Physic
         hf.mBody = body;
         hf.mShape = hfShape;
 
-        mHeightFieldMap [name] = hf;
+        mHeightFieldMap [std::make_pair(x, y)] = hf;
 
         dynamicsWorld->addRigidBody(body,CollisionType_HeightMap|CollisionType_Raycasting,
                                     CollisionType_World|CollisionType_Actor|CollisionType_Raycasting);
@@ -332,17 +342,17 @@ namespace Physic
 
     void PhysicEngine::removeHeightField(int x, int y)
     {
-        const std::string name = "HeightField_"
-            + boost::lexical_cast<std::string>(x) + "_"
-            + boost::lexical_cast<std::string>(y);
+        HeightFieldContainer::iterator it = mHeightFieldMap.find(std::make_pair(x, y));
+        if (it == mHeightFieldMap.end())
+            return;
 
-        HeightField hf = mHeightFieldMap [name];
+        HeightField hf = it->second;
 
         dynamicsWorld->removeRigidBody(hf.mBody);
         delete hf.mShape;
         delete hf.mBody;
 
-        mHeightFieldMap.erase(name);
+        mHeightFieldMap.erase(it);
     }
 
     void PhysicEngine::adjustRigidBody(RigidBody* body, const Ogre::Vector3 &position, const Ogre::Quaternion &rotation,
@@ -437,6 +447,10 @@ namespace Physic
                 mCollisionObjectMap[name] = body;
             if (raycastingBody)
                 mRaycastingObjectMap[name] = raycastingBody;
+
+            PhysicObject& object = acquireObject(name);
+            object.mBody = body;
+            object.mRaycastingBody = raycastingBody;
         }
     }
 
@@ -486,6 +500,15 @@ namespace Physic
             }
             mRaycastingObjectMap.erase(it);
         }
+
+        HandleContainer::iterator handleIt = mHandleMap.find(name);
+        if (handleIt != mHandleMap.end())
+        {
+            PhysicObject& object = mObjects[handleIt->second & sHandleIndexMask];
+            object.mBody = 0;
+            object.mRaycastingBody = 0;
+            releaseObject(name);
+        }
     }
 
     RigidBody* PhysicEngine::getRigidBody(const std::string &name, bool raycasting)
@@ -503,6 +526,99 @@ namespace Physic
         }
     }
 
+    RigidBody* PhysicEngine::getRigidBody(ObjectHandle handle, bool raycasting)
+    {
+        PhysicObject* object = getObject(handle);
+        if (!object)
+            return NULL;
+        return raycasting ? object->mRaycastingBody : object->mBody;
+    }
+
+    ObjectHandle PhysicEngine::getHandle(const std::string &name) const
+    {
+        HandleContainer::const_iterator it = mHandleMap.find(name);
+        if (it == mHandleMap.end())
+            return InvalidHandle;
+        return it->second;
+    }
+
+    bool PhysicEngine::isValidHandle(ObjectHandle handle) const
+    {
+        return getObject(handle) != NULL;
+    }
+
+    PhysicObject& PhysicEngine::acquireObject(const std::string &name)
+    {
+        HandleContainer::iterator it = mHandleMap.find(name);
+        if (it != mHandleMap.end())
+            return mObjects[it->second & sHandleIndexMask];
+
+        int index;
+        if (!mFreeSlots.empty())
+        {
+            index = mFreeSlots.back();
+            mFreeSlots.pop_back();
+        }
+        else
+        {
+            if (static_cast<int>(mObjects.size()) > sHandleIndexMask)
+                throw std::runtime_error("too many physics objects");
+            index = mObjects.size();
+            mObjects.push_back(PhysicObject());
+        }
+
+        PhysicObject& object = mObjects[index];
+        object.mName = name;
+        object.mBody = 0;
+        object.mRaycastingBody = 0;
+        object.mActor = 0;
+        object.mUsed = true;
+
+        mHandleMap[name] = (object.mGeneration << sHandleIndexBits) | index;
+
+        return object;
+    }
+
+    void PhysicEngine::releaseObject(const std::string &name)
+    {
+        HandleContainer::iterator it = mHandleMap.find(name);
+        if (it == mHandleMap.end())
+            return;
+
+        int index = it->second & sHandleIndexMask;
+        PhysicObject& object = mObjects[index];
+        if (object.mBody || object.mRaycastingBody || object.mActor)
+            return;
+
+        object.mUsed = false;
+        object.mName.clear();
+        object.mGeneration = (object.mGeneration + 1) & sHandleGenerationMask;
+
+        mFreeSlots.push_back(index);
+        mHandleMap.erase(it);
+    }
+
+    PhysicObject* PhysicEngine::getObject(ObjectHandle handle)
+    {
+        return const_cast<PhysicObject*>(static_cast<const PhysicEngine&>(*this).getObject(handle));
+    }
+
+    const PhysicObject* PhysicEngine::getObject(ObjectHandle handle) const
+    {
+        if (handle < 0)
+            return NULL;
+
+        std::size_t index = handle & sHandleIndexMask;
+        if (index >= mObjects.size())
+            return NULL;
+
+        const PhysicObject& object = mObjects[index];
+        if (!object.mUsed || object.mGeneration != (handle >> sHandleIndexBits))
+            return NULL;
+
+        return &object;
+    }
+
     class ContactTestResultCallback : public btCollisionWorld::ContactResultCallback
     {
     public:
@@ -637,6 +753,8 @@ namespace Physic
 
         //dynamicsWorld->addAction( newActor->mCharacter );
         mActorMap[name] = newActor;
+
+        acquireObject(name).mActor = newActor;
     }
 
     void PhysicEngine::removeCharacter(const std::string &name)
@@ -651,6 +769,13 @@ namespace Physic
                 delete act;
             }
             mActorMap.erase(it);
+
+            HandleContainer::iterator handleIt = mHandleMap.find(name);
+            if (handleIt != mHandleMap.end())
+            {
+                mObjects[handleIt->second & sHandleIndexMask].mActor = 0;
+                releaseObject(name);
+            }
         }
     }
 
@@ -668,6 +793,12 @@ namespace Physic
         }
     }
 
+    PhysicActor* PhysicEngine::getCharacter(ObjectHandle handle)
+    {
+        PhysicObject* object = getObject(handle);
+        return object ? object->mActor : 0;
+    }
+
     void PhysicEngine::emptyEventLists(void)
     {
     }
@@ -6,6 +6,7 @@
 #include <string>
 #include <list>
 #include <map>
+#include <vector>
 #include "BulletShapeLoader.h"
 #include "BulletCollision/CollisionShapes/btScaledBvhTriangleMeshShape.h"
 
@@ -180,6 +181,30 @@ namespace Physic
         RigidBody* mBody;
     };
 
+    /**
+     * Stable integer handle of an object (rigid bodies and/or actor sharing one name).
+     * The lower bits hold the slot index, the upper bits a generation counter, so a handle
+     * that outlived its object is detected instead of silently referring to a new one.
+     */
+    typedef int ObjectHandle;
+
+    const ObjectHandle InvalidHandle = -1;
+
+    /**
+     * Slot of the handle table. Pointers are owned by the maps in PhysicEngine.
+     */
+    struct PhysicObject
+    {
+        std::string mName;
+        RigidBody* mBody;
+        RigidBody* mRaycastingBody;
+        PhysicActor* mActor;
+        int mGeneration;
+        bool mUsed;
+
+        PhysicObject() : mBody(0), mRaycastingBody(0), mActor(0), mGeneration(0), mUsed(false) {}
+    };
+
     /**
      * The PhysicEngine class contain everything which is needed for Physic.
      * It's needed that Ogre Resources are set up before the PhysicEngine is created.
@@ -250,6 +275,23 @@ namespace Physic
          */
         RigidBody* getRigidBody(const std::string &name, bool raycasting=false);
 
+        /**
+         * Return a pointer to a given rigid body, without a string lookup.
+         * Returns NULL for stale or invalid handles.
+         */
+        RigidBody* getRigidBody(ObjectHandle handle, bool raycasting=false);
+
+        /**
+         * Return the handle of the object with the given name, or InvalidHandle if no rigid body
+         * or character with this name exists.
+         */
+        ObjectHandle getHandle(const std::string &name) const;
+
+        /**
+         * Does \a handle refer to an object that still exists?
+         */
+        bool isValidHandle(ObjectHandle handle) const;
+
         /**
          * Create and add a character to the scene, and add it to the ActorMap.
          */
@@ -267,6 +309,12 @@ namespace Physic
          */
         PhysicActor* getCharacter(const std::string &name);
 
+        /**
+         * Return a pointer to a character, without a string lookup.
+         * Returns NULL for stale or invalid handles.
+         */
+        PhysicActor* getCharacter(ObjectHandle handle);
+
         /**
          * This step the simulation of a given time.
          */
@@ -329,9 +377,11 @@ namespace Physic
         //the NIF file loader.
         BulletShapeLoader* mShapeLoader;
 
-        typedef std::map<std::string, HeightField> HeightFieldContainer;
+        typedef std::map<std::pair<int, int>, HeightField> HeightFieldContainer;
         HeightFieldContainer mHeightFieldMap;
 
+        // The name-keyed maps are only used for lookups by name and for iteration. Per-frame
+        // access goes through the handle table below.
         typedef std::map<std::string,RigidBody*> RigidBodyContainer;
         RigidBodyContainer mCollisionObjectMap;
 
@@ -340,12 +390,32 @@ namespace Physic
         typedef std::map<std::string, PhysicActor*>  PhysicActorContainer;
         PhysicActorContainer mActorMap;
 
+        typedef std::map<std::string, ObjectHandle> HandleContainer;
+        HandleContainer mHandleMap;
+
+        std::vector<PhysicObject> mObjects;
+        std::vector<int> mFreeSlots;
+
         Ogre::SceneManager* mSceneMgr;
 
         //debug rendering
         BtOgre::DebugDrawer* mDebugDrawer;
         bool isDebugCreated;
         bool mDebugActive;
+
+    private:
+        /**
+         * Return the slot for \a name, allocating a new one if required.
+         */
+        PhysicObject& acquireObject(const std::string &name);
+
+        /**
+         * Free the slot for \a name, if it does not hold any body or character anymore.
+         */
+        void releaseObject(const std::string &name);
+
+        PhysicObject* getObject(ObjectHandle handle);
+        const PhysicObject* getObject(ObjectHandle handle) const;
     };
 
 